@@ -452,6 +452,7 @@ static char const *const* command_ac_keywords( char const *command ) {
     static char const *const AC_SHOW_KEYWORDS[] = {
       // must be in sorted order
       L_all,
+      L_cache,
       L_english,
       L_macros,
       L_predefined,
@@ -462,6 +463,7 @@ static char const *const* command_ac_keywords( char const *command ) {
     static char const *const AC_SHOW_KEYWORDS_WITH_USING[] = {
       // must be in sorted order
       L_all,
+      L_cache,
       L_english,
       L_macros,
       L_predefined,
@@ -0,0 +1,411 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/batch.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines a function for parsing **cdecl** commands from a file using
+ * multiple parallel jobs.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "batch.h"
+#include "capture.h"
+#include "cdecl_command.h"
+#include "lexer.h"
+#include "literals.h"
+#include "options.h"
+#include "parse.h"
+#include "read_line.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+/// @endcond
+
+/**
+ * @addtogroup batch-group
+ * @{
+ */
+
+/**
+ * The minimum number of commands per job worth forking a child process for.
+ */
+#define BATCH_JOB_LINES_MIN       64
+
+/**
+ * The maximum number of commands per job to read before parsing them.
+ */
+#define BATCH_JOB_LINES_MAX       4096
+
+/**
+ * A command read, but not yet parsed.
+ */
+struct batch_line {
+  char   *s;                            ///< The command.
+  size_t  s_len;                        ///< Length of \a s.
+  int     line_no;                      ///< Value for \ref yylineno.
+};
+typedef struct batch_line batch_line_t;
+
+////////// local variables ////////////////////////////////////////////////////
+
+static batch_line_t  *batch_lines;      ///< Commands not yet parsed.
+static size_t         batch_lines_cap;  ///< Capacity of \ref batch_lines.
+static size_t         batch_lines_len;  ///< Length of \ref batch_lines.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Copies \a n bytes from \a fin to \a fout.
+ *
+ * @param fin The file to copy from.
+ * @param n The number of bytes to copy.
+ * @param fout The file to copy to.
+ */
+static void batch_copy_n( FILE *fin, size_t n, FILE *fout ) {
+  assert( fin != NULL );
+  assert( fout != NULL );
+
+  char buf[ 4096 ];
+  while ( n > 0 ) {
+    size_t const read_n = fread( buf, 1, n < sizeof buf ? n : sizeof buf, fin );
+    if ( read_n == 0 )
+      INTERNAL_ERROR( "%s\n", "unexpected end of batch job output" );
+    PERROR_EXIT_IF( fwrite( buf, 1, read_n, fout ) < read_n, EX_IOERR );
+    n -= read_n;
+  } // while
+}
+
+/**
+ * Checks whether the `'` at \a t is a digit separator, e.g., `1'000`, rather
+ * than the start of a character literal.
+ *
+ * @param s The command \a t points into.
+ * @param t A pointer to a `'` within \a s.
+ * @return Returns `true` only if the `'` at \a t is a digit separator.
+ */
+NODISCARD
+static bool batch_is_digit_separator( char const *s, char const *t ) {
+  assert( s != NULL );
+  assert( t != NULL );
+  assert( *t == '\'' );
+
+  // Find the start of the number, if any, that the ' is within.
+  char const *n = t;
+  while ( n > s && (isalnum( STATIC_CAST( unsigned char, n[-1] ) ) ||
+                    n[-1] == '\'' || n[-1] == '.') ) {
+    --n;
+  } // while
+  return isdigit( STATIC_CAST( unsigned char, n[0] ) ) ||
+         (n[0] == '.' && isdigit( STATIC_CAST( unsigned char, n[1] ) ));
+}
+
+/**
+ * Skips over a character or string literal.
+ *
+ * @param s A pointer to the opening `'` or `"` of the literal.
+ * @return Returns a pointer to the closing `'` or `"` of the literal or to the
+ * terminating null if the literal is unterminated.
+ */
+NODISCARD
+static char const* batch_skip_literal( char const *s ) {
+  assert( s != NULL );
+  char const quote = *s;
+  while ( *++s != '\0' && *s != quote ) {
+    if ( *s == '\\' && s[1] != '\0' )
+      ++s;                              // skip escaped character
+  } // while
+  return s;
+}
+
+/**
+ * Checks whether \a s is a command that is a barrier, that is does or might
+ * change state.
+ *
+ * @param s The command to check.
+ * @param in_comment A pointer to whether we're within a multi-line C comment.
+ * It is updated to whether we're within a multi-line C comment after \a s.
+ * @return Returns `true` only if \a s is a barrier.
+ */
+NODISCARD
+static bool batch_is_barrier( char const *s, bool *in_comment ) {
+  assert( s != NULL );
+  assert( in_comment != NULL );
+
+  // The lexer's state persists across lines within a C comment.
+  bool const was_in_comment = *in_comment;
+  for ( char const *t = s; *t != '\0'; ++t ) {
+    if ( *in_comment ) {
+      if ( t[0] == '*' && t[1] == '/' ) {
+        *in_comment = false;
+        ++t;
+      }
+    }
+    else if ( t[0] == '/' ) {
+      if ( t[1] == '/' )
+        break;
+      if ( t[1] == '*' ) {
+        *in_comment = true;
+        ++t;
+      }
+    }
+    else if ( t[0] == '"' ||
+              (t[0] == '\'' && !batch_is_digit_separator( s, t )) ) {
+      // Comment delimiters within a literal don't start a comment.
+      t = batch_skip_literal( t );
+      if ( *t == '\0' )
+        break;                          // unterminated literal
+    }
+  } // for
+  if ( was_in_comment || *in_comment )
+    return true;
+
+  SKIP_WS( s );
+  if ( *s == '\0' )
+    return false;                       // blank line
+
+  cdecl_command_t const *const command = cdecl_command_find( s );
+  if ( command == NULL ) {
+    // Either "explain" or "expand" will be inferred; otherwise it's an error.
+    return !opt_infer_command;
+  }
+
+  static char const *const STATELESS_COMMANDS[] = {
+    L_cast,
+    L_const /*cast*/,
+    L_declare,
+    L_dynamic /*cast*/,
+    L_expand,
+    L_explain,
+    L_help,
+    L_reinterpret /*cast*/,
+    L_show,
+    L_static /*cast*/,
+  };
+
+  FOREACH_ARRAY_ELEMENT( char const*, literal, STATELESS_COMMANDS ) {
+    if ( command->literal == *literal )
+      return false;
+  } // for
+  return true;
+}
+
+/**
+ * Parses a single command.
+ *
+ * @param line The \ref batch_line to parse.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ */
+NODISCARD
+static int batch_parse_line( batch_line_t const *line ) {
+  assert( line != NULL );
+  yylineno = line->line_no;
+  return cdecl_parse_string( line->s, line->s_len );
+}
+
+/**
+ * Parses commands in a child process, writing the status, output, and errors
+ * of each to \a fout.
+ *
+ * @param first The index of the first command in \ref batch_lines to parse.
+ * @param end One past the index of the last command in \ref batch_lines to
+ * parse.
+ * @param fout The file to write to.
+ */
+_Noreturn
+static void batch_job( size_t first, size_t end, FILE *fout ) {
+  assert( fout != NULL );
+
+  capture_init();
+
+  strbuf_t err_sbuf, out_sbuf;
+  strbuf_init( &err_sbuf );
+  strbuf_init( &out_sbuf );
+
+  for ( size_t i = first; i < end; ++i ) {
+    capture_begin();
+    int const status = batch_parse_line( &batch_lines[i] );
+    capture_end( &out_sbuf, &err_sbuf );
+    FPRINTF( fout, "%d %zu %zu\n", status, out_sbuf.len, err_sbuf.len );
+    PERROR_EXIT_IF(
+      fwrite( out_sbuf.str, 1, out_sbuf.len, fout ) < out_sbuf.len, EX_IOERR
+    );
+    PERROR_EXIT_IF(
+      fwrite( err_sbuf.str, 1, err_sbuf.len, fout ) < err_sbuf.len, EX_IOERR
+    );
+    strbuf_reset( &err_sbuf );
+    strbuf_reset( &out_sbuf );
+  } // for
+
+  FFLUSH( fout );
+  // Skip atexit() functions: there's no point in cleaning up everything that
+  // was inherited from the parent.
+  _exit( EX_OK );
+}
+
+/**
+ * Prints the status, output, and errors of each command parsed by a child
+ * process.
+ *
+ * @param fin The file written to by batch_job().
+ * @param status The status to return if \a fin contains no commands.
+ * @return Returns the status of the last command.
+ */
+NODISCARD
+static int batch_job_print( FILE *fin, int status ) {
+  assert( fin != NULL );
+
+  rewind( fin );
+  size_t err_len, out_len;
+  while ( fscanf( fin, "%d %zu %zu", &status, &out_len, &err_len ) == 3 &&
+          fgetc( fin ) == '\n' ) {
+    batch_copy_n( fin, out_len, stdout );
+    if ( err_len > 0 ) {
+      FFLUSH( stdout );                 // so output is interleaved correctly
+      batch_copy_n( fin, err_len, stderr );
+    }
+  } // while
+  return status;
+}
+
+/**
+ * Parses all commands in \ref batch_lines, in parallel if there are enough.
+ *
+ * @param status The status to return if there are no commands.
+ * @return Returns the status of the last command.
+ */
+NODISCARD
+static int batch_run( int status ) {
+  size_t jobs = batch_lines_len / BATCH_JOB_LINES_MIN;
+  if ( jobs > opt_jobs )
+    jobs = opt_jobs;
+
+  if ( jobs < 2 ) {
+    for ( size_t i = 0; i < batch_lines_len; ++i )
+      status = batch_parse_line( &batch_lines[i] );
+  }
+  else {
+    FILE **const job_files = MALLOC( FILE*, jobs );
+    pid_t *const job_pids = MALLOC( pid_t, jobs );
+
+    FFLUSH( stdout );                   // don't duplicate buffered output
+    FFLUSH( stderr );
+
+    for ( size_t j = 0; j < jobs; ++j ) {
+      job_files[j] = tmpfile();
+      PERROR_EXIT_IF( job_files[j] == NULL, EX_CANTCREAT );
+      job_pids[j] = fork();
+      PERROR_EXIT_IF( job_pids[j] == -1, EX_OSERR );
+      if ( job_pids[j] == 0 ) {
+        batch_job(
+          batch_lines_len *  j      / jobs,
+          batch_lines_len * (j + 1) / jobs,
+          job_files[j]
+        );
+      }
+    } // for
+
+    for ( size_t j = 0; j < jobs; ++j ) {
+      int job_status;
+      PERROR_EXIT_IF( waitpid( job_pids[j], &job_status, 0 ) == -1, EX_OSERR );
+      if ( !WIFEXITED( job_status ) || WEXITSTATUS( job_status ) != EX_OK )
+        INTERNAL_ERROR( "batch job %zu terminated abnormally\n", j + 1 );
+    } // for
+
+    for ( size_t j = 0; j < jobs; ++j ) {
+      status = batch_job_print( job_files[j], status );
+      PJL_DISCARD_RV( fclose( job_files[j] ) );
+    } // for
+
+    FREE( job_files );
+    FREE( job_pids );
+  }
+
+  for ( size_t i = 0; i < batch_lines_len; ++i )
+    FREE( batch_lines[i].s );
+  batch_lines_len = 0;
+  return status;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_parse_batch( FILE *fin, sbrl_is_cont_line_fn_t is_cont_line_fn ) {
+  assert( fin != NULL );
+  assert( is_cont_line_fn != NULL );
+
+  size_t const lines_max = opt_jobs * BATCH_JOB_LINES_MAX;
+  bool in_comment = false;
+  int line_no = 1;
+  strbuf_t sbuf;
+  int status = EX_OK;
+
+  strbuf_init( &sbuf );
+
+  while ( strbuf_read_line( &sbuf, fin, /*prompt_fn=*/NULL, is_cont_line_fn,
+                            &line_no ) ) {
+    batch_line_t line = {
+      .s_len = sbuf.len,
+      .line_no = line_no++
+    };
+    line.s = strbuf_take( &sbuf );
+
+    if ( batch_is_barrier( line.s, &in_comment ) ) {
+      status = batch_run( status );
+      status = batch_parse_line( &line );
+      FREE( line.s );
+      continue;
+    }
+
+    if ( batch_lines_len == batch_lines_cap ) {
+      batch_lines_cap = batch_lines_cap == 0 ? 64 : batch_lines_cap * 2;
+      REALLOC( batch_lines, batch_lines_cap );
+    }
+    batch_lines[ batch_lines_len++ ] = line;
+    if ( batch_lines_len == lines_max )
+      status = batch_run( status );
+  } // while
+
+  status = batch_run( status );
+  FREE( batch_lines );
+  batch_lines = NULL;
+  batch_lines_cap = 0;
+  strbuf_cleanup( &sbuf );
+  return status;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,77 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/batch.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_batch_H
+#define cdecl_batch_H
+
+/**
+ * @file
+ * Declares a function for parsing **cdecl** commands from a file using
+ * multiple parallel jobs.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "read_line.h"
+
+// standard
+#include <stdio.h>                      /* for FILE */
+
+/**
+ * @defgroup batch-group Parallel Batch Parsing
+ * A function for parsing **cdecl** commands from a file using multiple
+ * parallel jobs.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Parses **cdecl** commands from \a fin until EOF using up to \ref opt_jobs
+ * parallel jobs.
+ *
+ * @remarks
+ * @parblock
+ * Consecutive commands that don't change any state (e.g., `explain`) are
+ * divided among child processes forked from the current process, each of
+ * which therefore has its own parser and AST state.  Commands that do or
+ * might change state (e.g., `set`, `typedef`, `#define`, or `include`) are
+ * barriers: all commands before one are completed, then it's parsed by the
+ * current process itself so that every subsequent child process inherits the
+ * changed state.
+ *
+ * The output and errors of every command are printed in input order so that
+ * they're identical to having parsed the commands serially.
+ * @endparblock
+ *
+ * @param fin The `FILE` to read from.
+ * @param is_cont_line_fn The \ref sbrl_is_cont_line_fn_t function to use.
+ * @return Returns `EX_OK` upon success of the last command or another value
+ * upon failure.
+ */
+NODISCARD
+int cdecl_parse_batch( FILE *fin, sbrl_is_cont_line_fn_t is_cont_line_fn );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_batch_H */
+/* vim:set et sw=2 ts=2: */
@@ -32,6 +32,7 @@
 #include "c_kind.h"
 #include "c_sname.h"
 #include "c_type.h"
+#include "options.h"
 #include "slist.h"
 #include "types.h"
 #include "util.h"
@@ -42,7 +43,6 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stddef.h>                     /* for offsetof */
-#include <stdlib.h>                     /* for free(3) */
 #include <string.h>
 
 /// @endcond
@@ -107,6 +107,22 @@ static_assert(
   offsetof( c_operator_ast_t, member ) == offsetof( c_function_ast_t, member )
 );
 
+// Ensure the common AST node fits within two (64-byte) cache lines.
+static_assert( sizeof( c_ast_t ) <= 128 );
+
+/**
+ * The number of AST nodes in a \ref c_ast_arena_chunk.
+ */
+#define C_AST_ARENA_CHUNK_LEN     128
+
+/**
+ * A chunk of AST nodes allocated from by a \ref c_ast_arena.
+ */
+struct c_ast_arena_chunk {
+  c_ast_arena_chunk_t  *prev;           ///< Previous chunk, if any.
+  c_ast_t               ast[ C_AST_ARENA_CHUNK_LEN ]; ///< The AST nodes.
+};
+
 ////////// local variables ////////////////////////////////////////////////////
 
 #ifndef NDEBUG
@@ -114,6 +130,9 @@ static_assert(
 static size_t c_ast_count;              ///< ASTs allocated but not yet freed.
 #endif /* NDEBUG */
 
+static size_t c_ast_cold_total;         ///< Cold data ever allocated.
+static size_t c_ast_total;              ///< ASTs ever allocated.
+
 ////////// local functions ////////////////////////////////////////////////////
 
 /**
@@ -167,18 +186,17 @@ static c_alignas_t c_alignas_dup( c_alignas_t const *align ) {
 /**
  * Checks whether two alignments are equal.
  *
- * @param i_align The first alignment.
- * @param j_align The second alignment.
+ * @param i_align The first alignment; may be NULL.
+ * @param j_align The second alignment; may be NULL.
  * @return Returns `true` only if the two alignments are equal.
  */
 NODISCARD
 static bool c_alignas_equal( c_alignas_t const *i_align,
                              c_alignas_t const *j_align ) {
-  assert( i_align != NULL );
-  assert( j_align != NULL );
-
   if ( i_align == j_align )
     return true;
+  if ( i_align == NULL || j_align == NULL )
+    return false;
   if ( i_align->kind != j_align->kind )
     return false;
 
@@ -196,6 +214,109 @@ static bool c_alignas_equal( c_alignas_t const *i_align,
   UNEXPECTED_INT_VALUE( i_align->kind );
 }
 
+/**
+ * Allocates an AST node from \a arena.
+ *
+ * @param arena The \ref c_ast_arena to allocate from.
+ * @return Returns a pointer to an uninitialized AST node.
+ */
+NODISCARD
+static c_ast_t* c_ast_arena_alloc( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+
+  if ( arena->chunk == NULL || arena->chunk_len == C_AST_ARENA_CHUNK_LEN ) {
+    c_ast_arena_chunk_t *chunk = arena->free_chunk;
+    if ( chunk != NULL )
+      arena->free_chunk = chunk->prev;
+    else
+      chunk = MALLOC( c_ast_arena_chunk_t, 1 );
+    chunk->prev = arena->chunk;
+    arena->chunk = chunk;
+    arena->chunk_len = 0;
+  }
+
+  return &arena->chunk->ast[ arena->chunk_len++ ];
+}
+
+/**
+ * Gets the cold data of \a ast, allocating it first if necessary.
+ *
+ * @param ast The AST to get the cold data of.
+ * @return Returns said cold data.
+ */
+NODISCARD
+static c_ast_cold_t* c_ast_cold( c_ast_t *ast ) {
+  assert( ast != NULL );
+  if ( ast->cold == NULL ) {
+    ast->cold = MALLOC( c_ast_cold_t, 1 );
+    *ast->cold = (c_ast_cold_t){ .align = { .kind = C_ALIGNAS_NONE } };
+    ++c_ast_cold_total;
+  }
+  return ast->cold;
+}
+
+/**
+ * Cleans-up all memory associated with \a ast but does _not_ free \a ast
+ * itself.
+ *
+ * @note Even though \a ast invariably is part of a larger abstract syntax
+ * tree, this function cleans-up _only_ \a ast and _not_ any child AST node \a
+ * ast may have.
+ *
+ * @param ast The AST to clean up.
+ */
+static void c_ast_cleanup( c_ast_t *ast ) {
+  assert( ast != NULL );
+  assert( c_ast_count-- > 0 );          // side-effect is OK here
+
+  if ( ast->cold != NULL ) {
+    c_alignas_cleanup( &ast->cold->align );
+    FREE( ast->cold );
+  }
+  c_sname_cleanup( &ast->sname );
+  switch ( ast->kind ) {
+    case K_ARRAY:
+      if ( ast->array.kind == C_ARRAY_SIZE_NAME )
+        FREE( ast->array.size_name );
+      break;
+    case K_LAMBDA:
+      c_ast_list_cleanup( &ast->lambda.capture_ast_list );
+      FALLTHROUGH;
+    case K_APPLE_BLOCK:
+    case K_CONSTRUCTOR:
+    case K_FUNCTION:
+    case K_OPERATOR:
+    case K_USER_DEFINED_LIT:
+      c_ast_list_cleanup( &ast->func.param_ast_list );
+      break;
+    case K_CLASS_STRUCT_UNION:
+    case K_CONCEPT:
+    case K_ENUM:
+    case K_NAME:
+    case K_POINTER_TO_MEMBER:
+      c_sname_cleanup( &ast->name.sname );
+      break;
+    case K_STRUCTURED_BINDING:
+      c_sname_list_cleanup( &ast->struct_bind.sname_list );
+      break;
+
+    case K_BUILTIN:
+    case K_CAPTURE:
+    case K_CAST:
+    case K_DESTRUCTOR:
+    case K_PLACEHOLDER:
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+    case K_TYPEDEF:
+    case K_USER_DEFINED_CONV:
+    case K_VARIADIC:
+      // nothing to do
+      break;
+  } // switch
+
+}
+
 #ifndef NDEBUG
 /**
  * Checks \a ast for a cycle.
@@ -219,7 +340,8 @@ static bool c_ast_has_cycle( c_ast_t const *ast ) {
  * Duplicates \a src_list.
  *
  * @param src_list The AST list to duplicate; may be NULL.
- * @param dst_list The list to append the duplicated AST nodes onto.
+ * @param arena The \ref c_ast_arena to allocate the duplicated AST nodes
+ * from.
  * @return Returns the duplicated AST list or an empty list only if \a src_list
  * is NULL.
  *
@@ -227,16 +349,16 @@ static bool c_ast_has_cycle( c_ast_t const *ast ) {
  */
 NODISCARD
 static c_ast_list_t c_ast_list_dup( c_ast_list_t const *src_list,
-                                    c_ast_list_t *dst_list ) {
-  slist_t dup_list;
-  slist_init( &dup_list );
-
-  if ( src_list != NULL ) {
-    FOREACH_SLIST_NODE( src_node, src_list ) {
-      c_ast_t const *const src_ast = src_node->data;
-      c_ast_t *const dup_ast = c_ast_dup( src_ast, dst_list );
-      slist_push_back( &dup_list, dup_ast );
-    } // for
+                                    c_ast_arena_t *arena ) {
+  c_ast_list_t dup_list;
+  c_ast_list_init( &dup_list );
+
+  if ( src_list != NULL && src_list->len > 0 ) {
+    dup_list.asts = MALLOC( c_ast_t*, src_list->len + 1 );
+    dup_list.cap = src_list->len;
+    FOREACH_AST_LIST( src_ast, src_list )
+      dup_list.asts[ dup_list.len++ ] = c_ast_dup( *src_ast, arena );
+    dup_list.asts[ dup_list.len ] = NULL;
   }
 
   return dup_list;
@@ -253,28 +375,43 @@ static c_ast_list_t c_ast_list_dup( c_ast_list_t const *src_list,
  * @sa c_ast_equal()
  */
 NODISCARD
-static inline bool c_ast_list_equal( c_ast_list_t const *i_list,
-                                     c_ast_list_t const *j_list ) {
-  return slist_equal(
-    i_list, j_list, POINTER_CAST( slist_equal_fn_t, &c_ast_equal )
-  );
-}
+static bool c_ast_list_equal( c_ast_list_t const *i_list,
+                              c_ast_list_t const *j_list ) {
+  assert( i_list != NULL );
+  assert( j_list != NULL );
 
-////////// extern functions ///////////////////////////////////////////////////
-
-void c_ast_cleanup_all( void ) {
-  assert( c_ast_count == 0 );
+  if ( i_list->len != j_list->len )
+    return false;
+  for ( size_t i = 0; i < i_list->len; ++i ) {
+    if ( !c_ast_equal( i_list->asts[i], j_list->asts[i] ) )
+      return false;
+  } // for
+  return true;
 }
 
-c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *dst_list ) {
+/**
+ * Duplicates \a ast itself, but not its child AST, if any.
+ *
+ * @param ast The AST to duplicate.
+ * @param arena The \ref c_ast_arena to allocate the duplicated AST node from.
+ * @return Returns the duplicated AST.
+ *
+ * @sa c_ast_dup()
+ */
+NODISCARD
+static c_ast_t* c_ast_dup_node( c_ast_t const *ast, c_ast_arena_t *arena ) {
   assert( ast != NULL );
 
   c_ast_t *const dup_ast =
-    c_ast_new( ast->kind, ast->depth, &ast->loc, dst_list );
-
-  dup_ast->align = c_alignas_dup( &ast->align );
-  dup_ast->dup_from_ast = ast;
-  dup_ast->is_param_pack = ast->is_param_pack;
+    c_ast_new( ast->kind, ast->depth, &ast->loc, arena );
+
+  if ( ast->cold != NULL &&
+       (ast->cold->align.kind != C_ALIGNAS_NONE || ast->cold->is_param_pack) ) {
+    c_ast_cold_t *const dup_cold = c_ast_cold( dup_ast );
+    if ( ast->cold->align.kind != C_ALIGNAS_NONE )
+      dup_cold->align = c_alignas_dup( &ast->cold->align );
+    dup_cold->is_param_pack = ast->cold->is_param_pack;
+  }
   dup_ast->sname = c_sname_dup( &ast->sname );
   dup_ast->type = ast->type;
 
@@ -329,15 +466,15 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *dst_list ) {
     case K_CONSTRUCTOR:
     case K_USER_DEFINED_LIT:
       dup_ast->func.param_ast_list =
-        c_ast_list_dup( &ast->func.param_ast_list, dst_list );
+        c_ast_list_dup( &ast->func.param_ast_list, arena );
       break;
 
     case K_LAMBDA:
       // ret_ast duplicated by referrer code below
       dup_ast->func.param_ast_list =
-        c_ast_list_dup( &ast->func.param_ast_list, dst_list );
+        c_ast_list_dup( &ast->func.param_ast_list, arena );
       dup_ast->lambda.capture_ast_list =
-        c_ast_list_dup( &ast->lambda.capture_ast_list, dst_list );
+        c_ast_list_dup( &ast->lambda.capture_ast_list, arena );
       break;
 
     case K_STRUCTURED_BINDING:
@@ -360,38 +497,31 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *dst_list ) {
       break;
   } // switch
 
-  if ( c_ast_is_referrer( ast ) ) {
-    c_ast_t *const child_ast = ast->parent.of_ast;
-    if ( child_ast != NULL ) {
-      if ( c_ast_is_parent( ast ) ) {
-        c_ast_set_parent( c_ast_dup( child_ast, dst_list ), dup_ast );
-      } else {
-        //
-        // A non-parent referrer (e.g., K_TYPEDEF) merely refers to another
-        // AST, but is _not_ the "parent" of it and the "child" (referred to)
-        // AST's parent must be NULL.
-        //
-        dup_ast->parent.of_ast = child_ast;
-        assert( child_ast->parent_ast == NULL );
-      }
-    }
-  }
-
   return dup_ast;
 }
 
-bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
-  if ( i_ast == j_ast )
-    return true;
-  if ( i_ast == NULL || j_ast == NULL )
-    return false;
+/**
+ * Checks whether \a i_ast and \a j_ast themselves, but not their child ASTs,
+ * if any, are equal _except_ for AST node names.
+ *
+ * @param i_ast The first AST.
+ * @param j_ast The second AST.
+ * @return Returns `true` only if the two ASTs are equal.
+ *
+ * @sa c_ast_equal()
+ */
+NODISCARD
+static bool c_ast_equal_node( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
+  assert( i_ast != NULL );
+  assert( j_ast != NULL );
+
   if ( i_ast->kind != j_ast->kind )
     return false;
-  if ( !c_alignas_equal( &i_ast->align, &j_ast->align ) )
+  if ( !c_alignas_equal( c_ast_align( i_ast ), c_ast_align( j_ast ) ) )
     return false;
   if ( !c_type_equiv( &i_ast->type, &j_ast->type ) )
     return false;
-  if ( i_ast->is_param_pack != j_ast->is_param_pack )
+  if ( c_ast_is_param_pack( i_ast ) != c_ast_is_param_pack( j_ast ) )
     return false;
 
   switch ( i_ast->kind ) {
@@ -491,68 +621,141 @@ bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
       break;                            // LCOV_EXCL_LINE
   } // switch
 
-  if ( !c_ast_is_referrer( i_ast ) ) {
-    assert( !c_ast_is_referrer( j_ast ) );
-    return true;
-  }
-  assert( c_ast_is_referrer( j_ast ) );
+  return true;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void c_ast_arena_cleanup( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+
+  arena->keep_chunk = NULL;
+  arena->keep_len = 0;
+  c_ast_arena_reset( arena );
+
+  while ( arena->free_chunk != NULL ) {
+    c_ast_arena_chunk_t *const prev = arena->free_chunk->prev;
+    FREE( arena->free_chunk );
+    arena->free_chunk = prev;
+  } // while
+}
+
+void c_ast_arena_keep( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+  arena->keep_chunk = arena->chunk;
+  arena->keep_len = arena->chunk_len;
+}
+
+void c_ast_arena_reset( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+
+  while ( arena->chunk != arena->keep_chunk ) {
+    c_ast_arena_chunk_t *const chunk = arena->chunk;
+    while ( arena->chunk_len > 0 )
+      c_ast_cleanup( &chunk->ast[ --arena->chunk_len ] );
+    arena->chunk = chunk->prev;
+    chunk->prev = arena->free_chunk;
+    arena->free_chunk = chunk;
+    // All chunks but the current one are full.
+    arena->chunk_len = arena->chunk != NULL ? C_AST_ARENA_CHUNK_LEN : 0;
+  } // while
+
+  while ( arena->chunk_len > arena->keep_len )
+    c_ast_cleanup( &arena->chunk->ast[ --arena->chunk_len ] );
+}
+
+void c_ast_cleanup_all( void ) {
+  assert( c_ast_count == 0 );
+}
+
+c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_arena_t *arena ) {
+  assert( ast != NULL );
+
+  c_ast_t const *const root_ast = ast;
+  c_ast_t *const dup_root_ast = c_ast_dup_node( ast, arena );
+
+  //
+  // Duplicate the chain of children iteratively rather than recursively since
+  // it can be arbitrarily long.
+  //
+  for ( c_ast_t *dup_ast = dup_root_ast; c_ast_is_referrer( ast ); ) {
+    c_ast_t *const child_ast = ast->parent.of_ast;
+    if ( child_ast == NULL )
+      break;
+    if ( !c_ast_is_parent( ast ) ) {
+      //
+      // A non-parent referrer (e.g., K_TYPEDEF) merely refers to another AST,
+      // but is _not_ the "parent" of it and the "child" (referred to) AST's
+      // parent must be NULL.
+      //
+      dup_ast->parent.of_ast = child_ast;
+      assert( child_ast->parent_ast == NULL );
+      break;
+    }
+    c_ast_t *const dup_child_ast = c_ast_dup_node( child_ast, arena );
+    c_ast_set_parent( dup_child_ast, dup_ast );
+    ast = child_ast;
+    dup_ast = dup_child_ast;
+  } // for
+
+  //
+  // Only the root of a duplicate is ever subsequently made a parameter pack
+  // via c_ast_set_parameter_pack(), so only it needs to know the AST it was
+  // duplicated from.  Not recording it for every node means duplicating a
+  // node allocates its cold data only if the original has any.
+  //
+  c_ast_cold( dup_root_ast )->dup_from_ast = root_ast;
+  return dup_root_ast;
+}
+
+bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
+  //
+  // Compare the chains of children iteratively rather than recursively since
+  // they can be arbitrarily long.
+  //
+  for (;;) {
+    if ( i_ast == j_ast )
+      return true;
+    if ( i_ast == NULL || j_ast == NULL )
+      return false;
+    if ( !c_ast_equal_node( i_ast, j_ast ) )
+      return false;
+    if ( !c_ast_is_referrer( i_ast ) ) {
+      assert( !c_ast_is_referrer( j_ast ) );
+      return true;
+    }
+    assert( c_ast_is_referrer( j_ast ) );
+    i_ast = i_ast->parent.of_ast;
+    j_ast = j_ast->parent.of_ast;
+  } // for
+}
 
-  return c_ast_equal( i_ast->parent.of_ast, j_ast->parent.of_ast );
+void c_ast_list_cleanup( c_ast_list_t *list ) {
+  if ( list != NULL ) {
+    FREE( list->asts );
+    c_ast_list_init( list );
+  }
 }
 
-void c_ast_free( c_ast_t *ast ) {
-  if ( ast != NULL ) {
-    assert( c_ast_count-- > 0 );        // side-effect is OK here
-
-    c_alignas_cleanup( &ast->align );
-    c_sname_cleanup( &ast->sname );
-    switch ( ast->kind ) {
-      case K_ARRAY:
-        if ( ast->array.kind == C_ARRAY_SIZE_NAME )
-          FREE( ast->array.size_name );
-        break;
-      case K_LAMBDA:
-        // Do not pass &c_ast_free as the second argument since all ASTs are
-        // free'd via the free( ast ) below. Just free the list nodes.
-        slist_cleanup( &ast->lambda.capture_ast_list, /*free_fn=*/NULL );
-        FALLTHROUGH;
-      case K_APPLE_BLOCK:
-      case K_CONSTRUCTOR:
-      case K_FUNCTION:
-      case K_OPERATOR:
-      case K_USER_DEFINED_LIT:
-        // Do not pass &c_ast_free as the second argument since all ASTs are
-        // free'd via the free( ast ) below. Just free the list nodes.
-        slist_cleanup( &ast->func.param_ast_list, /*free_fn=*/NULL );
-        break;
-      case K_CLASS_STRUCT_UNION:
-      case K_CONCEPT:
-      case K_ENUM:
-      case K_NAME:
-      case K_POINTER_TO_MEMBER:
-        c_sname_cleanup( &ast->name.sname );
-        break;
-      case K_STRUCTURED_BINDING:
-        c_sname_list_cleanup( &ast->struct_bind.sname_list );
-        break;
-
-      case K_BUILTIN:
-      case K_CAPTURE:
-      case K_CAST:
-      case K_DESTRUCTOR:
-      case K_PLACEHOLDER:
-      case K_POINTER:
-      case K_REFERENCE:
-      case K_RVALUE_REFERENCE:
-      case K_TYPEDEF:
-      case K_USER_DEFINED_CONV:
-      case K_VARIADIC:
-        // nothing to do
-        break;
-    } // switch
-
-    free( ast );
+void c_ast_list_push_back( c_ast_list_t *list, c_ast_t *ast ) {
+  assert( list != NULL );
+  assert( ast != NULL );
+
+  if ( list->len == list->cap ) {
+    list->cap = list->cap == 0 ? 4 : list->cap * 2;
+    REALLOC( list->asts, list->cap + 1 /* for NULL */ );
   }
+  list->asts[ list->len++ ] = ast;
+  list->asts[ list->len ] = NULL;
+}
+
+void c_ast_list_push_front( c_ast_list_t *list, c_ast_t *ast ) {
+  assert( list != NULL );
+  assert( ast != NULL );
+
+  c_ast_list_push_back( list, ast );
+  memmove( list->asts + 1, list->asts, (list->len - 1) * sizeof( c_ast_t* ) );
+  list->asts[0] = ast;
 }
 
 void c_ast_list_set_param_of( c_ast_list_t *param_ast_list,
@@ -561,43 +764,60 @@ void c_ast_list_set_param_of( c_ast_list_t *param_ast_list,
   assert( func_ast != NULL );
   assert( is_1_bit_only_in_set( func_ast->kind, K_ANY_FUNCTION_LIKE ) );
 
-  FOREACH_SLIST_NODE( param_node, param_ast_list ) {
-    c_ast_t *const param_ast = param_node->data;
+  FOREACH_AST_LIST( param, param_ast_list ) {
+    c_ast_t *const param_ast = *param;
     assert( param_ast->param_of_ast == NULL );
     param_ast->param_of_ast = func_ast;
   } // for
 }
 
+bool c_ast_move_parameter_pack( c_ast_t *from_ast, c_ast_t *to_ast ) {
+  assert( from_ast != NULL );
+  assert( to_ast != NULL );
+  if ( !c_ast_is_param_pack( from_ast ) )
+    return false;
+  from_ast->cold->is_param_pack = false;
+  c_ast_cold( to_ast )->is_param_pack = true;
+  return true;
+}
+
 c_ast_t* c_ast_new( c_ast_kind_t kind, unsigned depth, c_loc_t const *loc,
-                    c_ast_list_t *dst_list ) {
+                    c_ast_arena_t *arena ) {
   assert( is_1_bit( kind ) );
   assert( loc != NULL );
-  assert( dst_list != NULL );
 
   static c_ast_id_t next_id;
 
-  c_ast_t *const ast = MALLOC( c_ast_t, 1 );
+  c_ast_t *const ast = c_ast_arena_alloc( arena );
   *ast = (c_ast_t){
     .depth = depth,
     .kind = kind,
     .loc = *loc,
-    .type = T_NONE,
-    .unique_id = ++next_id
+    .type = T_NONE
   };
+  if ( (opt_cdecl_debug & CDECL_DEBUG_OPT_AST_UNIQUE_ID) != 0 )
+    c_ast_cold( ast )->unique_id = ++next_id;
+  ++c_ast_total;
 
 #ifndef NDEBUG
   ++c_ast_count;
 #endif /* NDEBUG */
-  slist_push_back( dst_list, ast );
   return ast;
 }
 
+void c_ast_set_align( c_ast_t *ast, c_alignas_t const *align ) {
+  assert( ast != NULL );
+  assert( align != NULL );
+  c_ast_cold( ast )->align = *align;
+}
+
 void c_ast_set_parameter_pack( c_ast_t *ast ) {
   assert( ast != NULL );
-  ast->is_param_pack = true;
-  if ( ast->dup_from_ast != NULL ) {
+  c_ast_cold_t *const cold = c_ast_cold( ast );
+  cold->is_param_pack = true;
+  if ( cold->dup_from_ast != NULL ) {
     // I don't like this CONST_CAST(), but I can't think of a way around it.
-    c_ast_set_parameter_pack( CONST_CAST( c_ast_t*, ast->dup_from_ast ) );
+    c_ast_set_parameter_pack( CONST_CAST( c_ast_t*, cold->dup_from_ast ) );
   }
 }
 
@@ -614,7 +834,7 @@ void c_ast_set_parent( c_ast_t *child_ast, c_ast_t *parent_ast ) {
     return;
   assert( !c_ast_has_cycle( child_ast ) );
 
-  if ( child_ast->is_param_pack &&
+  if ( c_ast_is_param_pack( child_ast ) &&
        (parent_ast->kind & K_ANY_FUNCTION_LIKE) == 0 ) {
     //
     // Except for function-like return type ASTs, the root AST node of a tree
@@ -644,11 +864,22 @@ void c_ast_set_parent( c_ast_t *child_ast, c_ast_t *parent_ast ) {
     // where it's a parameter pack of a reference, not a reference to a
     // parameter pack.
     //
-    child_ast->is_param_pack = false;
-    parent_ast->is_param_pack = true;
+    c_ast_move_parameter_pack( child_ast, parent_ast );
   }
 }
 
+void c_ast_stats( c_ast_stats_t *stats ) {
+  assert( stats != NULL );
+  *stats = (c_ast_stats_t){
+    .ast_count = c_ast_total,
+    .cold_count = c_ast_cold_total,
+    .ast_size = sizeof( c_ast_t ),
+    .cold_size = sizeof( c_ast_cold_t ),
+    .inline_size = sizeof( c_ast_t ) - sizeof( c_ast_cold_t* )
+                 + sizeof( c_ast_cold_t )
+  };
+}
+
 c_ast_t const* c_ast_visit( c_ast_t const *ast, c_ast_visit_dir_t dir,
                             c_ast_visit_fn_t visit_fn, user_data_t user_data ) {
   assert( visit_fn != NULL );
@@ -670,11 +901,25 @@ c_ast_t const* c_ast_visit( c_ast_t const *ast, c_ast_visit_dir_t dir,
 
 /** @} */
 
+extern inline c_alignas_t const* c_ast_align( c_ast_t const* );
+extern inline c_ast_t const* c_ast_dup_from( c_ast_t const* );
 extern inline bool c_ast_is_orphan( c_ast_t const* );
+extern inline bool c_ast_is_param_pack( c_ast_t const* );
 extern inline bool c_ast_is_parent( c_ast_t const* );
 extern inline bool c_ast_is_referrer( c_ast_t const* );
+extern inline c_ast_t* c_ast_list_at( c_ast_list_t const*, size_t );
+extern inline c_ast_t* c_ast_list_back( c_ast_list_t const* );
+extern inline bool c_ast_list_empty( c_ast_list_t const* );
+extern inline c_ast_t* c_ast_list_front( c_ast_list_t const* );
+extern inline void c_ast_list_init( c_ast_list_t* );
+extern inline size_t c_ast_list_len( c_ast_list_t const* );
+extern inline c_ast_list_t c_ast_list_move( c_ast_list_t* );
+extern inline c_ast_t* c_ast_list_pop_back( c_ast_list_t* );
 extern inline c_param_t const* c_ast_params( c_ast_t const* );
+extern inline c_ast_id_t c_ast_unique_id( c_ast_t const* );
 extern inline c_ast_t const* c_capture_ast( c_capture_t const* );
+extern inline c_capture_t const* c_capture_next( c_capture_t const* );
 extern inline c_ast_t const* c_param_ast( c_param_t const* );
+extern inline c_param_t const* c_param_next( c_param_t const* );
 
 /* vim:set et sw=2 ts=2: */
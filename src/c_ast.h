@@ -49,11 +49,37 @@
 
 /// @endcond
 
+/**
+ * Convenience macro for iterating over all AST nodes of a \ref c_ast_list.
+ *
+ * @param VAR The `c_ast_t *const*` loop variable.
+ * @param LIST A pointer to the \ref c_ast_list to iterate over.
+ *
+ * @sa #FOREACH_AST_LIST_UNTIL()
+ */
+#define FOREACH_AST_LIST(VAR,LIST) \
+  FOREACH_AST_LIST_UNTIL( VAR, (LIST), /*END=*/NULL )
+
+/**
+ * Convenience macro for iterating over all AST nodes of a \ref c_ast_list up
+ * to but not including \a END.
+ *
+ * @param VAR The `c_ast_t *const*` loop variable.
+ * @param LIST A pointer to the \ref c_ast_list to iterate over.
+ * @param END A pointer to the element to end before.  If NULL, equivalent to
+ * #FOREACH_AST_LIST().
+ *
+ * @sa #FOREACH_AST_LIST()
+ */
+#define FOREACH_AST_LIST_UNTIL(VAR,LIST,END)                  \
+  for ( c_ast_t *const *VAR = (LIST)->asts;                   \
+        VAR != NULL && *VAR != NULL && VAR != (END); ++VAR )
+
 /**
  * Convenience macro for iterating over all \ref c_capture_ast nodes of a \ref
  * c_lambda_ast.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_capture_t loop variable.
  * @param AST The \ref c_lambda_ast to iterate the captures of.
  *
  * @sa #FOREACH_AST_FUNC_PARAM()
@@ -66,7 +92,7 @@
  * Convenience macro for iterating over all \ref c_capture_ast nodes of a \ref
  * c_lambda_ast up to but not including \a END.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_capture_t loop variable.
  * @param AST The \ref c_lambda_ast to iterate the captures of.
  * @param END A pointer to the capture to end before.  If NULL, equivalent to
  * #FOREACH_AST_LAMBDA_CAPTURE().
@@ -75,12 +101,12 @@
  * @sa #FOREACH_AST_LAMBDA_CAPTURE()
  */
 #define FOREACH_AST_LAMBDA_CAPTURE_UNTIL(VAR,AST,END) \
-  FOREACH_SLIST_NODE_UNTIL( VAR, &(AST)->lambda.capture_ast_list, (END) )
+  FOREACH_AST_LIST_UNTIL( VAR, &(AST)->lambda.capture_ast_list, (END) )
 
 /**
  * Convenience macro for iterating over all parameters of a function-like AST.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_param_t loop variable.
  * @param AST The function-like AST to iterate the parameters of.
  *
  * @sa c_ast_params()
@@ -94,7 +120,7 @@
  * Convenience macro for iterating over all parameters of a function-like AST
  * up to but not including \a END.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_param_t loop variable.
  * @param AST The function-like AST to iterate the parameters of.
  * @param END A pointer to the parameter to end before.  If NULL, equivalent to
  * #FOREACH_AST_FUNC_PARAM().
@@ -104,7 +130,7 @@
  * @sa #FOREACH_AST_LAMBDA_CAPTURE_UNTIL()
  */
 #define FOREACH_AST_FUNC_PARAM_UNTIL(VAR,AST,END) \
-  FOREACH_SLIST_NODE_UNTIL( VAR, &(AST)->func.param_ast_list, (END) )
+  FOREACH_AST_LIST_UNTIL( VAR, &(AST)->func.param_ast_list, (END) )
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -200,17 +226,20 @@ typedef bool (*c_ast_visit_fn_t)( c_ast_t const *ast, user_data_t user_data );
  * Typically, nodes of a tree data structure are freed by freeing the root node
  * followed by its child nodes in turn, recursively.  This is _not_ done for
  * AST nodes.  Instead, AST nodes created via c_ast_new() or c_ast_dup() are
- * appended to a \ref c_ast_list_t.  Nodes are later freed by traversing the
- * list and calling c_ast_free() on each node individually.  It's done this way
- * to simplify node memory management.
+ * allocated from a \ref c_ast_arena.  Nodes are later freed all at once by
+ * c_ast_arena_reset().  It's done this way to simplify node memory management
+ * and because allocating a node is then merely bumping an index.
  *
  * As an AST is being built, sometimes #K_PLACEHOLDER nodes are created
  * temporarily.  Later, once an actual node is created, the #K_PLACEHOLDER node
  * is replaced.  Rather than freeing a #K_PLACEHOLDER node immediately (and,
  * for a parent node, set its "of" node to NULL just prior to being freed so as
- * not to free its child node also), it's simply left on the list.  Once
- * parsing is complete, the entire list is freed effectively "garbage
- * collecting" all nodes.
+ * not to free its child node also), it's simply left in the arena.  Once
+ * parsing is complete, the arena is reset effectively "garbage collecting" all
+ * nodes.
+ *
+ * Nodes that must outlive a parse, e.g., those of a `typedef`, are kept via
+ * c_ast_arena_keep() so they're not freed by subsequent resets.
  * @{
  */
 
@@ -538,20 +567,36 @@ struct c_udef_lit_ast {
 };
 
 /**
- * AST node for a parsed C/C++ declaration.
+ * Rarely used ("cold") data of an AST node.
+ *
+ * @remarks Most AST nodes are neither aligned, nor duplicated, nor parameter
+ * packs, so this data is kept out of line and allocated only for an AST node
+ * that needs it so that \ref c_ast itself fits in two cache lines.
+ *
+ * @sa c_ast::cold
  */
-struct c_ast {
+struct c_ast_cold {
   c_alignas_t     align;                ///< Alignment, if any.
-  unsigned        depth;                ///< How many `()` deep.
-  c_ast_t const  *dup_from_ast;         ///< AST duplicated from, if any.
+  c_ast_t const  *dup_from_ast;         ///< Root AST duplicated from, if any.
+  c_ast_id_t      unique_id;            ///< Unique ID (starts at 1), if any.
   bool            is_param_pack;        ///< Is this a parameter pack (`...`)?
+};
+
+/**
+ * AST node for a parsed C/C++ declaration.
+ *
+ * @remarks The members are ordered by how often they're accessed.  Those that
+ * are rarely used are in \ref cold.
+ */
+struct c_ast {
   c_ast_kind_t    kind;                 ///< AST kind.
+  unsigned        depth;                ///< How many `()` deep.
   c_loc_t         loc;                  ///< Source location.
   c_sname_t       sname;                ///< Scoped name, if any.
   c_type_t        type;                 ///< Type, if any.
   c_ast_t        *parent_ast;           ///< Parent AST node, if any.
   c_ast_t const  *param_of_ast;         ///< Parameter of this AST node, if any.
-  c_ast_id_t      unique_id;            ///< Unique ID (starts at 1).
+  c_ast_cold_t   *cold;                 ///< Cold data, if any.
 
   /**
    * Additional data for each \ref kind.
@@ -584,6 +629,37 @@ struct c_ast {
   };
 };
 
+/**
+ * An arena that AST nodes are allocated from.
+ *
+ * @remarks AST nodes are allocated from fixed-size chunks.  Chunks that are no
+ * longer used after a reset are kept for reuse.
+ *
+ * @sa c_ast_arena_cleanup()
+ * @sa c_ast_arena_keep()
+ * @sa c_ast_arena_reset()
+ */
+struct c_ast_arena {
+  c_ast_arena_chunk_t  *chunk;          ///< Current chunk, if any.
+  size_t                chunk_len;      ///< Nodes used in \a chunk.
+  c_ast_arena_chunk_t  *keep_chunk;     ///< Chunk of last kept node, if any.
+  size_t                keep_len;       ///< Nodes kept in \a keep_chunk.
+  c_ast_arena_chunk_t  *free_chunk;     ///< Chunks available for reuse.
+};
+
+/**
+ * AST node memory statistics.
+ *
+ * @sa c_ast_stats()
+ */
+struct c_ast_stats {
+  size_t  ast_count;                    ///< Number of AST nodes allocated.
+  size_t  cold_count;                   ///< Number of those having cold data.
+  size_t  ast_size;                     ///< Size of an AST node.
+  size_t  cold_size;                    ///< Size of an AST node's cold data.
+  size_t  inline_size;                  ///< Size with cold data inline.
+};
+
 /** @} */
 
 ////////// extern functions ///////////////////////////////////////////////////
@@ -594,13 +670,58 @@ struct c_ast {
  * @{
  */
 
+/**
+ * Gets the alignment of \a ast, if any.
+ *
+ * @param ast The AST to get the alignment of.
+ * @return Returns a pointer to said alignment or NULL if none.
+ *
+ * @sa c_ast_set_align()
+ */
+NODISCARD
+inline c_alignas_t const* c_ast_align( c_ast_t const *ast ) {
+  return ast->cold != NULL && ast->cold->align.kind != C_ALIGNAS_NONE ?
+    &ast->cold->align : NULL;
+}
+
+/**
+ * Cleans-up all memory associated with \a arena including all AST nodes
+ * allocated from it, even those kept, but does _not_ free \a arena itself.
+ *
+ * @param arena The \ref c_ast_arena to clean up.
+ *
+ * @sa c_ast_arena_reset()
+ */
+void c_ast_arena_cleanup( c_ast_arena_t *arena );
+
+/**
+ * Keeps all AST nodes allocated from \a arena so far so they're not freed by
+ * subsequent calls to c_ast_arena_reset().
+ *
+ * @param arena The \ref c_ast_arena to keep the AST nodes of.
+ *
+ * @sa c_ast_arena_reset()
+ */
+void c_ast_arena_keep( c_ast_arena_t *arena );
+
+/**
+ * Frees all AST nodes allocated from \a arena since the last call to
+ * c_ast_arena_keep(), if any.
+ *
+ * @param arena The \ref c_ast_arena to reset.
+ *
+ * @sa c_ast_arena_cleanup()
+ * @sa c_ast_arena_keep()
+ */
+void c_ast_arena_reset( c_ast_arena_t *arena );
+
 /**
  * Cleans up all AST data.
  *
  * @remarks Currently, this only checks that the number of AST nodes freed
  * equals the number allocated.
  *
- * @sa c_ast_free()
+ * @sa c_ast_arena_cleanup()
  * @sa c_ast_new()
  */
 void c_ast_cleanup_all( void );
@@ -609,14 +730,27 @@ void c_ast_cleanup_all( void );
  * Duplicates \a ast.
  *
  * @param ast The AST to duplicate.
- * @param dst_list The list to append the duplicated AST nodes onto.
+ * @param arena The \ref c_ast_arena to allocate the duplicated AST nodes from.
  * @return Returns the duplicated AST or NULL only if \a ast is NULL.
  *
- * @sa c_ast_free()
  * @sa c_ast_new()
  */
 NODISCARD
-c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *dst_list );
+c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_arena_t *arena );
+
+/**
+ * Gets the AST node \a ast was duplicated from, if any.
+ *
+ * @param ast The AST to get the AST node it was duplicated from.
+ * @return Returns said AST node or NULL if \a ast either wasn't duplicated or
+ * isn't the root of a duplicate.
+ *
+ * @sa c_ast_dup()
+ */
+NODISCARD
+inline c_ast_t const* c_ast_dup_from( c_ast_t const *ast ) {
+  return ast->cold != NULL ? ast->cold->dup_from_ast : NULL;
+}
 
 /**
  * Checks whether two ASTs are equal _except_ for their names.
@@ -631,22 +765,6 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *dst_list );
 NODISCARD
 bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast );
 
-/**
- * Frees all memory used by \a ast _including_ \a ast itself.
- *
- * @param ast The AST to free.  If NULL, does nothing.
- *
- * @note Even though \a ast invariably is part of a larger abstract syntax
- * tree, this function frees _only_ \a ast and _not_ any child AST node \a ast
- * may have.  Hence to free all AST nodes, they all be kept track of
- * independently via some other data structure, e.g., a \ref c_ast_list_t.
- *
- * @sa c_ast_cleanup_all()
- * @sa c_ast_dup()
- * @sa c_ast_new()
- */
-void c_ast_free( c_ast_t *ast );
-
 /**
  * Checks whether \a ast is an "orphan," that is:
  *
@@ -666,6 +784,20 @@ inline bool c_ast_is_orphan( c_ast_t const *ast ) {
           (ast->parent_ast == NULL || ast->parent_ast->parent.of_ast != ast);
 }
 
+/**
+ * Checks whether \a ast is a parameter pack.
+ *
+ * @param ast The AST to check.
+ * @return Returns `true` only if it is.
+ *
+ * @sa c_ast_move_parameter_pack()
+ * @sa c_ast_set_parameter_pack()
+ */
+NODISCARD
+inline bool c_ast_is_param_pack( c_ast_t const *ast ) {
+  return ast->cold != NULL && ast->cold->is_param_pack;
+}
+
 /**
  * Checks whether \a ast is a #K_ANY_PARENT.
  *
@@ -694,6 +826,154 @@ inline bool c_ast_is_referrer( c_ast_t const *ast ) {
   return ast != NULL && (ast->kind & K_ANY_REFERRER) != 0;
 }
 
+/**
+ * Gets the _i_th AST node of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to get the AST node of.
+ * @param i The index of the AST node to get; must be &lt; its length.
+ * @return Returns said AST node.
+ *
+ * @sa c_ast_list_front()
+ */
+NODISCARD
+inline c_ast_t* c_ast_list_at( c_ast_list_t const *list, size_t i ) {
+  assert( i < list->len );
+  return list->asts[i];
+}
+
+/**
+ * Gets the last AST node of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to get the last AST node of.
+ * @return Returns said AST node or NULL if \a list is empty.
+ *
+ * @sa c_ast_list_front()
+ * @sa c_ast_list_pop_back()
+ */
+NODISCARD
+inline c_ast_t* c_ast_list_back( c_ast_list_t const *list ) {
+  return list->len > 0 ? list->asts[ list->len - 1 ] : NULL;
+}
+
+/**
+ * Cleans-up all memory associated with \a list but does _not_ free either \a
+ * list itself nor the AST nodes on it since all AST nodes are cleaned-up by
+ * their arena.
+ *
+ * @param list A pointer to the \ref c_ast_list to clean up.  If NULL, does
+ * nothing; otherwise, reinitializes it upon completion.
+ *
+ * @sa c_ast_list_init()
+ */
+void c_ast_list_cleanup( c_ast_list_t *list );
+
+/**
+ * Checks whether \a list is empty.
+ *
+ * @param list A pointer to the \ref c_ast_list to check.
+ * @return Returns `true` only if \a list is empty.
+ */
+NODISCARD
+inline bool c_ast_list_empty( c_ast_list_t const *list ) {
+  return list->len == 0;
+}
+
+/**
+ * Gets the first AST node of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to get the first AST node of.
+ * @return Returns said AST node or NULL if \a list is empty.
+ *
+ * @sa c_ast_list_at()
+ * @sa c_ast_list_back()
+ */
+NODISCARD
+inline c_ast_t* c_ast_list_front( c_ast_list_t const *list ) {
+  return list->len > 0 ? list->asts[0] : NULL;
+}
+
+/**
+ * Initializes \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to initialize.
+ *
+ * @sa c_ast_list_cleanup()
+ * @sa c_ast_list_move()
+ */
+inline void c_ast_list_init( c_ast_list_t *list ) {
+  *list = (c_ast_list_t){ 0 };
+}
+
+/**
+ * Gets the length of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to get the length of.
+ * @return Returns said length.
+ */
+NODISCARD
+inline size_t c_ast_list_len( c_ast_list_t const *list ) {
+  return list->len;
+}
+
+/**
+ * Reinitializes \a list and returns its former value so that it can be "moved"
+ * into another list via assignment.
+ *
+ * @param list A pointer to the \ref c_ast_list to move.
+ * @return Returns the former value of \a list.
+ *
+ * @sa c_ast_list_init()
+ */
+NODISCARD
+inline c_ast_list_t c_ast_list_move( c_ast_list_t *list ) {
+  c_ast_list_t const rv_list = *list;
+  c_ast_list_init( list );
+  return rv_list;
+}
+
+/**
+ * Pops an AST node from the back of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to pop from.
+ * @return Returns the AST node from the back of \a list or NULL if \a list is
+ * empty.
+ *
+ * @sa c_ast_list_push_back()
+ */
+PJL_DISCARD
+inline c_ast_t* c_ast_list_pop_back( c_ast_list_t *list ) {
+  if ( list->len == 0 )
+    return NULL;
+  c_ast_t *const ast = list->asts[ --list->len ];
+  list->asts[ list->len ] = NULL;
+  return ast;
+}
+
+/**
+ * Pushes \a ast onto the back of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to push onto.
+ * @param ast The AST node to push.  It must not be NULL.
+ *
+ * @note This is amortized O(1).
+ *
+ * @sa c_ast_list_pop_back()
+ * @sa c_ast_list_push_front()
+ */
+void c_ast_list_push_back( c_ast_list_t *list, c_ast_t *ast );
+
+/**
+ * Pushes \a ast onto the front of \a list.
+ *
+ * @param list A pointer to the \ref c_ast_list to push onto.
+ * @param ast The AST node to push.  It must not be NULL.
+ *
+ * @note This is O(_n_), so c_ast_list_push_back() should be preferred.
+ *
+ * @sa c_ast_list_push_back()
+ */
+void c_ast_list_push_front( c_ast_list_t *list, c_ast_t *ast );
+
 /**
  * Sets that all AST nodes in \a param_ast_list are parameters of \a func_ast.
  *
@@ -707,22 +987,36 @@ inline bool c_ast_is_referrer( c_ast_t const *ast ) {
  */
 void c_ast_list_set_param_of( c_ast_list_t *param_ast_list, c_ast_t *func_ast );
 
+/**
+ * If \a from_ast is a parameter pack, "moves" the "parameter pack-ness" from
+ * it to \a to_ast.
+ *
+ * @param from_ast The AST to move the "parameter pack-ness" from.
+ * @param to_ast The AST to move the "parameter pack-ness" to.
+ * @return Returns `true` only if \a from_ast was a parameter pack.
+ *
+ * @sa c_ast_is_param_pack()
+ * @sa c_ast_set_parameter_pack()
+ */
+PJL_DISCARD
+bool c_ast_move_parameter_pack( c_ast_t *from_ast, c_ast_t *to_ast );
+
 /**
  * Creates a new AST node.
  *
  * @param kind The kind of AST to create.
  * @param depth How deep within `()` it is.
  * @param loc A pointer to the token location data.
- * @param dst_list The list to append the new AST node onto.
+ * @param arena The \ref c_ast_arena to allocate the new AST node from.
  * @return Returns a pointer to a new AST.
  *
+ * @sa c_ast_arena_reset()
  * @sa c_ast_cleanup_all()
  * @sa c_ast_dup()
- * @sa c_ast_free()
  */
 NODISCARD
 c_ast_t* c_ast_new( c_ast_kind_t kind, unsigned depth, c_loc_t const *loc,
-                    c_ast_list_t *dst_list );
+                    c_ast_arena_t *arena );
 
 /**
  * Convenience function for getting function-like parameters.
@@ -737,23 +1031,36 @@ c_ast_t* c_ast_new( c_ast_kind_t kind, unsigned depth, c_loc_t const *loc,
 NODISCARD
 inline c_param_t const* c_ast_params( c_ast_t const *ast ) {
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_FUNCTION_LIKE ) );
-  return ast->func.param_ast_list.head;
+  return ast->func.param_ast_list.asts;
 }
 
 /**
- * Sets \ref c_ast::is_param_pack "is_param_pack" of \a ast as well as of the
- * entire \ref "c_ast::dup_from_ast" "dup_from_ast" chain starting from \a ast
- * to `true`.
+ * Sets the alignment of \a ast.
+ *
+ * @param ast The AST to set the alignment of.
+ * @param align The alignment.  The AST takes ownership of any scoped name it
+ * has.
+ *
+ * @sa c_ast_align()
+ */
+void c_ast_set_align( c_ast_t *ast, c_alignas_t const *align );
+
+/**
+ * Sets \ref c_ast_cold::is_param_pack "is_param_pack" of \a ast as well as
+ * of the entire \ref c_ast_cold::dup_from_ast "dup_from_ast" chain starting
+ * from \a ast to `true`.
  *
  * @param ast The AST to start from.
+ *
+ * @sa c_ast_is_param_pack()
+ * @sa c_ast_move_parameter_pack()
  */
 void c_ast_set_parameter_pack( c_ast_t *ast );
 
 /**
  * Sets the two-way pointer links between parent/child AST nodes; additionally,
- * if \a child_ast has \ref c_ast::is_param_pack "is_param_pack" set and \a
- * parent_ast is not NULL, "moves" the "parameter pack-ness" from \a child_ast
- * to \a parent_ast.
+ * if \a child_ast is a parameter pack and \a parent_ast is not NULL, "moves"
+ * the "parameter pack-ness" from \a child_ast to \a parent_ast.
  *
  * @param child_ast The "child" AST node to set the parent of; may be NULL.  If
  * it already has a parent, it's overwritten.
@@ -763,6 +1070,27 @@ void c_ast_set_parameter_pack( c_ast_t *ast );
  */
 void c_ast_set_parent( c_ast_t *child_ast, c_ast_t *parent_ast );
 
+/**
+ * Gets AST node memory statistics.
+ *
+ * @param stats The \ref c_ast_stats to fill in.
+ */
+void c_ast_stats( c_ast_stats_t *stats );
+
+/**
+ * Gets the unique ID of \a ast.
+ *
+ * @param ast The AST to get the unique ID of.
+ * @return Returns said ID or 0 if \a ast doesn't have one.
+ *
+ * @note AST nodes have unique IDs only if they were created while
+ * #CDECL_DEBUG_OPT_AST_UNIQUE_ID was set in \ref opt_cdecl_debug.
+ */
+NODISCARD
+inline c_ast_id_t c_ast_unique_id( c_ast_t const *ast ) {
+  return ast->cold != NULL ? ast->cold->unique_id : 0;
+}
+
 /**
  * Does a pre-order traversal of an AST.
  *
@@ -790,7 +1118,20 @@ c_ast_t const* c_ast_visit( c_ast_t const *ast, c_ast_visit_dir_t dir,
  */
 NODISCARD
 inline c_ast_t const* c_capture_ast( c_capture_t const *capture ) {
-  return capture != NULL ? capture->data : NULL;
+  return capture != NULL ? *capture : NULL;
+}
+
+/**
+ * Gets the capture following \a capture.
+ *
+ * @param capture A pointer to a \ref c_capture_t.
+ * @return Returns a pointer to the next capture or NULL if none.
+ *
+ * @sa c_param_next()
+ */
+NODISCARD
+inline c_capture_t const* c_capture_next( c_capture_t const *capture ) {
+  return capture[1] != NULL ? capture + 1 : NULL;
 }
 
 /**
@@ -806,7 +1147,21 @@ inline c_ast_t const* c_capture_ast( c_capture_t const *capture ) {
  */
 NODISCARD
 inline c_ast_t const* c_param_ast( c_param_t const *param ) {
-  return param != NULL ? param->data : NULL;
+  return param != NULL ? *param : NULL;
+}
+
+/**
+ * Gets the parameter following \a param.
+ *
+ * @param param A pointer to a \ref c_param_t.
+ * @return Returns a pointer to the next parameter or NULL if none.
+ *
+ * @sa c_ast_params()
+ * @sa c_capture_next()
+ */
+NODISCARD
+inline c_param_t const* c_param_next( c_param_t const *param ) {
+  return param[1] != NULL ? param + 1 : NULL;
 }
 
 /** @} */
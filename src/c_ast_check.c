@@ -53,6 +53,7 @@
 #include <stddef.h>                     /* for NULL, size_t */
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>                     /* for qsort(3) */
 
 /// @endcond
 
@@ -99,7 +100,7 @@
  */
 #define error_kind_of_kind(AST1,AST2) BLOCK(                          \
   print_error( &(AST1)->loc, "%s of ", c_kind_name( (AST1)->kind ) ); \
-  print_ast_kind_aka( (AST2), stderr );                               \
+  print_ast_kind_aka( (AST2), EFILE );                                \
   EPUTS( " is illegal" ); )
 
 /**
@@ -239,7 +240,7 @@ static inline char const* plural_s( uint64_t n ) {
 ////////// local functions ////////////////////////////////////////////////////
 
 /**
- * Checks the \ref c_ast::align "align" of an AST for errors.
+ * Checks the alignment of an AST for errors.
  *
  * @param ast The AST to check.
  * @return Returns `true` only if all checks passed.
@@ -248,16 +249,17 @@ NODISCARD
 static bool c_ast_check_alignas( c_ast_t const *ast ) {
   assert( ast != NULL );
 
-  if ( ast->align.kind == C_ALIGNAS_NONE )
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL )
     return true;
 
   if ( c_tid_is_any( ast->type.stids, TS_typedef ) ) {
-    print_error( &ast->align.loc, "types can not be aligned\n" );
+    print_error( &align->loc, "types can not be aligned\n" );
     return false;
   }
 
   if ( c_ast_is_register( ast ) ) {
-    print_error( &ast->align.loc,
+    print_error( &align->loc,
       "\"%s\" can not be combined with \"register\"\n", alignas_name()
     );
     return false;
@@ -266,33 +268,33 @@ static bool c_ast_check_alignas( c_ast_t const *ast ) {
   c_ast_t const *const raw_ast = c_ast_untypedef( ast );
 
   if ( (raw_ast->kind & K_ANY_OBJECT) == 0 ) {
-    print_error( &ast->align.loc, "%s", "" );
-    print_ast_kind_aka( ast, stderr );
+    print_error( &align->loc, "%s", "" );
+    print_ast_kind_aka( ast, EFILE );
     EPUTS( " can not be aligned\n" );
     return false;
   }
 
   if ( (raw_ast->kind & K_ANY_BIT_FIELD) != 0 &&
         ast->bit_field.bit_width > 0 ) {
-    print_error( &ast->align.loc, "bit fields can not be aligned\n" );
+    print_error( &align->loc, "bit fields can not be aligned\n" );
     return false;
   }
 
   if ( (raw_ast->kind & K_CLASS_STRUCT_UNION) != 0 &&
        !OPT_LANG_IS( ALIGNED_CSUS ) ) {
-    print_error( &ast->align.loc, "%s", "" );
-    print_ast_kind_aka( ast, stderr );
+    print_error( &align->loc, "%s", "" );
+    print_ast_kind_aka( ast, EFILE );
     EPRINTF( " can not be aligned%s\n", C_LANG_WHICH( ALIGNED_CSUS ) );
     return false;
   }
 
-  switch ( ast->align.kind ) {
+  switch ( align->kind ) {
     case C_ALIGNAS_NONE:
       unreachable();
     case C_ALIGNAS_BYTES:
-      if ( !is_01_bit( ast->align.bytes ) ) {
-        print_error( &ast->align.loc,
-          "\"%u\": alignment must be a power of 2\n", ast->align.bytes
+      if ( !is_01_bit( align->bytes ) ) {
+        print_error( &align->loc,
+          "\"%u\": alignment must be a power of 2\n", align->bytes
         );
         return false;
       }
@@ -301,7 +303,7 @@ static bool c_ast_check_alignas( c_ast_t const *ast ) {
       // nothing to do
       break;
     case C_ALIGNAS_TYPE:
-      return c_ast_check( ast->align.type_ast );
+      return c_ast_check( align->type_ast );
   } // switch
 
   return true;
@@ -365,7 +367,7 @@ static bool c_ast_check_array( c_ast_t const *ast ) {
       // At this point, we know it's a VLA.
       if ( !c_ast_is_integral( size_param_ast ) ) {
         print_error( &ast->loc, "invalid array dimension type " );
-        print_ast_type_aka( size_param_ast, stderr );
+        print_ast_type_aka( size_param_ast, EFILE );
         EPUTS( "; must be integral\n" );
         return false;
       }
@@ -623,7 +625,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
       break;
     case K_FUNCTION:
       print_error( &to_ast->loc, "can not cast into " );
-      print_ast_kind_aka( to_ast, stderr );
+      print_ast_kind_aka( to_ast, EFILE );
       print_hint( "cast into pointer to function" );
       return false;
     default:
@@ -634,7 +636,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
     case C_CAST_CONST:
       if ( (raw_to_ast->kind & K_ANY_POINTER_OR_REFERENCE) == 0 ) {
         print_error( &to_ast->loc, "invalid const_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, EFILE );
         EPRINTF(
           "; must be a pointer, pointer to member, %s reference\n",
           OPT_LANG_IS( RVALUE_REFERENCES ) ? "reference, or rvalue" : "or"
@@ -647,7 +649,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
       if ( !c_ast_is_ptr_to_kind_any( raw_to_ast, K_CLASS_STRUCT_UNION ) &&
            !c_ast_is_ref_to_kind_any( raw_to_ast, K_CLASS_STRUCT_UNION ) ) {
         print_error( &to_ast->loc, "invalid dynamic_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, EFILE );
         EPUTS(
           "; must be a pointer or reference to a class, struct, or union\n"
         );
@@ -658,7 +660,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
     case C_CAST_REINTERPRET:
       if ( c_ast_is_builtin_any( to_ast, TB_void ) ) {
         print_error( &to_ast->loc, "invalid reinterpret_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, EFILE );
         EPUTC( '\n' );
         return false;
       }
@@ -838,7 +840,7 @@ static bool c_ast_check_enum( c_ast_t const *ast ) {
         "invalid %s underlying type ",
         c_tid_error( TB_enum )
       );
-      print_ast_type_aka( of_ast, stderr );
+      print_ast_type_aka( of_ast, EFILE );
       EPUTS( "; must be integral\n" );
       return false;
     }
@@ -1027,7 +1029,7 @@ static bool c_ast_check_func_default_delete( c_ast_t const *ast ) {
 
   switch ( ast->kind ) {
     case K_CONSTRUCTOR:
-      switch ( slist_len( &ast->ctor.param_ast_list ) ) {
+      switch ( c_ast_list_len( &ast->ctor.param_ast_list ) ) {
         case 0:                         // C()
           break;
         case 1:                         // C(C const&)
@@ -1060,7 +1062,7 @@ static bool c_ast_check_func_default_delete( c_ast_t const *ast ) {
           c_ast_t const *const ret_ast =
             c_ast_is_ref_to_tid_any( ast->oper.ret_ast, TB_ANY_CLASS );
           if ( ret_ast == NULL ||
-                slist_len( &ast->oper.param_ast_list ) != 1 ) {
+                c_ast_list_len( &ast->oper.param_ast_list ) != 1 ) {
             goto only_special;
           }
           param_ast = c_ast_is_ref_to_tid_any( param_ast, TB_ANY_CLASS );
@@ -1153,12 +1155,12 @@ static bool c_ast_check_func_main( c_ast_t const *ast ) {
   c_ast_t const *const ret_ast = ast->func.ret_ast;
   if ( !c_ast_is_builtin_any( ret_ast, TB_int ) ) {
     print_error( &ret_ast->loc, "invalid main() return type " );
-    print_ast_type_aka( ret_ast, stderr );
+    print_ast_type_aka( ret_ast, EFILE );
     EPRINTF( "; must be \"%s\" or a typedef thereof\n", c_tid_error( TB_int ) );
     return false;
   }
 
-  size_t const n_params = slist_len( &ast->func.param_ast_list );
+  size_t const n_params = c_ast_list_len( &ast->func.param_ast_list );
   c_param_t const *param = c_ast_params( ast );
   c_ast_t const *param_ast;
 
@@ -1194,7 +1196,7 @@ static bool c_ast_check_func_main( c_ast_t const *ast ) {
         print_error( &param_ast->loc,
           "invalid main() first parameter type "
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, EFILE );
         EPRINTF(
           "; must be \"%s\" or a typedef thereof\n",
           c_tid_error( TB_int )
@@ -1202,13 +1204,13 @@ static bool c_ast_check_func_main( c_ast_t const *ast ) {
         return false;
       }
 
-      param = param->next;
+      param = c_param_next( param );
       param_ast = c_param_ast( param );
       if ( !c_ast_check_func_main_char_ptr_param( param_ast ) )
         return false;
 
       if ( n_params == 3 ) {          // char *envp[]
-        param = param->next;
+        param = c_param_next( param );
         param_ast = c_param_ast( param );
         if ( !c_ast_check_func_main_char_ptr_param( param_ast ) )
           return false;
@@ -1243,7 +1245,7 @@ static bool c_ast_check_func_main_char_ptr_param( c_ast_t const *param_ast ) {
               &C_TYPE_LIT( TB_ANY, c_tid_compl( TS_const ), TA_ANY ),
               &C_TYPE_LIT_B( TB_char ) ) ) {
         print_error( &param_ast->loc, "invalid main() parameter type " );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, EFILE );
         EPUTS( "; must be " );
         if ( is_english_to_gibberish() ) {
           EPRINTF( "\"%s %s pointer to %s\"\n",
@@ -1262,7 +1264,7 @@ static bool c_ast_check_func_main_char_ptr_param( c_ast_t const *param_ast ) {
       break;
     default:                            // ???
       print_error( &param_ast->loc, "invalid main() parameter type " );
-      print_ast_type_aka( param_ast, stderr );
+      print_ast_type_aka( param_ast, EFILE );
       EPUTS( "; must be " );
       if ( is_english_to_gibberish() )
         EPRINTF( "\"array of pointer to %s\"\n", c_tid_error( TB_char ) );
@@ -1398,7 +1400,7 @@ static bool c_ast_check_func_params( c_ast_t const *ast ) {
           );
           return false;
         }
-        if ( param->next != NULL ) {
+        if ( c_param_next( param ) != NULL ) {
           print_error( &param_ast->loc, "\"...\" must be last\n" );
           return false;
         }
@@ -1478,34 +1480,76 @@ static bool c_ast_check_func_params_knr( c_ast_t const *ast ) {
   return c_ast_check_func_params_redef( ast );
 }
 
+/**
+ * Compares two parameters by name then by position.
+ *
+ * @param i_pparam A pointer to a pointer to the first \ref c_param_t.
+ * @param j_pparam A pointer to a pointer to the second \ref c_param_t.
+ * @return Returns a number less than 0, 0, or greater than 0 if \a i_pparam
+ * is less than, equal to, or greater than \a j_pparam, respectively.
+ */
+NODISCARD
+static int c_param_name_cmp( c_param_t const *const *i_pparam,
+                             c_param_t const *const *j_pparam ) {
+  c_param_t const *const i_param = *i_pparam;
+  c_param_t const *const j_param = *j_pparam;
+  int const cmp = c_sname_cmp( &(*i_param)->sname, &(*j_param)->sname );
+  return cmp != 0 ? cmp : (i_param > j_param) - (i_param < j_param);
+}
+
 /**
  * Checks function-like parameters for redefinition (duplicate names).
  *
  * @param ast The function-like AST to check.
  * @return Returns `true` only if all checks passed.
+ *
+ * @remarks Rather than comparing each parameter's name against those of all
+ * previous parameters that would be O(_n_^2), pointers to named parameters
+ * are sorted by name then position so duplicates are adjacent.
  */
 NODISCARD
 static bool c_ast_check_func_params_redef( c_ast_t const *ast ) {
   assert( ast != NULL );
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_FUNCTION_LIKE ) );
 
+  size_t const n_params = c_ast_list_len( &ast->func.param_ast_list );
+  if ( n_params < 2 )
+    return true;
+
+  c_param_t const **const named_params = MALLOC( c_param_t const*, n_params );
+  size_t n_named = 0;
   FOREACH_AST_FUNC_PARAM( param, ast ) {
-    c_ast_t const *const param_ast = c_param_ast( param );
-    if ( c_sname_empty( &param_ast->sname ) )
-      continue;
-    FOREACH_SLIST_NODE_UNTIL( prev_param, &ast->func.param_ast_list, param ) {
-      c_ast_t const *const prev_param_ast = c_param_ast( prev_param );
-      if ( c_sname_empty( &prev_param_ast->sname ) )
-        continue;
-      if ( c_sname_cmp( &param_ast->sname, &prev_param_ast->sname ) == 0 ) {
-        print_error( &param_ast->loc,
-          "\"%s\": redefinition of parameter\n",
-          c_sname_gibberish( &param_ast->sname )
-        );
-        return false;
-      }
-    } // for
+    if ( !c_sname_empty( &c_param_ast( param )->sname ) )
+      named_params[ n_named++ ] = param;
+  } // for
+
+  qsort(
+    named_params, n_named, sizeof named_params[0],
+    POINTER_CAST( qsort_cmp_fn_t, &c_param_name_cmp )
+  );
+
+  //
+  // For each run of parameters having the same name, the second one is the
+  // first redefinition of that name; report the earliest such one.
+  //
+  c_param_t const *redef_param = NULL;
+  for ( size_t i = 1; i < n_named; ++i ) {
+    if ( c_sname_cmp( &c_param_ast( named_params[ i - 1 ] )->sname,
+                      &c_param_ast( named_params[i] )->sname ) == 0 &&
+         (redef_param == NULL || named_params[i] < redef_param) ) {
+      redef_param = named_params[i];
+    }
   } // for
+  FREE( named_params );
+
+  if ( redef_param != NULL ) {
+    c_ast_t const *const param_ast = c_param_ast( redef_param );
+    print_error( &param_ast->loc,
+      "\"%s\": redefinition of parameter\n",
+      c_sname_gibberish( &param_ast->sname )
+    );
+    return false;
+  }
 
   return true;
 }
@@ -1550,7 +1594,7 @@ static bool c_ast_check_func_ret_type( c_ast_t const *ast ) {
     case K_CLASS_STRUCT_UNION:
       if ( !OPT_LANG_IS( CSU_RETURN_TYPES ) ) {
         print_error( &ret_ast->loc, "%s returning ", kind_name );
-        print_ast_kind_aka( ret_ast, stderr );
+        print_ast_kind_aka( ret_ast, EFILE );
         EPRINTF( " not supported%s\n", C_LANG_WHICH( CSU_RETURN_TYPES ) );
         return false;
       }
@@ -1558,7 +1602,7 @@ static bool c_ast_check_func_ret_type( c_ast_t const *ast ) {
 
     case K_FUNCTION:
       print_error( &ret_ast->loc, "%s returning ", kind_name );
-      print_ast_kind_aka( ret_ast, stderr );
+      print_ast_kind_aka( ret_ast, EFILE );
       EPUTS( " is illegal" );
       print_hint( "%s returning pointer to function", kind_name );
       return false;
@@ -1769,8 +1813,9 @@ static bool c_ast_check_name( c_ast_t const *ast ) {
   if ( !c_sname_check( &ast->sname, &ast->loc ) )
     return false;
 
-  if ( ast->align.kind == C_ALIGNAS_SNAME &&
-       !c_sname_check( &ast->align.sname, &ast->align.loc ) ) {
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align != NULL && align->kind == C_ALIGNAS_SNAME &&
+       !c_sname_check( &align->sname, &align->loc ) ) {
     return false;
   }
 
@@ -1868,7 +1913,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, EFILE );
         EPUTS( "; must be a pointer to struct, union, or class\n" );
         return false;
       }
@@ -1884,7 +1929,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, EFILE );
         EPRINTF( "; must be \"%s\"\n", c_tid_error( TB_void ) );
         return false;
       }
@@ -1901,7 +1946,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, EFILE );
         EPUTS( "; must be " );
         if ( is_english_to_gibberish() )
           EPUTS( "\"pointer to void\"\n" );
@@ -1948,7 +1993,7 @@ static bool c_ast_check_op_delete_params( c_ast_t const *ast ) {
       "invalid operator \"%s\" parameter type ",
       ast->oper.operator->literal
     );
-    print_ast_type_aka( param_ast, stderr );
+    print_ast_type_aka( param_ast, EFILE );
     EPUTS( "; must be a pointer to void, class, struct, or union\n" );
     return false;
   }
@@ -1995,7 +2040,7 @@ static bool c_ast_check_op_less_equal_greater_ret_type( c_ast_t const *ast ) {
   print_error( &ret_ast->loc,
     "invalid operator \"%s\" return type ", op->literal
   );
-  print_ast_type_aka( ret_ast, stderr );
+  print_ast_type_aka( ret_ast, EFILE );
   EPRINTF(
     "; must be "
     "\"%s\", "
@@ -2031,7 +2076,7 @@ static bool c_ast_check_op_minus_minus_plus_plus_params( c_ast_t const *ast ) {
     return true;
   c_func_member_t const member = c_ast_op_overload( ast );
   if ( member == C_FUNC_NON_MEMBER ) {
-    param = param->next;
+    param = c_param_next( param );
     if ( param == NULL )                // non-member prefix
       return true;
   }
@@ -2048,7 +2093,7 @@ static bool c_ast_check_op_minus_minus_plus_plus_params( c_ast_t const *ast ) {
       "invalid postfix %soperator \"%s\" parameter type ",
       c_ast_member_or_nonmember_str( ast ), op->literal
     );
-    print_ast_type_aka( param_ast, stderr );
+    print_ast_type_aka( param_ast, EFILE );
     EPRINTF(
       "; must be \"%s\" or a typedef thereof\n",
       c_tid_error( TB_int )
@@ -2083,7 +2128,7 @@ static bool c_ast_check_op_new_params( c_ast_t const *ast ) {
       "invalid operator \"%s\" parameter type ",
       ast->oper.operator->literal
     );
-    print_ast_type_aka( param_ast, stderr );
+    print_ast_type_aka( param_ast, EFILE );
     EPUTS( "; must be \"std::size_t\" (or equivalent)\n" );
     return false;
   }
@@ -2143,7 +2188,7 @@ static bool c_ast_check_op_relational_default( c_ast_t const *ast ) {
         param1_is_ref_to_class = true;
       }
 
-      c_ast_t const *param2_ast = c_param_ast( param->next );
+      c_ast_t const *param2_ast = c_param_ast( c_param_next( param ) );
       param2_ast = param1_is_ref_to_class ?
         c_ast_is_ref_to_type_any( param2_ast, &T_ANY_const_CLASS ) :
         c_ast_is_tid_any( param2_ast, TB_ANY_CLASS );
@@ -2197,7 +2242,7 @@ static bool c_ast_check_op_relational_default( c_ast_t const *ast ) {
         "invalid operator \"%s\" return type ",
         op->literal
       );
-      print_ast_type_aka( ret_ast, stderr );
+      print_ast_type_aka( ret_ast, EFILE );
       EPRINTF(
         "; must be \"%s\" or a typedef thereof\n",
         c_tid_error( TB_bool )
@@ -2340,7 +2385,7 @@ static bool c_ast_check_oper_num_params( c_ast_t const *ast ) {
   unsigned params_min, params_max;
   c_ast_op_params_min_max( ast, &params_min, &params_max );
 
-  size_t const n_params = slist_len( &ast->oper.param_ast_list );
+  size_t const n_params = c_ast_list_len( &ast->oper.param_ast_list );
   if ( n_params < params_min ) {
     if ( params_min == params_max )
       goto must_have_exactly_n_params;
@@ -2416,7 +2461,7 @@ static bool c_ast_check_oper_params( c_ast_t const *ast ) {
 NODISCARD
 static bool c_ast_check_param_pack( c_ast_t const *ast ) {
   assert( ast != NULL );
-  assert( ast->is_param_pack );
+  assert( c_ast_is_param_pack( ast ) );
 
   if ( c_ast_parent_is_kind_any( ast, K_ANY_FUNCTION_LIKE ) ) {
     print_error( &ast->loc,
@@ -2483,7 +2528,7 @@ static bool c_ast_check_pointer( c_ast_t const *ast ) {
     case K_REFERENCE:
     case K_RVALUE_REFERENCE:
       print_error( &ast->loc, "%s to ", c_kind_name( ast->kind ) );
-      print_ast_kind_aka( to_ast, stderr );
+      print_ast_kind_aka( to_ast, EFILE );
       EPUTS( " is illegal" );
       if ( raw_to_ast == to_ast ) {
         if ( is_english_to_gibberish() )
@@ -2758,7 +2803,7 @@ static bool c_ast_check_udef_conv( c_ast_t const *ast ) {
     print_error( &to_ast->loc,
       "user-defined conversion operator return type "
     );
-    print_ast_type_aka( to_ast, stderr );
+    print_ast_type_aka( to_ast, EFILE );
     EPUTS( " can not be an array" );
     print_hint( "pointer to array" );
     return false;
@@ -2786,7 +2831,7 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
   c_ast_t const *raw_param_ast = c_ast_untypedef( param_ast );
   c_ast_t const *ptr_to_ast = NULL;
 
-  size_t const n_params = slist_len( &ast->udef_lit.param_ast_list );
+  size_t const n_params = c_ast_list_len( &ast->udef_lit.param_ast_list );
   switch ( n_params ) {
     case 0:
       // the grammar requires at least one parameter
@@ -2808,7 +2853,7 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
             print_error( &param_ast->loc,
               "invalid user-defined literal parameter type "
             );
-            print_ast_type_aka( param_ast, stderr );
+            print_ast_type_aka( param_ast, EFILE );
             EPRINTF( "; must be \"%s\", ",
                      c_tid_error( TB_unsigned | TB_long | TB_long_long ) );
             EPRINTF( "\"%s\", ", c_tid_error( TB_long | TB_double ) );
@@ -2836,26 +2881,26 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
         print_error( &param_ast->loc,
           "invalid user-defined literal parameter type "
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, EFILE );
         EPRINTF( "; must be "
           "const (char%s|char16_t|char32_t|wchar_t)*\n",
           OPT_LANG_IS( char8_t ) ? "|char8_t" : ""
         );
         return false;
       }
-      param_ast = c_param_ast( param->next );
+      param_ast = c_param_ast( c_param_next( param ) );
       if ( param_ast == NULL || !c_ast_is_size_t( param_ast ) ) {
         print_error( &param_ast->loc,
           "invalid user-defined literal parameter type "
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, EFILE );
         EPUTS( "; must be \"std::size_t\" (or equivalent)\n" );
         return false;
       }
       break;
 
     default:
-      param_ast = c_param_ast( param->next->next );
+      param_ast = c_param_ast( c_param_next( c_param_next( param ) ) );
       print_error( &param_ast->loc,
         "user-defined literal may have at most 2 parameters\n"
       );
@@ -3074,7 +3119,8 @@ static bool c_ast_visitor_error( c_ast_t const *ast, user_data_t user_data ) {
       // underlying type, but instead a synonym "for" it.  Hence, we have to
       // recurse into it manually.
       //
-      c_ast_t const temp_ast = c_ast_sub_typedef( ast );
+      c_ast_cold_t temp_cold;
+      c_ast_t const temp_ast = c_ast_sub_typedef( ast, &temp_cold );
       user_data.pcv = &(c_ast_check_state_t){ .tdef_ast = ast };
       return c_ast_visitor_error( &temp_ast, user_data );
 
@@ -3150,7 +3196,7 @@ static bool c_ast_visitor_type( c_ast_t const *ast, user_data_t user_data ) {
     return VISITOR_ERROR_FOUND;
   }
 
-  if ( ast->is_param_pack && !c_ast_check_param_pack( ast ) )
+  if ( c_ast_is_param_pack( ast ) && !c_ast_check_param_pack( ast ) )
     return VISITOR_ERROR_FOUND;
 
   if ( (ast->kind & K_ANY_FUNCTION_LIKE) != 0 ) {
@@ -3317,11 +3363,11 @@ bool c_ast_check( c_ast_t const *ast ) {
 bool c_ast_list_check( c_ast_list_t const *ast_list ) {
   assert( ast_list != NULL );
 
-  if ( slist_empty( ast_list ) )
+  if ( c_ast_list_empty( ast_list ) )
     return true;                        // LCOV_EXCL_LINE
 
-  c_ast_t const *const first_ast = slist_front( ast_list );
-  if ( slist_len( ast_list ) == 1 )
+  c_ast_t const *const first_ast = c_ast_list_front( ast_list );
+  if ( c_ast_list_len( ast_list ) == 1 )
     return c_ast_check( first_ast );
 
   if ( first_ast->type.btids == TB_auto &&
@@ -3334,9 +3380,9 @@ bool c_ast_list_check( c_ast_list_t const *ast_list ) {
     return false;
   }
 
-  FOREACH_SLIST_NODE( ast_node, ast_list ) {
-    c_ast_t const *const ast = ast_node->data;
-    if ( ast->is_param_pack ) {
+  FOREACH_AST_LIST( ast_elt, ast_list ) {
+    c_ast_t const *const ast = *ast_elt;
+    if ( c_ast_is_param_pack( ast ) ) {
       print_error( &first_ast->loc,
         "can not use parameter pack in multiple declaration\n"
       );
@@ -3344,8 +3390,8 @@ bool c_ast_list_check( c_ast_list_t const *ast_list ) {
     }
   } // for
 
-  FOREACH_SLIST_NODE( ast_node, ast_list ) {
-    c_ast_t const *const ast = ast_node->data;
+  FOREACH_AST_LIST( ast_elt, ast_list ) {
+    c_ast_t const *const ast = *ast_elt;
     //
     // Ensure that a name is not used more than once in the same declaration in
     // C++ or with different types in C.  (In C, more than once with the same
@@ -3355,8 +3401,8 @@ bool c_ast_list_check( c_ast_list_t const *ast_list ) {
     //      int j, *j;                  // error (different types)
     //
     if ( !c_sname_empty( &ast->sname ) ) {
-      FOREACH_SLIST_NODE_UNTIL( prev_ast_node, ast_list, ast_node ) {
-        c_ast_t const *const prev_ast = prev_ast_node->data;
+      FOREACH_AST_LIST_UNTIL( prev_ast_elt, ast_list, ast_elt ) {
+        c_ast_t const *const prev_ast = *prev_ast_elt;
         if ( c_sname_empty( &prev_ast->sname ) )
           continue;
         if ( c_sname_cmp( &ast->sname, &prev_ast->sname ) != 0 )
@@ -0,0 +1,690 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/c_ast_save.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for saving an AST to a string and loading it back again.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_ast_save.h"
+#include "bit_util.h"
+#include "c_ast.h"
+#include "c_kind.h"
+#include "c_operator.h"
+#include "c_sname.h"
+#include "c_type.h"
+#include "c_typedef.h"
+#include "gibberish.h"
+#include "slist.h"
+#include "strbuf.h"
+#include "types.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>                   /* for PRIx64 */
+#include <limits.h>                     /* for UINT_MAX */
+#include <stdbool.h>
+#include <stdint.h>                     /* for uint64_t */
+#include <stdlib.h>                     /* for strtoull(3) */
+#include <string.h>
+
+/// @endcond
+
+/**
+ * @addtogroup ast-save-group
+ * @{
+ */
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Loads the next token of \a *ps as a name.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the name.
+ * @param rv_len A pointer to receive the length of the name.
+ * @return Returns a pointer to the name within \a *ps (which is _not_ null-
+ * terminated) or NULL if there is no name.
+ *
+ * @sa save_name()
+ */
+NODISCARD
+static char const* load_name( char const **ps, size_t *rv_len ) {
+  assert( ps != NULL );
+  assert( rv_len != NULL );
+
+  char const *const name = *ps;
+  char const *const end = strchr( name, ' ' );
+  if ( end == NULL || end == name )
+    return NULL;
+  *rv_len = STATIC_CAST( size_t, end - name );
+  *ps = end + 1;
+  return name;
+}
+
+/**
+ * Loads the next token of \a *ps as a number.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the number.
+ * @param max The maximum value the number may have.
+ * @param rv_n A pointer to receive the number.
+ * @return Returns `true` only if a number no greater than \a max was loaded.
+ *
+ * @sa save_num()
+ */
+NODISCARD
+static bool load_num( char const **ps, uint64_t max, uint64_t *rv_n ) {
+  assert( ps != NULL );
+  assert( rv_n != NULL );
+
+  if ( !isxdigit( STATIC_CAST( unsigned char, **ps ) ) )
+    return false;
+  char *end;
+  errno = 0;
+  unsigned long long const n = strtoull( *ps, &end, 16 );
+  if ( errno != 0 || *end != ' ' || n > max )
+    return false;
+  *ps = end + 1;
+  *rv_n = n;
+  return true;
+}
+
+/**
+ * Loads a scoped name.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the scoped name.
+ * @param sname The scoped name to append the scopes onto.  On failure, scopes
+ * loaded so far are left in it.
+ * @return Returns `true` only if the scoped name was loaded.
+ *
+ * @sa save_sname()
+ */
+NODISCARD
+static bool load_sname( char const **ps, c_sname_t *sname ) {
+  assert( ps != NULL );
+  assert( sname != NULL );
+
+  uint64_t count;
+  if ( !load_num( ps, UINT_MAX, &count ) )
+    return false;
+  for ( ; count > 0; --count ) {
+    size_t name_len;
+    char const *const name = load_name( ps, &name_len );
+    if ( name == NULL )
+      return false;
+    c_sname_push_back_namen( sname, name, name_len );
+    c_type_t *const type = &c_sname_local_data( sname )->type;
+    if ( !load_num( ps, UINT64_MAX, &type->btids ) ||
+         !load_num( ps, UINT64_MAX, &type->stids ) ||
+         !load_num( ps, UINT64_MAX, &type->atids ) ) {
+      return false;
+    }
+  } // for
+  return true;
+}
+
+/**
+ * Loads the type a #K_TYPEDEF AST node is for.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the scoped name of the type.
+ * @return Returns the AST of the type or NULL if none.
+ *
+ * @sa save_tdef_for()
+ */
+NODISCARD
+static c_ast_t const* load_tdef_for( char const **ps ) {
+  assert( ps != NULL );
+
+  c_ast_t const *for_ast = NULL;
+  c_sname_t sname;
+  c_sname_init( &sname );
+
+  if ( load_sname( ps, &sname ) && !c_sname_empty( &sname ) ) {
+    c_typedef_t const *tdef = c_typedef_find_sname( &sname );
+    if ( tdef == NULL ) {
+      char const *const name = c_sname_gibberish( &sname );
+      c_typedefs_define_lazy( name, strlen( name ) );
+      tdef = c_typedef_find_sname( &sname );
+    }
+    if ( tdef != NULL )
+      for_ast = tdef->ast;
+  }
+
+  c_sname_cleanup( &sname );
+  return for_ast;
+}
+
+/**
+ * Loads a list of ASTs.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the list.
+ * @param list The list to append the ASTs onto.
+ * @param param_of_ast The function-like AST that the ASTs are parameters of or
+ * NULL if they're not parameters.
+ * @param arena The \ref c_ast_arena to allocate the AST nodes from.
+ * @return Returns `true` only if the list was loaded.
+ *
+ * @sa save_list()
+ */
+NODISCARD
+static bool load_list( char const **ps, c_ast_list_t *list,
+                       c_ast_t *param_of_ast, c_ast_arena_t *arena ) {
+  assert( ps != NULL );
+  assert( list != NULL );
+
+  uint64_t len;
+  if ( !load_num( ps, UINT_MAX, &len ) )
+    return false;
+  for ( ; len > 0; --len ) {
+    c_ast_t *const ast = c_ast_load( ps, arena );
+    if ( ast == NULL )
+      return false;
+    c_ast_list_push_back( list, ast );
+  } // for
+
+  if ( param_of_ast != NULL )
+    c_ast_list_set_param_of( list, param_of_ast );
+  return true;
+}
+
+/**
+ * Loads a single AST node, but not its child node, if any.
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the node.
+ * @param arena The \ref c_ast_arena to allocate the AST node from.
+ * @return Returns the loaded AST node or NULL if none.
+ *
+ * @sa save_node()
+ */
+NODISCARD
+static c_ast_t* load_node( char const **ps, c_ast_arena_t *arena ) {
+  assert( ps != NULL );
+  assert( arena != NULL );
+
+  uint64_t kind, depth;
+  if ( !load_num( ps, K_USER_DEFINED_LIT, &kind ) || !is_1_bit( kind ) ||
+       !load_num( ps, UINT_MAX, &depth ) ) {
+    return NULL;
+  }
+
+  c_ast_t *const ast = c_ast_new(
+    STATIC_CAST( c_ast_kind_t, kind ), STATIC_CAST( unsigned, depth ),
+    &(c_loc_t){ 0 }, arena
+  );
+
+  uint64_t n;
+  if ( !load_sname( ps, &ast->sname ) ||
+       !load_num( ps, UINT64_MAX, &ast->type.btids ) ||
+       !load_num( ps, UINT64_MAX, &ast->type.stids ) ||
+       !load_num( ps, UINT64_MAX, &ast->type.atids ) ||
+       !load_num( ps, C_ALIGNAS_TYPE, &n ) ) {
+    return NULL;
+  }
+
+  c_alignas_t align = { .kind = STATIC_CAST( c_alignas_kind_t, n ) };
+  switch ( align.kind ) {
+    case C_ALIGNAS_NONE:
+      break;
+    case C_ALIGNAS_BYTES:
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      align.bytes = STATIC_CAST( unsigned, n );
+      break;
+    case C_ALIGNAS_SNAME:
+      c_sname_init( &align.sname );
+      if ( !load_sname( ps, &align.sname ) ) {
+        c_sname_cleanup( &align.sname );
+        return NULL;
+      }
+      break;
+    case C_ALIGNAS_TYPE:
+      align.type_ast = c_ast_load( ps, arena );
+      if ( align.type_ast == NULL )
+        return NULL;
+      break;
+  } // switch
+  if ( align.kind != C_ALIGNAS_NONE )
+    c_ast_set_align( ast, &align );
+
+  if ( !load_num( ps, 1, &n ) )
+    return NULL;
+  if ( n != 0 )
+    c_ast_set_parameter_pack( ast );
+
+  switch ( ast->kind ) {
+    case K_ARRAY:
+      if ( !load_num( ps, C_ARRAY_SIZE_VLA, &n ) )
+        return NULL;
+      ast->array.kind = STATIC_CAST( c_array_kind_t, n );
+      switch ( ast->array.kind ) {
+        case C_ARRAY_SIZE_INT:
+          if ( !load_num( ps, UINT_MAX, &n ) )
+            return NULL;
+          ast->array.size_int = STATIC_CAST( unsigned, n );
+          break;
+        case C_ARRAY_SIZE_NAME:;
+          size_t name_len;
+          char const *const name = load_name( ps, &name_len );
+          if ( name == NULL )
+            return NULL;
+          ast->array.size_name = check_strndup( name, name_len );
+          break;
+        case C_ARRAY_SIZE_NONE:
+        case C_ARRAY_SIZE_VLA:
+          // nothing to do
+          break;
+      } // switch
+      break;
+
+    case K_BUILTIN:
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      ast->builtin.BitInt.width = STATIC_CAST( unsigned, n );
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      ast->builtin.bit_width = STATIC_CAST( unsigned, n );
+      break;
+
+    case K_TYPEDEF:
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      ast->tdef.bit_width = STATIC_CAST( unsigned, n );
+      ast->tdef.for_ast = load_tdef_for( ps );
+      if ( ast->tdef.for_ast == NULL )
+        return NULL;
+      break;
+
+    case K_CAPTURE:
+      if ( !load_num( ps, C_CAPTURE_STAR_THIS, &n ) )
+        return NULL;
+      ast->capture.kind = STATIC_CAST( c_capture_kind_t, n );
+      break;
+
+    case K_CAST:
+      if ( !load_num( ps, C_CAST_STATIC, &n ) )
+        return NULL;
+      ast->cast.kind = STATIC_CAST( c_cast_kind_t, n );
+      break;
+
+    case K_ENUM:
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      ast->enum_.bit_width = STATIC_CAST( unsigned, n );
+      FALLTHROUGH;
+    case K_CLASS_STRUCT_UNION:
+    case K_CONCEPT:
+    case K_NAME:
+    case K_POINTER_TO_MEMBER:
+      if ( !load_sname( ps, &ast->name.sname ) )
+        return NULL;
+      break;
+
+    case K_OPERATOR:
+      if ( !load_num( ps, C_OP_TILDE, &n ) || n == C_OP_NONE )
+        return NULL;
+      ast->oper.operator = c_op_get( STATIC_CAST( c_op_id_t, n ) );
+      FALLTHROUGH;
+    case K_FUNCTION:
+      if ( !load_num( ps, C_FUNC_NON_MEMBER, &n ) )
+        return NULL;
+      ast->func.member = STATIC_CAST( c_func_member_t, n );
+      FALLTHROUGH;
+    case K_APPLE_BLOCK:
+    case K_CONSTRUCTOR:
+    case K_USER_DEFINED_LIT:
+      if ( !load_list( ps, &ast->func.param_ast_list, ast, arena ) )
+        return NULL;
+      break;
+
+    case K_LAMBDA:
+      if ( !load_list( ps, &ast->func.param_ast_list, ast, arena ) ||
+           !load_list( ps, &ast->lambda.capture_ast_list, NULL, arena ) ) {
+        return NULL;
+      }
+      break;
+
+    case K_STRUCTURED_BINDING:
+      if ( !load_num( ps, UINT_MAX, &n ) )
+        return NULL;
+      for ( ; n > 0; --n ) {
+        c_sname_t *const sname = MALLOC( c_sname_t, 1 );
+        c_sname_init( sname );
+        slist_push_back( &ast->struct_bind.sname_list, sname );
+        if ( !load_sname( ps, sname ) )
+          return NULL;
+      } // for
+      break;
+
+    case K_DESTRUCTOR:
+    case K_PLACEHOLDER:
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+    case K_USER_DEFINED_CONV:
+    case K_VARIADIC:
+      // nothing to do
+      break;
+  } // switch
+
+  return ast;
+}
+
+/**
+ * Saves \a name onto \a sbuf.
+ *
+ * @param name The name to save.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if \a name is neither empty nor has whitespace.
+ *
+ * @sa load_name()
+ */
+NODISCARD
+static bool save_name( char const *name, strbuf_t *sbuf ) {
+  assert( name != NULL );
+  assert( sbuf != NULL );
+
+  if ( name[0] == '\0' || strpbrk( name, " \t\n" ) != NULL )
+    return false;
+  strbuf_puts( sbuf, name );
+  strbuf_putc( sbuf, ' ' );
+  return true;
+}
+
+/**
+ * Saves \a n onto \a sbuf.
+ *
+ * @param n The number to save.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa load_num()
+ */
+static void save_num( uint64_t n, strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+  strbuf_printf( sbuf, "%" PRIx64 " ", n );
+}
+
+/**
+ * Saves \a type onto \a sbuf.
+ *
+ * @param type The type to save.
+ * @param sbuf The \ref strbuf to append onto.
+ */
+static void save_type( c_type_t const *type, strbuf_t *sbuf ) {
+  assert( type != NULL );
+  save_num( type->btids, sbuf );
+  save_num( type->stids, sbuf );
+  save_num( type->atids, sbuf );
+}
+
+/**
+ * Saves \a sname onto \a sbuf.
+ *
+ * @param sname The scoped name to save.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if \a sname was saved.
+ *
+ * @sa load_sname()
+ */
+NODISCARD
+static bool save_sname( c_sname_t const *sname, strbuf_t *sbuf ) {
+  assert( sname != NULL );
+
+  save_num( c_sname_count( sname ), sbuf );
+  FOREACH_SNAME_SCOPE( scope, sname ) {
+    c_scope_data_t const *const data = c_scope_data( scope );
+    if ( !save_name( data->name, sbuf ) )
+      return false;
+    save_type( &data->type, sbuf );
+  } // for
+  return true;
+}
+
+/**
+ * Saves the scoped name of the type a #K_TYPEDEF AST node is for.
+ *
+ * @param for_ast The AST of the type.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if \a for_ast is the AST of a type that's
+ * currently defined.
+ *
+ * @sa load_tdef_for()
+ */
+NODISCARD
+static bool save_tdef_for( c_ast_t const *for_ast, strbuf_t *sbuf ) {
+  if ( for_ast == NULL )
+    return false;
+  c_typedef_t const *const tdef = c_typedef_find_sname( &for_ast->sname );
+  return  tdef != NULL && tdef->ast == for_ast &&
+          save_sname( &for_ast->sname, sbuf );
+}
+
+/**
+ * Saves \a list onto \a sbuf.
+ *
+ * @param list The list of ASTs to save.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if every AST in \a list was saved.
+ *
+ * @sa load_list()
+ */
+NODISCARD
+static bool save_list( c_ast_list_t const *list, strbuf_t *sbuf ) {
+  assert( list != NULL );
+
+  save_num( list->len, sbuf );
+  FOREACH_AST_LIST( ast, list ) {
+    if ( !c_ast_save( *ast, sbuf ) )
+      return false;
+  } // for
+  return true;
+}
+
+/**
+ * Saves a single AST node, but not its child node, if any, onto \a sbuf.
+ *
+ * @param ast The AST node to save.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if \a ast was saved.
+ *
+ * @sa load_node()
+ */
+NODISCARD
+static bool save_node( c_ast_t const *ast, strbuf_t *sbuf ) {
+  assert( ast != NULL );
+
+  save_num( ast->kind, sbuf );
+  save_num( ast->depth, sbuf );
+  if ( !save_sname( &ast->sname, sbuf ) )
+    return false;
+  save_type( &ast->type, sbuf );
+
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL ) {
+    save_num( C_ALIGNAS_NONE, sbuf );
+  }
+  else {
+    save_num( align->kind, sbuf );
+    switch ( align->kind ) {
+      case C_ALIGNAS_NONE:
+        break;                          // LCOV_EXCL_LINE
+      case C_ALIGNAS_BYTES:
+        save_num( align->bytes, sbuf );
+        break;
+      case C_ALIGNAS_SNAME:
+        if ( !save_sname( &align->sname, sbuf ) )
+          return false;
+        break;
+      case C_ALIGNAS_TYPE:
+        if ( !c_ast_save( align->type_ast, sbuf ) )
+          return false;
+        break;
+    } // switch
+  }
+
+  save_num( c_ast_is_param_pack( ast ), sbuf );
+
+  switch ( ast->kind ) {
+    case K_ARRAY:
+      save_num( ast->array.kind, sbuf );
+      switch ( ast->array.kind ) {
+        case C_ARRAY_SIZE_INT:
+          save_num( ast->array.size_int, sbuf );
+          break;
+        case C_ARRAY_SIZE_NAME:
+          return save_name( ast->array.size_name, sbuf );
+        case C_ARRAY_SIZE_NONE:
+        case C_ARRAY_SIZE_VLA:
+          // nothing to do
+          break;
+      } // switch
+      break;
+
+    case K_BUILTIN:
+      save_num( ast->builtin.BitInt.width, sbuf );
+      save_num( ast->builtin.bit_width, sbuf );
+      break;
+
+    case K_TYPEDEF:
+      save_num( ast->tdef.bit_width, sbuf );
+      return save_tdef_for( ast->tdef.for_ast, sbuf );
+
+    case K_CAPTURE:
+      save_num( ast->capture.kind, sbuf );
+      break;
+
+    case K_CAST:
+      save_num( ast->cast.kind, sbuf );
+      break;
+
+    case K_ENUM:
+      save_num( ast->enum_.bit_width, sbuf );
+      FALLTHROUGH;
+    case K_CLASS_STRUCT_UNION:
+    case K_CONCEPT:
+    case K_NAME:
+    case K_POINTER_TO_MEMBER:
+      return save_sname( &ast->name.sname, sbuf );
+
+    case K_OPERATOR:
+      if ( ast->oper.operator == NULL )
+        return false;
+      save_num( ast->oper.operator->op_id, sbuf );
+      FALLTHROUGH;
+    case K_FUNCTION:
+      save_num( ast->func.member, sbuf );
+      FALLTHROUGH;
+    case K_APPLE_BLOCK:
+    case K_CONSTRUCTOR:
+    case K_USER_DEFINED_LIT:
+      return save_list( &ast->func.param_ast_list, sbuf );
+
+    case K_LAMBDA:
+      return  save_list( &ast->func.param_ast_list, sbuf ) &&
+              save_list( &ast->lambda.capture_ast_list, sbuf );
+
+    case K_STRUCTURED_BINDING:
+      save_num( slist_len( &ast->struct_bind.sname_list ), sbuf );
+      FOREACH_SLIST_NODE( sname_node, &ast->struct_bind.sname_list ) {
+        if ( !save_sname( sname_node->data, sbuf ) )
+          return false;
+      } // for
+      break;
+
+    case K_DESTRUCTOR:
+    case K_PLACEHOLDER:
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+    case K_USER_DEFINED_CONV:
+    case K_VARIADIC:
+      // nothing to do
+      break;
+  } // switch
+
+  return true;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+c_ast_t* c_ast_load( char const **ps, c_ast_arena_t *arena ) {
+  assert( ps != NULL );
+  assert( *ps != NULL );
+  assert( arena != NULL );
+
+  c_ast_t *const root_ast = load_node( ps, arena );
+
+  //
+  // Load the chain of children iteratively rather than recursively since it
+  // can be arbitrarily long.
+  //
+  for ( c_ast_t *ast = root_ast; c_ast_is_parent( ast ); ) {
+    uint64_t has_child;
+    if ( !load_num( ps, 1, &has_child ) )
+      return NULL;
+    if ( has_child == 0 )
+      break;
+    c_ast_t *const child_ast = load_node( ps, arena );
+    if ( child_ast == NULL )
+      return NULL;
+    c_ast_set_parent( child_ast, ast );
+    ast = child_ast;
+  } // for
+
+  return root_ast;
+}
+
+bool c_ast_save( c_ast_t const *ast, strbuf_t *sbuf ) {
+  assert( ast != NULL );
+  assert( sbuf != NULL );
+
+  //
+  // Save the chain of children iteratively rather than recursively since it
+  // can be arbitrarily long.
+  //
+  for ( ;; ast = ast->parent.of_ast ) {
+    if ( !save_node( ast, sbuf ) )
+      return false;
+    if ( !c_ast_is_parent( ast ) )
+      break;
+    save_num( ast->parent.of_ast != NULL, sbuf );
+    if ( ast->parent.of_ast == NULL )
+      break;
+  } // for
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,102 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/c_ast_save.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_c_ast_save_H
+#define cdecl_c_ast_save_H
+
+/**
+ * @file
+ * Declares functions for saving an AST to a string and loading it back again.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+
+/// @endcond
+
+/**
+ * @defgroup ast-save-group Saving ASTs
+ * Functions for saving an AST to a string and loading it back again without
+ * parsing a declaration.
+ *
+ * @remarks
+ * @parblock
+ * A saved AST is a sequence of tokens each followed by a space.  A token is
+ * either a number in hexadecimal or a name.  An AST is saved as each node of
+ * its chain of children in turn where each node is saved as its kind, depth,
+ * scoped name, type, alignment, whether it's a parameter pack, then whatever
+ * else that kind of node has.  A parent node is followed by whether it has a
+ * child node.
+ *
+ * A scoped name is saved as its number of scopes followed by each scope's name
+ * and type.  A list of AST nodes (for example, function parameters) is saved
+ * as its length followed by each AST.
+ *
+ * Since a #K_TYPEDEF node refers to the AST of an existing type, only the
+ * scoped name of that type is saved.
+ * @endparblock
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Loads an AST previously saved by c_ast_save().
+ *
+ * @param ps A pointer to the string to load from.  On success, it's advanced
+ * past the saved AST.
+ * @param arena The \ref c_ast_arena to allocate the AST nodes from.
+ * @return Returns the loaded AST or NULL if either the string isn't a saved
+ * AST or a #K_TYPEDEF node refers to a type that's not defined.  On failure,
+ * AST nodes allocated so far are left in \a arena.
+ *
+ * @sa c_ast_save()
+ */
+NODISCARD
+c_ast_t* c_ast_load( char const **ps, c_ast_arena_t *arena );
+
+/**
+ * Saves \a ast onto \a sbuf.
+ *
+ * @param ast The AST to save.
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if \a ast could be saved, i.e., every name in
+ * it has no whitespace and every #K_TYPEDEF node in it refers to the AST of a
+ * type that's currently defined.  On failure, \a sbuf may have been partially
+ * appended onto.
+ *
+ * @sa c_ast_load()
+ */
+NODISCARD
+bool c_ast_save( c_ast_t const *ast, strbuf_t *sbuf );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_c_ast_save_H */
+/* vim:set et sw=2 ts=2: */
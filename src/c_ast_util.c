@@ -34,7 +34,6 @@
 #include "c_operator.h"
 #include "c_sname.h"
 #include "c_type.h"
-#include "slist.h"
 #include "types.h"
 #include "util.h"
 
@@ -105,9 +104,12 @@ static c_ast_t* c_ast_add_array_impl( c_ast_t *ast, c_ast_t *array_ast,
         // else we'd end up with a "pointer to array 5 of array 3 of pointer to
         // int."
         //
-        PJL_DISCARD_RV(
-          c_ast_add_array_impl( ast->ptr_ref.to_ast, array_ast, of_ast )
-        );
+        // Skip all such consecutive pointers first so we recurse at most once.
+        //
+        c_ast_t *to_ast = ast->ptr_ref.to_ast;
+        while ( to_ast->kind == K_POINTER && to_ast->depth > array_ast->depth )
+          to_ast = to_ast->ptr_ref.to_ast;
+        PJL_DISCARD_RV( c_ast_add_array_impl( to_ast, array_ast, of_ast ) );
         return ast;
       }
       FALLTHROUGH;
@@ -188,42 +190,71 @@ static c_ast_t* c_ast_append_array( c_ast_t *ast, c_ast_t *array_ast,
   assert( array_ast->array.of_ast->kind == K_PLACEHOLDER );
   assert( of_ast != NULL );
 
-  switch ( ast->kind ) {
-    case K_POINTER:
+  //
+  // Find the end of the array chain.  This is done iteratively rather than
+  // recursively since the chain can be arbitrarily long.
+  //
+  c_ast_t *end_parent_ast = NULL, *end_ast = ast;
+  for (;;) {
+    if ( end_ast->kind == K_POINTER ) {
       //
       // If there's an intervening pointer, e.g.:
       //
       //      int (*(*x)[3])[5]
       //
-      // (where 'x' is a "pointer to array 3 of pointer to array 5 of int"), we
-      // have to recurse "through" it if its depth < the array's depth; else
+      // (where 'x' is a "pointer to array 3 of pointer to array 5 of int"),
+      // we have to go "through" it if its depth < the array's depth; else
       // we'd end up with a "pointer to array 3 of array 5 of pointer to int."
       //
-      if ( array_ast->depth >= ast->depth )
+      if ( array_ast->depth >= end_ast->depth )
         break;
-      FALLTHROUGH;
-
-    case K_ARRAY:;
-      //
-      // On the next-to-last recursive call, this sets this array to be an
-      // array of the new array; for all prior recursive calls, it's a no-op.
-      //
-      c_ast_t *const child_ast =
-        c_ast_append_array( ast->array.of_ast, array_ast, of_ast );
-      c_ast_set_parent( child_ast, ast );
-      return ast;
-
-    default:
-      /* suppress warning */;
-  } // switch
+    }
+    else if ( end_ast->kind != K_ARRAY ) {
+      break;
+    }
+    end_parent_ast = end_ast;
+    end_ast = end_ast->array.of_ast;
+  } // for
 
   //
   // We've reached the end of the array chain: make the new array be an array
-  // of this AST node and return the array so the parent will now point to it
-  // instead.
+  // of this AST node.
   //
-  c_ast_set_parent( ast, array_ast );
-  return array_ast;
+  c_ast_set_parent( end_ast, array_ast );
+  if ( end_parent_ast == NULL ) {
+    //
+    // There was no array chain: return the array so the parent will now point
+    // to it instead.
+    //
+    return array_ast;
+  }
+
+  c_ast_set_parent( array_ast, end_parent_ast );
+  if ( end_parent_ast != ast ) {
+    //
+    // As c_ast_set_parent() would, make the root of the chain be the one that
+    // is a parameter pack.
+    //
+    c_ast_move_parameter_pack( end_parent_ast, ast );
+  }
+  return ast;
+}
+
+/**
+ * Helper function for c_ast_add_func_impl() that checks whether it must go
+ * "through" \a ast to add \a func_ast.
+ *
+ * @param ast The AST to check.
+ * @param func_ast The function-like AST being added.
+ * @return Returns `true` only if it must.
+ */
+NODISCARD
+static bool c_ast_add_func_goes_through( c_ast_t const *ast,
+                                         c_ast_t const *func_ast ) {
+  return  c_ast_is_parent( ast ) && ast->parent.of_ast != NULL &&
+          (ast->parent.of_ast->kind &
+            (K_ARRAY | K_ANY_POINTER | K_ANY_REFERENCE)) != 0 &&
+          ast->depth > func_ast->depth;
 }
 
 /**
@@ -248,9 +279,13 @@ static c_ast_t* c_ast_add_func_impl( c_ast_t *ast, c_ast_t *func_ast,
       case K_REFERENCE:
       case K_RVALUE_REFERENCE:
         if ( ast->depth > func_ast->depth ) {
-          PJL_DISCARD_RV(
-            c_ast_add_func_impl( ast->ptr_ref.to_ast, func_ast, ret_ast )
-          );
+          //
+          // Skip all such consecutive ASTs first so we recurse at most once.
+          //
+          c_ast_t *to_ast = ast->ptr_ref.to_ast;
+          while ( c_ast_add_func_goes_through( to_ast, func_ast ) )
+            to_ast = to_ast->ptr_ref.to_ast;
+          PJL_DISCARD_RV( c_ast_add_func_impl( to_ast, func_ast, ret_ast ) );
           return ast;
         }
         FALLTHROUGH;
@@ -805,7 +840,7 @@ c_func_member_t c_ast_op_overload( c_ast_t const *ast ) {
   if ( c_tid_is_any( ast->type.stids, TS_MEMBER_FUNC_ONLY ) )
     return C_FUNC_MEMBER;
 
-  size_t const n_params = slist_len( &ast->oper.param_ast_list );
+  size_t const n_params = c_ast_list_len( &ast->oper.param_ast_list );
 
   switch ( op->op_id ) {
     case C_OP_NEW:
@@ -938,10 +973,10 @@ c_ast_t* c_ast_patch_placeholder( c_ast_t *type_ast, c_ast_t *decl_ast ) {
   return decl_ast;
 }
 
-c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_list_t *ast_list ) {
+c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_arena_t *arena ) {
   assert( ast != NULL );
   c_ast_t *const ptr_ast =
-    c_ast_new( K_POINTER, ast->depth, &ast->loc, ast_list );
+    c_ast_new( K_POINTER, ast->depth, &ast->loc, arena );
   ptr_ast->sname = c_ast_move_sname( ast );
   c_ast_set_parent( ast, ptr_ast );
   return ptr_ast;
@@ -955,13 +990,24 @@ c_ast_t const* (c_ast_root)( c_ast_t const *ast ) {
   return ast;
 }
 
-c_ast_t c_ast_sub_typedef( c_ast_t const *ast ) {
+c_ast_t c_ast_sub_typedef( c_ast_t const *ast, c_ast_cold_t *temp_cold ) {
   assert( ast != NULL );
   assert( ast->kind == K_TYPEDEF );
+  assert( temp_cold != NULL );
 
   c_tid_t qual_stids = TS_NONE;
   c_ast_t rv_ast = *c_ast_untypedef_qual( ast, &qual_stids );
-  rv_ast.align = ast->align;
+  if ( rv_ast.cold != NULL || ast->cold != NULL ) {
+    //
+    // The cold data of rv_ast is shared with the AST it's a copy of, so
+    // substitute the alignment into a copy of it instead.
+    //
+    *temp_cold = rv_ast.cold != NULL ?
+      *rv_ast.cold : (c_ast_cold_t){ .align = { .kind = C_ALIGNAS_NONE } };
+    temp_cold->align = ast->cold != NULL ?
+      ast->cold->align : (c_alignas_t){ .kind = C_ALIGNAS_NONE };
+    rv_ast.cold = temp_cold;
+  }
   rv_ast.loc = ast->loc;
   rv_ast.type.stids |= qual_stids;
   if ( c_ast_is_integral( &rv_ast ) )
@@ -481,13 +481,13 @@ c_ast_t* c_ast_patch_placeholder( c_ast_t *type_ast, c_ast_t *decl_ast );
  * nodes), if any, is moved to the new pointer AST.
  *
  * @param ast The AST to create a pointer to.
- * @param ast_list The list to append the new pointer AST node onto.
+ * @param arena The \ref c_ast_arena to allocate the new pointer AST node from.
  * @return Returns the new pointer AST.
  *
  * @sa c_ast_unpointer()
  */
 NODISCARD
-c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_list_t *ast_list );
+c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_arena_t *arena );
 
 /**
  * Gets the root AST node starting at \a ast.
@@ -769,6 +769,8 @@ inline bool c_ast_print_as_using( c_ast_t const *ast ) {
  *
  * @param ast The AST to get what it's a `typedef` for .  It _must_ be of kind
  * #K_TYPEDEF.
+ * @param temp_cold The \ref c_ast_cold to use for the cold data of the new
+ * AST, if needed.  It must remain valid for as long as the new AST is used.
  * @return Returns a new AST that is the AST that \a ast is a `typedef` for,
  * but with the original alignment, bit-field width (only if an integral type),
  * source location, and qualifiers bitwise-or'd in.
@@ -776,7 +778,7 @@ inline bool c_ast_print_as_using( c_ast_t const *ast ) {
  * @sa c_ast_untypedef_qual()
  */
 NODISCARD
-c_ast_t c_ast_sub_typedef( c_ast_t const *ast );
+c_ast_t c_ast_sub_typedef( c_ast_t const *ast, c_ast_cold_t *temp_cold );
 
 ///////////////////////////////////////////////////////////////////////////////
 
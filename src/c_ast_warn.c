@@ -104,7 +104,7 @@ static bool c_ast_visitor_warning( c_ast_t const *ast, user_data_t user_data ) {
           "\"%s\" on reference type ",
           c_tid_error( qual_stids )
         );
-        print_ast_type_aka( ast, stderr );
+        print_ast_type_aka( ast, EFILE );
         EPUTS( " has no effect\n" );
         break;
       }
@@ -273,8 +273,9 @@ static void c_ast_warn_name( c_ast_t const *ast ) {
 
   c_sname_warn( &ast->sname, &ast->loc );
 
-  if ( ast->align.kind == C_ALIGNAS_SNAME )
-    c_sname_warn( &ast->align.sname, &ast->align.loc );
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align != NULL && align->kind == C_ALIGNAS_SNAME )
+    c_sname_warn( &align->sname, &align->loc );
 
   if ( (ast->kind & K_ANY_NAME) != 0 &&
        c_sname_cmp( &ast->sname, &ast->name.sname ) != 0 ) {
@@ -29,6 +29,7 @@
 #include "c_keyword.h"
 #include "c_lang.h"
 #include "c_type.h"
+#include "keyword.h"
 #include "lexer.h"
 #include "literals.h"
 #include "types.h"
@@ -474,15 +475,17 @@ static int c_keyword_cmp( c_keyword_t const *i_ck, c_keyword_t const *j_ck ) {
 c_keyword_t const* c_keyword_find( char const *literal, c_lang_id_t lang_ids,
                                    c_keyword_ctx_t kw_ctx ) {
   assert( literal != NULL );
+  return c_keyword_match( keyword_find( literal ), lang_ids, kw_ctx );
+}
+
+c_keyword_t const* c_keyword_match( keyword_t const *kw, c_lang_id_t lang_ids,
+                                    c_keyword_ctx_t kw_ctx ) {
   assert( lang_ids != LANG_NONE );
+  if ( kw == NULL )
+    return NULL;
 
-  // the list is small, so linear search is good enough
-  FOREACH_ARRAY_ELEMENT( c_keyword_t, ck, C_KEYWORDS ) {
-    int const cmp = strcmp( literal, ck->literal );
-    if ( cmp > 0 )
-      continue;
-    if ( cmp < 0 )                      // the array is sorted
-      break;
+  for ( size_t i = 0; i < kw->c_keywords_len; ++i ) {
+    c_keyword_t const *const ck = &kw->c_keywords[i];
 
     if ( (ck->lang_ids & lang_ids) == LANG_NONE )
       continue;
@@ -521,7 +524,7 @@ c_keyword_t const* c_keyword_next( c_keyword_t const *ck ) {
 
 void c_keywords_init( void ) {
   ASSERT_RUN_ONCE();
-  qsort(                                // so we can stop the search early
+  qsort(                                // so same literals are consecutive
     C_KEYWORDS, ARRAY_SIZE( C_KEYWORDS ), sizeof C_KEYWORDS[0],
     POINTER_CAST( qsort_cmp_fn_t, &c_keyword_cmp )
   );
@@ -121,11 +121,31 @@ typedef struct c_keyword c_keyword_t;
  * @param kw_ctx The keyword context to limit to.
  * @return Returns a pointer to the corresponding c_keyword or NULL if not
  * found.
+ *
+ * @sa c_keyword_match()
+ * @sa keyword_find()
  */
 NODISCARD
 c_keyword_t const* c_keyword_find( char const *literal, c_lang_id_t lang_ids,
                                    c_keyword_ctx_t kw_ctx );
 
+/**
+ * Given a \ref keyword, gets the c_keyword for the corresponding C/C++
+ * keyword or C23/C++11 (or later) attribute, if any.
+ *
+ * @param kw The \ref keyword as returned by keyword_find().  It may be NULL.
+ * @param lang_ids The bitwise-or of language(s) to look for the keyword or
+ * attribute in.
+ * @param kw_ctx The keyword context to limit to.
+ * @return Returns a pointer to the corresponding c_keyword or NULL if not
+ * found.
+ *
+ * @sa c_keyword_find()
+ */
+NODISCARD
+c_keyword_t const* c_keyword_match( keyword_t const *kw, c_lang_id_t lang_ids,
+                                    c_keyword_ctx_t kw_ctx );
+
 /**
  * Iterates to the next C/C++ keyword or or C23/C++11 (or later) attribute
  *
@@ -34,14 +34,102 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdlib.h>                     /* for free(3) */
+#include <string.h>
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Initializes \a pattern by compiling \a glob.
+ *
+ * @param pattern The \ref c_sglob_pattern to initialize.
+ * @param glob The glob.  Ownership is taken.
+ */
+static void c_sglob_pattern_init( c_sglob_pattern_t *pattern, char *glob ) {
+  assert( pattern != NULL );
+  assert( glob != NULL );
+
+  size_t const prefix_len = strcspn( glob, "*" );
+  c_sglob_kind_t kind;
+  if ( glob[ prefix_len ] == '\0' )
+    kind = C_SGLOB_LITERAL;
+  else if ( glob[ prefix_len + 1 ] == '\0' )
+    kind = prefix_len == 0 ? C_SGLOB_ANY : C_SGLOB_PREFIX;
+  else
+    kind = C_SGLOB_WILD;
+
+  *pattern = (c_sglob_pattern_t){
+    .glob = glob,
+    .prefix_len = prefix_len,
+    .kind = kind
+  };
+}
+
+/**
+ * Checks whether \a name matches \a glob where \a glob may contain `*` that
+ * matches zero or more characters.
+ *
+ * @remarks This is the usual greedy algorithm that, upon a mismatch, resumes
+ * just after the most recent `*` having matched one more character.
+ *
+ * @param glob The glob.
+ * @param name The name to match.
+ * @return Returns `true` only if \a name matches \a glob.
+ */
+NODISCARD
+static bool wild_match( char const *glob, char const *name ) {
+  char const *star_glob = NULL, *star_name = NULL;
+
+  while ( *name != '\0' ) {
+    if ( *glob == '*' ) {
+      star_glob = ++glob;
+      star_name = name;
+    }
+    else if ( *glob == *name ) {
+      ++glob;
+      ++name;
+    }
+    else if ( star_glob != NULL ) {
+      glob = star_glob;
+      name = ++star_name;
+    }
+    else {
+      return false;
+    }
+  } // while
+
+  while ( *glob == '*' )
+    ++glob;
+  return *glob == '\0';
+}
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+bool c_sglob_pattern_match( c_sglob_pattern_t const *pattern,
+                            char const *name ) {
+  assert( pattern != NULL );
+  assert( name != NULL );
+
+  switch ( pattern->kind ) {
+    case C_SGLOB_LITERAL:
+      return strcmp( name, pattern->glob ) == 0;
+    case C_SGLOB_ANY:
+      return true;
+    case C_SGLOB_PREFIX:
+      return strncmp( name, pattern->glob, pattern->prefix_len ) == 0;
+    case C_SGLOB_WILD:
+      return strncmp( name, pattern->glob, pattern->prefix_len ) == 0 &&
+             wild_match( pattern->glob + pattern->prefix_len,
+                         name + pattern->prefix_len );
+  } // switch
+
+  UNEXPECTED_INT_VALUE( pattern->kind );
+}
+
 void c_sglob_cleanup( c_sglob_t *sglob ) {
   if ( sglob != NULL ) {
     if ( sglob->pattern != NULL ) {
       for ( size_t i = 0; i < sglob->count; ++i )
-        free( sglob->pattern[i] );
+        free( sglob->pattern[i].glob );
       free( sglob->pattern );
     }
     c_sglob_init( sglob );
@@ -88,7 +176,7 @@ void c_sglob_parse( char const *s, c_sglob_t *rv_sglob ) {
     }
   } // for
 
-  rv_sglob->pattern = MALLOC( char*, scope_count );
+  rv_sglob->pattern = MALLOC( c_sglob_pattern_t, scope_count );
 
   //
   // Break up scoped glob into array of globs.
@@ -102,8 +190,10 @@ void c_sglob_parse( char const *s, c_sglob_t *rv_sglob ) {
     size_t const glob_len = STATIC_CAST( size_t, s - glob_begin );
     assert( glob_len > 0 );
     assert( rv_sglob->count < scope_count );
-    rv_sglob->pattern[ rv_sglob->count++ ] =
-      check_strndup( glob_begin, glob_len );
+    c_sglob_pattern_init(
+      &rv_sglob->pattern[ rv_sglob->count++ ],
+      check_strndup( glob_begin, glob_len )
+    );
     if ( *s == '\0' )
       break;
     s += STRLITLEN( "::" );
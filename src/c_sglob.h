@@ -55,13 +55,23 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * A glob for a single scope of a \ref c_sglob compiled so that it's matched
+ * without calling **fnmatch**(3).
+ */
+struct c_sglob_pattern {
+  char           *glob;                 ///< Glob pattern.
+  size_t          prefix_len;           ///< Length of literal prefix.
+  c_sglob_kind_t  kind;                 ///< How \ref glob matches.
+};
+
 /**
  * C++ scoped name glob, e.g., `S::T::x*`.
  */
 struct c_sglob {
-  size_t  count;                        ///< Number of scopes.
-  char  **pattern;                      ///< Array[count] of glob patterns.
-  bool    match_in_any_scope;           ///< Match in any scope?
+  size_t              count;            ///< Number of scopes.
+  c_sglob_pattern_t  *pattern;          ///< Array[count] of glob patterns.
+  bool                match_in_any_scope; ///< Match in any scope?
 };
 
 ////////// extern functions ///////////////////////////////////////////////////
@@ -100,6 +110,19 @@ inline void c_sglob_init( c_sglob_t *sglob ) {
   *sglob = (c_sglob_t){ 0 };
 }
 
+/**
+ * Checks whether \a name matches \a pattern.
+ *
+ * @param pattern The \ref c_sglob_pattern to match.
+ * @param name The name to match.
+ * @return Returns `true` only if \a name matches \a pattern.
+ *
+ * @sa c_sname_match()
+ */
+NODISCARD
+bool c_sglob_pattern_match( c_sglob_pattern_t const *pattern,
+                            char const *name );
+
 /**
  * Parses the glob string \a s into \a sglob.
  *
@@ -33,6 +33,7 @@
 #include "c_sglob.h"
 #include "c_type.h"
 #include "c_typedef.h"
+#include "intern.h"
 #include "literals.h"
 #include "options.h"
 #include "p_macro.h"
@@ -44,8 +45,8 @@
 // standard
 #include <assert.h>
 #include <ctype.h>                      /* for isspace(3) */
-#include <fnmatch.h>
 #include <stdbool.h>
+#include <stdint.h>                     /* for uint64_t */
 #include <stdio.h>                      /* for stderr */
 #include <stdlib.h>                     /* for free(3) */
 #include <string.h>                     /* for strcmp(3), strlen(3) */
@@ -57,6 +58,23 @@
 
 ////////// local functions ////////////////////////////////////////////////////
 
+/**
+ * Appends \a name onto the end of \a sname.
+ *
+ * @param sname The scoped name to append to.
+ * @param name The name to append.  It must have been interned.
+ *
+ * @sa c_sname_push_back_name()
+ * @sa c_sname_push_back_namen()
+ */
+static void c_sname_push_back_iname( c_sname_t *sname, char const *name ) {
+  assert( sname != NULL );
+  assert( name != NULL );
+  c_scope_data_t *const data = MALLOC( c_scope_data_t, 1 );
+  *data = (c_scope_data_t){ .name = name, .type = T_NONE };
+  slist_push_back( sname, data );
+}
+
 /**
  * Helper function for c_sname_parse() and c_sname_parse_dtor().
  *
@@ -86,13 +104,12 @@ size_t c_sname_parse_impl( char const *s, c_sname_t *rv_sname, bool is_dtor ) {
   char const *prev_name = "";
 
   while ( (end = parse_identifier( s )) != NULL ) {
-    char *const name = check_strndup( s, STATIC_CAST( size_t, end - s ) );
+    char const *const name = intern_strn( s, STATIC_CAST( size_t, end - s ) );
 
     // Ensure that the name is NOT a keyword.
     c_keyword_t const *const ck =
       c_keyword_find( name, opt_lang_id, C_KW_CTX_DEFAULT );
     if ( ck != NULL ) {
-      free( name );
       // ck->literal is set to L_* so == is OK
       if ( is_dtor && ck->literal == L_compl ) {
         char const *const t = s + strlen( L_compl );
@@ -107,7 +124,7 @@ size_t c_sname_parse_impl( char const *s, c_sname_t *rv_sname, bool is_dtor ) {
         goto error;
       goto done;
     }
-    c_sname_push_back_name( &temp_sname, name );
+    c_sname_push_back_iname( &temp_sname, name );
 
     prev_end = end;
     SKIP_WS( end );
@@ -143,6 +160,8 @@ int c_scope_data_cmp( c_scope_data_t const *i_data,
                       c_scope_data_t const *j_data ) {
   assert( i_data != NULL );
   assert( j_data != NULL );
+  if ( i_data->name == j_data->name )   // interned names
+    return 0;
   return strcmp( i_data->name, j_data->name );
 }
 
@@ -151,17 +170,14 @@ c_scope_data_t* c_scope_data_dup( c_scope_data_t const *src ) {
     return NULL;                        // LCOV_EXCL_LINE
   c_scope_data_t *const dst = MALLOC( c_scope_data_t, 1 );
   *dst = (c_scope_data_t){
-    .name = check_strdup( src->name ),
+    .name = src->name,
     .type = src->type
   };
   return dst;
 }
 
 void c_scope_data_free( c_scope_data_t *data ) {
-  if ( data != NULL ) {
-    free( data->name );
-    free( data );
-  }
+  free( data );
 }
 
 bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
@@ -194,7 +210,7 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
     // For any that does, check that the sname's scope's type matches the
     // previously declared sname's scope's type.
     //
-    c_sname_push_back_name( &partial_sname, check_strdup( name ) );
+    c_sname_push_back_iname( &partial_sname, name );
 
     c_type_t const scope_type = scope_data->type;
     c_typedef_t const *const tdef = c_typedef_find_sname( &partial_sname );
@@ -219,7 +235,7 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
             c_sname_local_name( &partial_sname ),
             c_type_error( tdef_type )
           );
-          print_type_decl( tdef, tdef->decl_flags, stderr );
+          print_type_decl( tdef, tdef->decl_flags, EFILE );
           EPUTS( "\")\n" );
           break;
         }
@@ -261,6 +277,24 @@ char const* c_sname_global_name( c_sname_t const *sname ) {
   return "";                            // LCOV_EXCL_LINE
 }
 
+size_t c_sname_hash( c_sname_t const *sname ) {
+  assert( sname != NULL );
+
+  // This is the Fowler-Noll-Vo (FNV-1a) hash function.
+  uint64_t hash = 0xCBF29CE484222325u;
+  FOREACH_SLIST_NODE( scope_node, sname ) {
+    c_scope_data_t const *const data = scope_node->data;
+    for ( char const *s = data->name; *s != '\0'; ++s ) {
+      hash ^= STATIC_CAST( unsigned char, *s );
+      hash *= 0x100000001B3u;
+    } // for
+    hash ^= ':';                        // so A::BC != AB::C
+    hash *= 0x100000001B3u;
+  } // for
+
+  return STATIC_CAST( size_t, hash );
+}
+
 bool c_sname_is_ctor( c_sname_t const *sname ) {
   assert( sname != NULL );
   if ( c_sname_count( sname ) < 2 )
@@ -338,7 +372,7 @@ bool c_sname_match( c_sname_t const *sname, c_sglob_t const *sglob ) {
         ++sglob_index, scope = scope->next ) {
     assert( sglob_index < sglob->count );
     char const *const name = c_scope_data( scope )->name;
-    if ( fnmatch( sglob->pattern[ sglob_index ], name, /*flags=*/0 ) != 0 )
+    if ( !c_sglob_pattern_match( &sglob->pattern[ sglob_index ], name ) )
       return false;
   } // for
 
@@ -354,11 +388,15 @@ bool c_sname_parse_dtor( char const *s, c_sname_t *rv_sname ) {
 }
 
 void c_sname_push_back_name( c_sname_t *sname, char *name ) {
-  assert( sname != NULL );
   assert( name != NULL );
-  c_scope_data_t *const data = MALLOC( c_scope_data_t, 1 );
-  *data = (c_scope_data_t){ .name = name, .type = T_NONE };
-  slist_push_back( sname, data );
+  c_sname_push_back_iname( sname, intern_str( name ) );
+  free( name );
+}
+
+void c_sname_push_back_namen( c_sname_t *sname, char const *name,
+                              size_t name_len ) {
+  assert( name != NULL );
+  c_sname_push_back_iname( sname, intern_strn( name, name_len ) );
 }
 
 c_sname_t c_sname_scope_sname( c_sname_t const *sname ) {
@@ -368,7 +406,7 @@ c_sname_t c_sname_scope_sname( c_sname_t const *sname ) {
   if ( sname != NULL ) {
     FOREACH_SNAME_SCOPE_UNTIL( scope, sname, sname->tail ) {
       c_scope_data_t const *const scope_data = c_scope_data( scope );
-      c_sname_push_back_name( &rv_sname, check_strdup( scope_data->name ) );
+      c_sname_push_back_iname( &rv_sname, scope_data->name );
       c_sname_local_data( &rv_sname )->type = scope_data->type;
     } // for
   }
@@ -98,7 +98,7 @@
  * @warning c_sname_cleanup() must _not_ be called on the returned value.
  */
 #define C_SNAME_LIT(NAME) \
-  SLIST_LIT( (&(c_scope_data_t){ CONST_CAST( char*, (NAME) ), T_NONE }) )
+  SLIST_LIT( (&(c_scope_data_t){ (NAME), T_NONE }) )
 
 /**
  * Gets the local scope data of \a SNAME (which is the data of the innermost
@@ -146,8 +146,13 @@
 struct c_scope_data {
   /**
    * The scope's name.
+   *
+   * @remarks Except for names of scoped name literals created via
+   * #C_SNAME_LIT, it's interned via intern_str().  Lookups by name, e.g.,
+   * c_typedef_find_name(), use the interned copy found via intern_str_find(),
+   * if any, for their literals.
    */
-  char *name;
+  char const *name;
 
   /**
    * The scope's type, one of: #TB_class, #TB_struct, #TB_union, [#TS_inline]
@@ -194,14 +199,30 @@ void c_scope_data_free( c_scope_data_t *data );
  * Appends \a name onto the end of \a sname.
  *
  * @param sname The scoped name to append to.
- * @param name The name to append.  Ownership is taken.
+ * @param name The name to append.  Ownership is taken.  It's interned, then
+ * freed.
  *
+ * @sa c_sname_push_back_namen()
  * @sa c_sname_push_back_sname()
  * @sa c_sname_push_front_sname()
  * @sa c_sname_set()
  */
 void c_sname_push_back_name( c_sname_t *sname, char *name );
 
+/**
+ * Appends the first \a name_len characters of \a name onto the end of \a
+ * sname.
+ *
+ * @param sname The scoped name to append to.
+ * @param name The name to append.  It need not be null-terminated.  Only an
+ * interned copy of it is appended, so ownership is _not_ taken.
+ * @param name_len The number of characters of \a name to append.
+ *
+ * @sa c_sname_push_back_name()
+ */
+void c_sname_push_back_namen( c_sname_t *sname, char const *name,
+                              size_t name_len );
+
 /**
  * Checks a scoped name for valid scope order.
  *
@@ -253,6 +274,18 @@ void c_sname_free( c_sname_t *sname );
 NODISCARD
 char const* c_sname_global_name( c_sname_t const *sname );
 
+/**
+ * Gets a hash code for \a sname.
+ *
+ * @param sname The scoped name to get the hash code of.
+ * @return Returns said hash code.
+ *
+ * @note Scoped names that are equal according to c_sname_cmp() have equal
+ * hash codes.
+ */
+NODISCARD
+size_t c_sname_hash( c_sname_t const *sname );
+
 /**
  * Gets whether \a sname is a constructor name, i.e., whether the last two
  * names match, for example `S::T::T`.
@@ -510,9 +543,7 @@ inline bool c_sname_empty( c_sname_t const *sname ) {
 NODISCARD
 inline bool c_sname_equal( c_sname_t const *i_sname,
                            c_sname_t const *j_sname ) {
-  return slist_equal(
-    i_sname, j_sname, POINTER_CAST( slist_equal_fn_t, &str_equal )
-  );
+  return c_sname_cmp( i_sname, j_sname ) == 0;
 }
 
 /**
@@ -31,13 +31,19 @@
 #include "bit_util.h"
 #endif /* NDEBUG */
 #include "c_ast.h"
+#include "c_ast_save.h"
 #include "c_lang.h"
+#include "c_sglob.h"
 #include "c_sname.h"
 #include "cdecl.h"
+#include "intern.h"
 #include "lexer.h"
+#include "literals.h"
 #include "options.h"
 #include "parse.h"
 #include "red_black.h"
+#include "result_cache.h"
+#include "strbuf.h"
 #include "types.h"
 #include "util.h"
 
@@ -45,9 +51,14 @@
 
 // standard
 #include <assert.h>
+#include <inttypes.h>                   /* for PRIx64, SCNx64 */
 #include <stdbool.h>
-#include <string.h>                     /* for strlen(3) */
+#include <stdint.h>                     /* for uint64_t */
+#include <stdio.h>                      /* for getline(3), rename(2) */
+#include <stdlib.h>                     /* for qsort(3) */
+#include <string.h>
 #include <sysexits.h>
+#include <unistd.h>                     /* for getpid(2), unlink(2) */
 
 /// @endcond
 
@@ -64,10 +75,30 @@
  */
 #define PT(S)                     { (S), __LINE__ }
 
+/**
+ * The first line of a predefined types image file.
+ */
+#define PREDEF_IMAGE_MAGIC        "// " CDECL " predefined types 1\n"
+
+/**
+ * The name of the predefined types image file in the cache directory.
+ */
+#define PREDEF_IMAGE_NAME         "predefined"
+
+/**
+ * The minimum capacity of a \ref tdef_index; must be a power of 2.
+ */
+#define TDEF_INDEX_CAP_MIN        1024u
+
 ////////// typedefs ///////////////////////////////////////////////////////////
 
+typedef struct predef_lazy        predef_lazy_t;
+typedef struct predef_set         predef_set_t;
+typedef struct predef_state       predef_state_t;
 typedef struct predef_type        predef_type_t;
-typedef struct tdef_rb_visit_data tdef_rb_visit_data_t;
+typedef struct tdef_index         tdef_index_t;
+typedef struct tdef_index_entry   tdef_index_entry_t;
+typedef struct tdef_layer         tdef_layer_t;
 
 ////////// structs ////////////////////////////////////////////////////////////
 
@@ -82,17 +113,111 @@ struct predef_type {
 };
 
 /**
- * Data passed to our red-black tree visitor function.
+ * A predefined type whose definition is deferred until its name is first used.
+ *
+ * @sa #opt_lazy_typedefs
+ */
+struct predef_lazy {
+  predef_type_t const  *pt;             ///< The predefined type.
+  predef_set_t const   *set;            ///< The set \ref pt is in.
+  char const           *name;           ///< Local name within \ref pt.
+  size_t                name_len;       ///< Length of \ref name.
+  bool                  is_defined;     ///< Has it been defined yet?
+};
+
+/**
+ * Contains a set of predefined types along with the language(s) they're
+ * available in and the language they're parsed in.
+ */
+struct predef_set {
+  predef_type_t const  *types;          ///< Predefined types.
+  c_lang_id_t           lang_ids;       ///< Language(s) types are available in.
+  c_lang_id_t           parse_lang_id;  ///< Language to parse types in.
+  predef_types_t        min_predef;     ///< Minimum \ref opt_predef_types.
+};
+
+/**
+ * Global state that's temporarily changed while predefining types.
+ *
+ * @sa predef_state_begin()
+ * @sa predef_state_end()
+ */
+struct predef_state {
+#ifdef ENABLE_BISON_DEBUG
+  int             bison_debug;          ///< Original \ref opt_bison_debug.
+#endif /* ENABLE_BISON_DEBUG */
+  cdecl_debug_t   cdecl_debug;          ///< Original \ref opt_cdecl_debug.
+  bool            echo_commands;        ///< Original \ref opt_echo_commands.
+#ifdef ENABLE_FLEX_DEBUG
+  int             flex_debug;           ///< Original \ref opt_flex_debug.
+#endif /* ENABLE_FLEX_DEBUG */
+  char const     *input_path;           ///< Original \ref cdecl_input_path.
+  bool            is_initialized;       ///< Original \ref cdecl_is_initialized.
+  c_lang_id_t     lang_id;              ///< Original \ref opt_lang_id.
+  int             lineno;               ///< Original `yylineno`.
+  c_lang_id_t     predef_lang_ids;      ///< Original \ref predef_lang_ids.
+};
+
+/**
+ * An entry in a \ref tdef_index.
+ */
+struct tdef_index_entry {
+  size_t      hash;                     ///< Hash code of the type's name.
+  rb_node_t  *rb_node;                  ///< Node of the type, if any.
+};
+
+/**
+ * A hash index of types by name.
  */
-struct tdef_rb_visit_data {
-  c_typedef_visit_fn_t  visit_fn;       ///< Caller's visitor function.
-  void                 *visit_data;     ///< Caller's optional data.
+struct tdef_index {
+  tdef_index_entry_t *entries;          ///< Entries, if any.
+  size_t              cap;              ///< Capacity of \ref entries.
+  size_t              len;              ///< Entries used in \ref entries.
+};
+
+/**
+ * A layer of types.
+ *
+ * @remarks
+ * @parblock
+ * Types are stored in two layers:
+ *
+ *  1. \ref tdef_base that contains the predefined types and those defined by
+ *     the configuration file.
+ *
+ *  2. \ref tdef_overlay that contains types defined once \ref tdef_base is
+ *     frozen via c_typedefs_freeze().
+ *
+ * Once frozen, nothing is either added to or removed from \ref tdef_base: a
+ * type is instead added to \ref tdef_overlay and only a type in \ref
+ * tdef_overlay can be removed.  (Only a type that was just added is ever
+ * removed.)  Hence, a process forked after freezing (e.g., a server session)
+ * shares all of \ref tdef_base with its parent (via copy-on-write) rather than
+ * copying any of it as soon as it defines a type of its own.
+ * @endparblock
+ */
+struct tdef_layer {
+  rb_tree_t     set;                    ///< Types in this layer.
+  tdef_index_t  index;                  ///< Hash index of \ref set.
 };
 
 ////////// local variables ////////////////////////////////////////////////////
 
-static c_lang_id_t  predef_lang_ids;    ///< Languages when predefining types.
-static rb_tree_t    typedef_set;        ///< Global set of `typedef`s.
+/// AST nodes of the predefined types loaded from an image.
+static c_ast_arena_t   predef_ast_arena;
+
+static c_lang_id_t     predef_lang_ids;    ///< Languages when predefining types.
+static predef_lazy_t  *predef_lazy;        ///< Lazy types in definition order.
+static predef_lazy_t **predef_lazy_index;  ///< Lazy types sorted by name.
+static size_t          predef_lazy_len;    ///< Number of lazy types.
+static size_t          predef_lazy_undef;  ///< Number not yet defined.
+static tdef_layer_t    tdef_base;          ///< Predefined & config types.
+static tdef_layer_t    tdef_overlay;       ///< Types defined once frozen.
+static unsigned        tdef_gen;           ///< Changes to any type.
+
+/// Layer types are added to: \ref tdef_base until frozen; then \ref
+/// tdef_overlay.
+static tdef_layer_t   *tdef_top = &tdef_base;
 
 ////////// local constants ////////////////////////////////////////////////////
 
@@ -1033,8 +1158,89 @@ static predef_type_t const PREDEFINED_WIN32[] = {
   PT( NULL )
 };
 
+/**
+ * All sets of predefined types in the order in which they're parsed.
+ *
+ * @remarks The order matters since some types are defined in terms of types
+ * in earlier sets.  C types are parsed in the latest supported version of C
+ * and C++ types are parsed in the latest supported version of C++ so all
+ * keywords will be available.
+ */
+static predef_set_t const PREDEFINED_SETS[] = {
+  { PREDEFINED_KNR_C,                     LANG_MIN(C_KNR),   LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_C_89,                  LANG_MIN(C_89),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_FLOATING_POINT_EXTENSIONS, LANG_MIN(C_89),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_GNU_C,                     LANG_MIN(C_89),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_C_95,                  LANG_MIN(C_95),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_PTHREAD_H,                 LANG_MIN(C_95),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_WIN32,                     LANG_MIN(C_95),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_C_99,                  LANG_MIN(C_99),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  // However, Embedded C extensions are available only in C99.
+  { PREDEFINED_EMBEDDED_C,                LANG_C_99,         LANG_C_99,
+    PREDEF_TYPES_ALL },
+
+  // Must be defined after C99.
+  { PREDEFINED_MISC,                      LANG_MIN(C_89),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_C_11,                  LANG_MIN(C_11),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_C_23,                  LANG_MIN(C_23),    LANG_C_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_CPP,                   LANG_MIN(CPP_OLD), LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_CPP_11,                LANG_MIN(CPP_11),  LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_CPP_17,                LANG_MIN(CPP_17),  LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_CPP_20,                LANG_MIN(CPP_20),  LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_CPP_23,                LANG_MIN(CPP_23),  LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+  { PREDEFINED_STD_CPP_26,                LANG_MIN(CPP_26),  LANG_CPP_NEW,
+    PREDEF_TYPES_ALL },
+
+  { PREDEFINED_STD_CPP_20_REQUIRED,       LANG_MIN(CPP_20),  LANG_CPP_NEW,
+    PREDEF_TYPES_REQUIRED },
+};
+
 ////////// local functions ////////////////////////////////////////////////////
 
+NODISCARD
+static int  predef_name_cmp( char const*, size_t, char const*, size_t );
+
+NODISCARD
+static bool predef_set_is_lazy( predef_set_t const* );
+
+static void predef_state_begin( predef_state_t* );
+static void predef_state_end( predef_state_t const* );
+
+NODISCARD
+static char const* predef_type_name( char const*, size_t* );
+
+static void tdef_index_cleanup( tdef_index_t* );
+
+NODISCARD
+static tdef_index_entry_t* tdef_index_find( tdef_index_t const*,
+                                            c_sname_t const*, size_t );
+
+NODISCARD
+static rb_node_t* tdef_index_lookup( tdef_index_t const*, c_sname_t const*,
+                                     size_t );
+
 /**
  * Comparison function for two \ref c_typedef.
  *
@@ -1066,12 +1272,15 @@ static void c_typedef_init( c_typedef_t *tdef, c_ast_t const *ast,
   assert( ast != NULL );
   assert( is_1_bit_only_in_set( decl_flags, C_TYPE_DECL_ANY ) );
 
+  static unsigned next_def_order;
+
   bool const is_predefined = predef_lang_ids != LANG_NONE;
 
   *tdef = (c_typedef_t){
     .ast = ast,
     .decl_flags = decl_flags,
     .is_predefined = is_predefined,
+    .def_order = ++next_def_order,
     //
     // If predef_lang_ids is set, we're predefining a type that's available
     // only in those language(s); otherwise we're defining a user-defined type
@@ -1082,6 +1291,42 @@ static void c_typedef_init( c_typedef_t *tdef, c_ast_t const *ast,
   };
 }
 
+/**
+ * Compares the literal prefix of \a sglob to the name of \a tdef.
+ *
+ * @remarks The literal prefix of \a sglob comprises its leading globs having
+ * no `*` followed by the characters preceding the first `*`, if any, of the
+ * next glob.  Since types are ordered by name, all types whose names have the
+ * literal prefix are contiguous.
+ *
+ * @param sglob The scoped glob to compare.  It must not match in any scope.
+ * @param tdef The \ref c_typedef to compare.
+ * @return Returns a number less than 0, 0, or greater than 0 if the names of
+ * all types having the literal prefix of \a sglob are less than, include, or
+ * are greater than the name of \a tdef, respectively.
+ */
+NODISCARD
+static int c_typedef_sglob_cmp( c_sglob_t const *sglob,
+                                c_typedef_t const *tdef ) {
+  assert( sglob != NULL );
+  assert( !sglob->match_in_any_scope );
+  assert( tdef != NULL );
+
+  c_scope_t const *scope = tdef->ast->sname.head;
+  for ( size_t i = 0; i < sglob->count; ++i, scope = scope->next ) {
+    if ( scope == NULL )                // name is a proper prefix
+      return 1;
+    c_sglob_pattern_t const *const pattern = &sglob->pattern[i];
+    char const *const name = c_scope_data( scope )->name;
+    if ( pattern->kind != C_SGLOB_LITERAL )
+      return strncmp( pattern->glob, name, pattern->prefix_len );
+    int const cmp = strcmp( pattern->glob, name );
+    if ( cmp != 0 )
+      return cmp;
+  } // for
+  return 0;
+}
+
 /**
  * Cleans-up all \ref c_typedef data at program termination.
  *
@@ -1097,7 +1342,63 @@ static void c_typedefs_cleanup( void ) {
   // the red-black tree, its nodes, and the c_typedef_t data each node points
   // to, but not the AST nodes the c_typedef_t data points to.
   //
-  rb_tree_cleanup( &typedef_set, /*free_fn=*/NULL );
+  rb_tree_cleanup( &tdef_overlay.set, /*free_fn=*/NULL );
+  tdef_index_cleanup( &tdef_overlay.index );
+  rb_tree_cleanup( &tdef_base.set, /*free_fn=*/NULL );
+  tdef_index_cleanup( &tdef_base.index );
+  FREE( predef_lazy_index );
+  FREE( predef_lazy );
+  c_ast_arena_cleanup( &predef_ast_arena );
+}
+
+/**
+ * Gets the next identifier in \a *ps, if any.
+ *
+ * @param ps A pointer to the string to get the next identifier from.  Upon
+ * return, it points to just past the identifier.
+ * @param end A pointer to one past the last character of \a *ps.
+ * @param pident_len A pointer to receive the length of the identifier.
+ * @return Returns a pointer to the start of the identifier or NULL if none.
+ */
+NODISCARD
+static char const* next_ident( char const **ps, char const *end,
+                               size_t *pident_len ) {
+  assert( ps != NULL );
+  assert( *ps != NULL );
+  assert( pident_len != NULL );
+
+  char const *s = *ps;
+  while ( s < end && !is_ident_first( *s ) )
+    ++s;
+  if ( s == end ) {
+    *ps = s;
+    return NULL;
+  }
+  char const *const ident = s;
+  do {
+    ++s;
+  } while ( s < end && is_ident( *s ) );
+
+  *ps = s;
+  *pident_len = STATIC_CAST( size_t, s - ident );
+  return ident;
+}
+
+/**
+ * Parses a predefined type declaration.
+ *
+ * @param pt The predefined type to parse.
+ */
+static void parse_predef_type( predef_type_t const *pt ) {
+  assert( pt != NULL );
+  //
+  // Set Flex's current line number to the predefined type's source line
+  // number in this file.
+  //
+  yylineno = STATIC_CAST( int, pt->line );
+
+  if ( unlikely( cdecl_parse_string( pt->str, strlen( pt->str ) ) != EX_OK ) )
+    INTERNAL_ERROR( "failed parsing type predefined on line %u\n", pt->line );
 }
 
 /**
@@ -1107,102 +1408,429 @@ static void c_typedefs_cleanup( void ) {
  * _must_ have its \ref predef_type::str "str" be NULL.
  */
 static void parse_predef_types( predef_type_t const types[static const 2] ) {
-  for ( predef_type_t const *pt = types; pt->str != NULL; ++pt ) {
-    //
-    // Set Flex's current line number to the predefined type's source line
-    // number in this file.
-    //
-    yylineno = STATIC_CAST( int, pt->line );
+  for ( predef_type_t const *pt = types; pt->str != NULL; ++pt )
+    parse_predef_type( pt );
+}
 
-    if ( unlikely( cdecl_parse_string( pt->str, strlen( pt->str ) ) != EX_OK ) )
-      INTERNAL_ERROR( "failed parsing type predefined on line %u\n", pt->line );
+/**
+ * Gets the key of the predefined types image for the current options.
+ *
+ * @return Returns a hash code of the version of **cdecl**, the options that
+ * affect which types are predefined eagerly, and the declarations of those
+ * types.
+ *
+ * @sa predef_image_read()
+ * @sa predef_image_write()
+ */
+NODISCARD
+static uint64_t predef_image_key( void ) {
+  uint64_t hash =
+    fnv1a( FNV1A_INIT, PACKAGE_STRING, STRLITLEN( PACKAGE_STRING ) );
+  hash = fnv1a( hash, &opt_lazy_typedefs, sizeof opt_lazy_typedefs );
+  hash = fnv1a( hash, &opt_predef_types, sizeof opt_predef_types );
+
+  FOREACH_ARRAY_ELEMENT( predef_set_t, set, PREDEFINED_SETS ) {
+    if ( opt_predef_types < set->min_predef || predef_set_is_lazy( set ) )
+      continue;
+    hash = fnv1a( hash, &set->lang_ids, sizeof set->lang_ids );
+    hash = fnv1a( hash, &set->parse_lang_id, sizeof set->parse_lang_id );
+    for ( predef_type_t const *pt = set->types; pt->str != NULL; ++pt )
+      hash = fnv1a( hash, pt->str, strlen( pt->str ) + 1/*\0*/ );
   } // for
+
+  return hash;
 }
 
 /**
- * Red-black tree visitor function that forwards to the \ref
- * c_typedef_visit_fn_t function.
+ * Reads a predefined types image file, if it exists and is still valid, and
+ * defines its types instead of parsing them.
+ *
+ * @param path The path of the predefined types image file.
+ * @param key The key the image must have as returned by predef_image_key().
+ * @return Returns `true` only if all the types were defined.  If not, none
+ * are.
  *
- * @param node_data A pointer to the node's data.
- * @param visit_data Data passed to to the visitor.
- * @return Returning `true` will cause traversal to stop and the current node
- * to be returned to the caller of rb_tree_visit().
+ * @sa predef_image_write()
  */
 NODISCARD
-static bool rb_visitor( void *node_data, void *visit_data ) {
-  assert( node_data != NULL );
-  assert( visit_data != NULL );
+static bool predef_image_read( char const *path, uint64_t key ) {
+  assert( path != NULL );
+
+  FILE *const file = fopen( path, "r" );
+  if ( file == NULL )
+    return false;
+
+  char *line = NULL;
+  size_t line_cap = 0;
+  rb_node_t **nodes = NULL;
+  size_t added = 0, tdef_count = 0;
+  bool ok = false;
+  uint64_t file_key;
+
+  if ( getline( &line, &line_cap, file ) == -1 ||
+       strcmp( line, PREDEF_IMAGE_MAGIC ) != 0 ||
+       getline( &line, &line_cap, file ) == -1 ||
+       sscanf( line, "// key %" SCNx64, &file_key ) != 1 ||
+       file_key != key ||
+       getline( &line, &line_cap, file ) == -1 ||
+       sscanf( line, "// types %zu", &tdef_count ) != 1 ||
+       tdef_count == 0 ) {
+    goto done;
+  }
+
+  nodes = MALLOC( rb_node_t*, tdef_count );
+  for ( ; added < tdef_count; ++added ) {
+    unsigned lang_ids, decl_flags;
+    int ast_pos = 0;
+    if ( getline( &line, &line_cap, file ) == -1 ||
+         sscanf( line, "%x %x %n", &lang_ids, &decl_flags, &ast_pos ) != 2 ||
+         ast_pos == 0 || lang_ids == LANG_NONE ||
+         !is_1_bit_only_in_set( decl_flags, C_TYPE_DECL_ANY ) ) {
+      break;
+    }
+
+    char const *s = line + ast_pos;
+    c_ast_t *const ast = c_ast_load( &s, &predef_ast_arena );
+    if ( ast == NULL || *s != '\n' || c_sname_empty( &ast->sname ) )
+      break;
+
+    // Setting predef_lang_ids makes c_typedef_init() mark the type predefined.
+    predef_lang_ids = lang_ids;
+    rb_node_t *const node =
+      c_typedef_add( ast, STATIC_CAST( decl_flags_t, decl_flags ) );
+    c_typedef_t const *const tdef = RB_DINT( node );
+    if ( tdef->ast != ast )             // type was already defined
+      break;
+    nodes[ added ] = node;
+  } // for
 
-  c_typedef_t const *const tdef = node_data;
-  tdef_rb_visit_data_t const *const trvd = visit_data;
+  ok = added == tdef_count && getline( &line, &line_cap, file ) == -1;
 
-  return (*trvd->visit_fn)( tdef, trvd->visit_data );
+done:
+  if ( ok ) {
+    c_ast_arena_keep( &predef_ast_arena );
+  }
+  else {
+    while ( added > 0 )
+      c_typedef_remove( nodes[ --added ] );
+    c_ast_arena_cleanup( &predef_ast_arena );
+  }
+
+  FREE( nodes );
+  FREE( line );
+  fclose( file );
+  return ok;
 }
 
-////////// extern functions ///////////////////////////////////////////////////
+/**
+ * Compares two \ref c_typedef pointers by the order in which they were
+ * defined.
+ *
+ * @param i_tdef A pointer to the first \ref c_typedef pointer.
+ * @param j_tdef A pointer to the second \ref c_typedef pointer.
+ * @return Returns a number less than 0, 0, or greater than 0 if the type
+ * pointed to by \a i_tdef was defined before, at the same time as, or after
+ * that pointed to by \a j_tdef, respectively.
+ */
+NODISCARD
+static int predef_image_tdef_cmp( c_typedef_t const *const *i_tdef,
+                                  c_typedef_t const *const *j_tdef ) {
+  unsigned const i_order = (*i_tdef)->def_order;
+  unsigned const j_order = (*j_tdef)->def_order;
+  return (i_order > j_order) - (i_order < j_order);
+}
 
-rb_node_t* c_typedef_add( c_ast_t const *ast, decl_flags_t decl_flags ) {
-  assert( ast != NULL );
-  assert( !c_sname_empty( &ast->sname ) );
+/**
+ * Writes a predefined types image file of every type defined so far, each
+ * saved via c_ast_save() in the order in which it was defined so every type
+ * it refers to precedes it.
+ *
+ * @param path The path of the predefined types image file.
+ * @param key The key of the image as returned by predef_image_key().
+ *
+ * @note Since the image is only a cache, errors are silently ignored.
+ *
+ * @sa predef_image_read()
+ */
+static void predef_image_write( char const *path, uint64_t key ) {
+  assert( path != NULL );
+
+  size_t tdef_count = 0;
+  rb_iterator_t iter;
+  rb_iterator_init( &tdef_base.set, &iter );
+  while ( rb_iterator_next( &iter ) != NULL )
+    ++tdef_count;
+  if ( tdef_count == 0 )
+    return;
+
+  c_typedef_t const **const tdefs = MALLOC( c_typedef_t const*, tdef_count );
+  rb_iterator_init( &tdef_base.set, &iter );
+  for ( size_t i = 0; i < tdef_count; ++i )
+    tdefs[i] = rb_iterator_next( &iter );
+  qsort(
+    tdefs, tdef_count, sizeof tdefs[0],
+    POINTER_CAST( qsort_cmp_fn_t, &predef_image_tdef_cmp )
+  );
 
-  c_typedef_t tdef;
-  c_typedef_init( &tdef, ast, decl_flags );
-  return rb_tree_insert( &typedef_set, &tdef, sizeof tdef ).node;
+  strbuf_t sbuf, tmp_path;
+  strbuf_init( &sbuf );
+  strbuf_init( &tmp_path );
+
+  strbuf_puts( &sbuf, PREDEF_IMAGE_MAGIC );
+  strbuf_printf( &sbuf, "// key %" PRIx64 "\n", key );
+  strbuf_printf( &sbuf, "// types %zu\n", tdef_count );
+  for ( size_t i = 0; i < tdef_count; ++i ) {
+    c_typedef_t const *const tdef = tdefs[i];
+    strbuf_printf( &sbuf,
+      "%x %x ",
+      STATIC_CAST( unsigned, tdef->lang_ids ),
+      STATIC_CAST( unsigned, tdef->decl_flags )
+    );
+    if ( !c_ast_save( tdef->ast, &sbuf ) )
+      goto done;
+    strbuf_putc( &sbuf, '\n' );
+  } // for
+
+  //
+  // Write to a temporary file first and rename it so a reader never sees a
+  // partially written image.
+  //
+  strbuf_printf( &tmp_path, "%s.%ld", path, STATIC_CAST( long, getpid() ) );
+
+  FILE *const file = fopen( tmp_path.str, "w" );
+  if ( file != NULL ) {
+    bool const ok = fwrite( sbuf.str, 1, sbuf.len, file ) == sbuf.len;
+    if ( fclose( file ) == 0 && ok && rename( tmp_path.str, path ) == 0 )
+      goto done;
+    PJL_DISCARD_RV( unlink( tmp_path.str ) );
+  }
+
+done:
+  strbuf_cleanup( &tmp_path );
+  strbuf_cleanup( &sbuf );
+  FREE( tdefs );
 }
 
-c_typedef_t const* c_typedef_find_name( char const *name ) {
+/**
+ * Defines a lazy predefined type, if it hasn't been defined already.
+ *
+ * @param pl The \ref predef_lazy to define.
+ */
+static void predef_lazy_define( predef_lazy_t *pl ) {
+  assert( pl != NULL );
+  if ( pl->is_defined )
+    return;
+
+  //
+  // Mark the type as defined first since parsing it also calls
+  // c_typedefs_define_lazy() for its own declaration that includes its own
+  // name.
+  //
+  pl->is_defined = true;
+  --predef_lazy_undef;
+
+  predef_state_t ps;
+  predef_state_begin( &ps );
+  opt_lang_id = pl->set->parse_lang_id;
+  predef_lang_ids = pl->set->lang_ids;
+  parse_predef_type( pl->pt );
+  predef_state_end( &ps );
+}
+
+/**
+ * Finds the first lazy predefined type in \ref predef_lazy_index having \a
+ * name.
+ *
+ * @param name The name to find.  It need not be null-terminated.
+ * @param name_len The length of \a name.
+ * @return Returns the index into \ref predef_lazy_index of the first lazy
+ * predefined type having \a name or \ref predef_lazy_len if none.
+ */
+NODISCARD
+static size_t predef_lazy_find( char const *name, size_t name_len ) {
   assert( name != NULL );
-  c_sname_t sname;
-  if ( c_sname_parse( name, &sname ) ) {
-    c_typedef_t const *const tdef = c_typedef_find_sname( &sname );
-    c_sname_cleanup( &sname );
-    return tdef;
+
+  size_t lo = 0, hi = predef_lazy_len;
+  while ( lo < hi ) {
+    size_t const mid = lo + (hi - lo) / 2;
+    predef_lazy_t const *const pl = predef_lazy_index[ mid ];
+    if ( predef_name_cmp( pl->name, pl->name_len, name, name_len ) < 0 )
+      lo = mid + 1;
+    else
+      hi = mid;
+  } // while
+
+  if ( lo < predef_lazy_len ) {
+    predef_lazy_t const *const pl = predef_lazy_index[ lo ];
+    if ( predef_name_cmp( pl->name, pl->name_len, name, name_len ) == 0 )
+      return lo;
   }
-  return NULL;                          // LCOV_EXCL_LINE
+  return predef_lazy_len;
 }
 
-c_typedef_t const* c_typedef_find_sname( c_sname_t const *sname ) {
-  assert( sname != NULL );
-  c_typedef_t const tdef = { .ast = &(c_ast_t const){ .sname = *sname } };
-  rb_node_t const *const found_rb = rb_tree_find( &typedef_set, &tdef );
-  return found_rb != NULL ? RB_DINT( found_rb ) : NULL;
+/**
+ * Compares two pointers to \ref predef_lazy by name; lazy predefined types
+ * having the same name are ordered by definition order.
+ *
+ * @param i_ppl A pointer to the pointer to the first \ref predef_lazy.
+ * @param j_ppl A pointer to the pointer to the second \ref predef_lazy.
+ * @return Returns a number less than 0, 0, or greater than 0 if \a i_ppl is
+ * less than, equal to, or greater than \a j_ppl, respectively.
+ */
+NODISCARD
+static int predef_lazy_cmp( predef_lazy_t const *const *i_ppl,
+                            predef_lazy_t const *const *j_ppl ) {
+  predef_lazy_t const *const i_pl = *i_ppl;
+  predef_lazy_t const *const j_pl = *j_ppl;
+  int const cmp =
+    predef_name_cmp( i_pl->name, i_pl->name_len, j_pl->name, j_pl->name_len );
+  return cmp != 0 ? cmp : (i_pl > j_pl) - (i_pl < j_pl);
 }
 
-void c_typedef_remove( rb_node_t *node ) {
-  rb_tree_delete( &typedef_set, node );
+/**
+ * Initializes the lazy predefined types: rather than being parsed, each is
+ * only added to an index by its name.
+ *
+ * @sa #opt_lazy_typedefs
+ */
+static void predef_lazy_init( void ) {
+  FOREACH_ARRAY_ELEMENT( predef_set_t, set, PREDEFINED_SETS ) {
+    if ( predef_set_is_lazy( set ) ) {
+      for ( predef_type_t const *pt = set->types; pt->str != NULL; ++pt )
+        ++predef_lazy_len;
+    }
+  } // for
+
+  predef_lazy = MALLOC( predef_lazy_t, predef_lazy_len );
+  predef_lazy_index = MALLOC( predef_lazy_t*, predef_lazy_len );
+
+  predef_lazy_t *pl = predef_lazy;
+  FOREACH_ARRAY_ELEMENT( predef_set_t, set, PREDEFINED_SETS ) {
+    if ( !predef_set_is_lazy( set ) )
+      continue;
+    for ( predef_type_t const *pt = set->types; pt->str != NULL; ++pt ) {
+      *pl = (predef_lazy_t){ .pt = pt, .set = set };
+      pl->name = predef_type_name( pt->str, &pl->name_len );
+      predef_lazy_index[ pl - predef_lazy ] = pl;
+      ++pl;
+    } // for
+  } // for
+
+  qsort(
+    predef_lazy_index, predef_lazy_len, sizeof predef_lazy_index[0],
+    POINTER_CAST( qsort_cmp_fn_t, &predef_lazy_cmp )
+  );
+
+  predef_lazy_undef = predef_lazy_len;
 }
 
-void c_typedef_visit( c_typedef_visit_fn_t visit_fn, void *visit_data ) {
-  assert( visit_fn != NULL );
-  tdef_rb_visit_data_t trvd = { visit_fn, visit_data };
-  rb_tree_visit( &typedef_set, &rb_visitor, &trvd );
+/**
+ * Gets the scoped name of a lazy predefined type.
+ *
+ * @param pl The \ref predef_lazy to get the scoped name of.
+ * @param sbuf The \ref strbuf to use.
+ * @return Returns said name.
+ */
+NODISCARD
+static char const* predef_lazy_sname( predef_lazy_t const *pl,
+                                      strbuf_t *sbuf ) {
+  assert( pl != NULL );
+  assert( sbuf != NULL );
+
+  strbuf_reset( sbuf );
+  bool sep = false;
+
+  //
+  // Every identifier preceding the type's name that's followed by either "::"
+  // or "{" names a namespace or class the type is declared within, e.g.:
+  //
+  //      namespace std { class ios_base { using fmtflags = unsigned; }; }
+  //
+  char const *s = pl->pt->str;
+  for ( size_t ident_len;; ) {
+    char const *const ident = next_ident( &s, pl->name, &ident_len );
+    if ( ident == NULL )
+      break;
+    SKIP_WS( s );
+    if ( (s[0] == ':' && s[1] == ':') || s[0] == '{' )
+      strbuf_sepsn_putsn( sbuf, "::", 2, &sep, ident, ident_len );
+  } // for
+
+  strbuf_sepsn_putsn( sbuf, "::", 2, &sep, pl->name, pl->name_len );
+  return sbuf->str;
 }
 
-void c_typedefs_init( void ) {
-  ASSERT_RUN_ONCE();
+/**
+ * Compares two names that need not be null-terminated.
+ *
+ * @param i_name The first name.
+ * @param i_len The length of \a i_name.
+ * @param j_name The second name.
+ * @param j_len The length of \a j_name.
+ * @return Returns a number less than 0, 0, or greater than 0 if \a i_name is
+ * less than, equal to, or greater than \a j_name, respectively.
+ */
+NODISCARD
+static int predef_name_cmp( char const *i_name, size_t i_len,
+                            char const *j_name, size_t j_len ) {
+  int const cmp = strncmp( i_name, j_name, i_len < j_len ? i_len : j_len );
+  return cmp != 0 ? cmp : (i_len > j_len) - (i_len < j_len);
+}
 
-  rb_tree_init(
-    &typedef_set, RB_DINT, POINTER_CAST( rb_cmp_fn_t, &c_typedef_cmp )
-  );
-  ATEXIT( &c_typedefs_cleanup );
+/**
+ * Checks whether the types in \a set are defined lazily.
+ *
+ * @param set The \ref predef_set to check.
+ * @return Returns `true` only if the types in \a set are defined lazily.
+ *
+ * @sa #opt_lazy_typedefs
+ */
+NODISCARD
+static bool predef_set_is_lazy( predef_set_t const *set ) {
+  assert( set != NULL );
+  //
+  // Required types are always defined eagerly since some are looked up
+  // directly by name and not via any command.
+  //
+  return  opt_lazy_typedefs &&
+          set->min_predef == PREDEF_TYPES_ALL &&
+          opt_predef_types >= set->min_predef;
+}
 
+/**
+ * Saves global state and sets it for predefining types.
+ *
+ * @param ps The \ref predef_state to save the current state into.
+ *
+ * @sa predef_state_end()
+ */
+static void predef_state_begin( predef_state_t *ps ) {
+  assert( ps != NULL );
+
+  *ps = (predef_state_t){
 #ifdef ENABLE_BISON_DEBUG
+    .bison_debug = opt_bison_debug,
+#endif /* ENABLE_BISON_DEBUG */
+    .cdecl_debug = opt_cdecl_debug,
+    .echo_commands = opt_echo_commands,
+#ifdef ENABLE_FLEX_DEBUG
+    .flex_debug = opt_flex_debug,
+#endif /* ENABLE_FLEX_DEBUG */
+    .input_path = cdecl_input_path,
+    .is_initialized = cdecl_is_initialized,
+    .lang_id = opt_lang_id,
+    .lineno = yylineno,
+    .predef_lang_ids = predef_lang_ids
+  };
+
   //
-  // Temporarily turn off Bison debug output for built-in typedefs.
+  // Temporarily turn off debug output for predefined types.
   //
-  int const orig_bison_debug = opt_bison_debug;
+#ifdef ENABLE_BISON_DEBUG
   opt_bison_debug = false;
 #endif /* ENABLE_BISON_DEBUG */
-  //
-  // Temporarily turn off debug output for built-in typedefs.
-  //
-  cdecl_debug_t const orig_cdecl_debug = opt_cdecl_debug;
   opt_cdecl_debug = CDECL_DEBUG_NO;
 #ifdef ENABLE_FLEX_DEBUG
-  //
-  // Temporarily turn off Flex debug output for built-in typedefs.
-  //
-  int const orig_flex_debug = opt_flex_debug;
   opt_flex_debug = false;
 #endif /* ENABLE_FLEX_DEBUG */
 
@@ -1213,94 +1841,520 @@ void c_typedefs_init( void ) {
   // Doing this requires that we also temporarily turn off command echoing.
   //
   cdecl_input_path = __FILE__;
-  bool const orig_echo_commands = opt_echo_commands;
   opt_echo_commands = false;
 
-  c_lang_id_t const orig_lang_id = opt_lang_id;
+  //
+  // Predefined types may be defined lazily after initialization, but they
+  // must be parsed as if during initialization, e.g., without warnings.
+  //
+  cdecl_is_initialized = false;
+}
+
+/**
+ * Restores global state saved by predef_state_begin().
+ *
+ * @param ps The \ref predef_state to restore the state from.
+ *
+ * @sa predef_state_begin()
+ */
+static void predef_state_end( predef_state_t const *ps ) {
+  assert( ps != NULL );
 
-  if ( opt_predef_types == PREDEF_TYPES_ALL ) {
+#ifdef ENABLE_BISON_DEBUG
+  opt_bison_debug = ps->bison_debug;
+#endif /* ENABLE_BISON_DEBUG */
+  opt_cdecl_debug = ps->cdecl_debug;
+  opt_echo_commands = ps->echo_commands;
+#ifdef ENABLE_FLEX_DEBUG
+  opt_flex_debug = ps->flex_debug;
+#endif /* ENABLE_FLEX_DEBUG */
+  cdecl_input_path = ps->input_path;
+  cdecl_is_initialized = ps->is_initialized;
+  opt_lang_id = ps->lang_id;
+  yylineno = ps->lineno;
+  predef_lang_ids = ps->predef_lang_ids;
+}
+
+/**
+ * Gets the (local) name of the type a predefined type declaration declares.
+ *
+ * @param s The predefined type declaration.
+ * @param pname_len A pointer to receive the length of the name.
+ * @return Returns a pointer to the name within \a s.
+ */
+NODISCARD
+static char const* predef_type_name( char const *s, size_t *pname_len ) {
+  assert( s != NULL );
+  assert( pname_len != NULL );
+
+  char const *name = NULL;
+  bool next_is_name = false;
+
+  for (;;) {
+    while ( *s != '\0' && !is_ident_first( *s ) ) {
+      //
+      // For a pointer to function type, the name follows "(*", e.g.:
+      //
+      //      typedef void (*sighandler_t)(int)
+      //
+      if ( s[0] == '(' && s[1] == '*' )
+        next_is_name = true;
+      ++s;
+    } // while
+    if ( *s == '\0' )
+      break;
+
+    name = s;
+    SKIP_CHARS( s, IDENT_CHARS );
+    *pname_len = STATIC_CAST( size_t, s - name );
+
+    //
+    // For "using", the name follows it, e.g.:
+    //
+    //      namespace std { using size_t = unsigned long; }
+    //
+    // Otherwise, the name is the last identifier, e.g.:
     //
-    // Temporarily switch to the latest supported version of C so all keywords
-    // will be available.
+    //      typedef int jmp_buf[37]
     //
-    opt_lang_id = LANG_C_NEW;
+    if ( next_is_name )
+      break;
+    next_is_name = *pname_len == STRLITLEN( "using" ) &&
+                   STRNCMPLIT( name, "using" ) == 0;
+  } // for
 
-    predef_lang_ids = LANG_MIN(C_KNR);
-    parse_predef_types( PREDEFINED_KNR_C );
+  assert( name != NULL );
+  return name;
+}
 
-    predef_lang_ids = LANG_MIN(C_89);
-    parse_predef_types( PREDEFINED_STD_C_89 );
-    parse_predef_types( PREDEFINED_FLOATING_POINT_EXTENSIONS );
-    parse_predef_types( PREDEFINED_GNU_C );
+/**
+ * Finds the node of the type for \a sname in all layers.
+ *
+ * @param sname The scoped name of the type to find.
+ * @param hash The hash code of \a sname.
+ * @return Returns said node or NULL if not found.
+ */
+NODISCARD
+static rb_node_t* tdef_find( c_sname_t const *sname, size_t hash ) {
+  if ( tdef_top != &tdef_base ) {
+    rb_node_t *const found_rb =
+      tdef_index_lookup( &tdef_top->index, sname, hash );
+    if ( found_rb != NULL )
+      return found_rb;
+  }
+  return tdef_index_lookup( &tdef_base.index, sname, hash );
+}
 
-    predef_lang_ids = LANG_MIN(C_95);
-    parse_predef_types( PREDEFINED_STD_C_95 );
-    parse_predef_types( PREDEFINED_PTHREAD_H );
-    parse_predef_types( PREDEFINED_WIN32 );
+/**
+ * Adds \a rb_node to \a ti, growing it if necessary.
+ *
+ * @param ti The \ref tdef_index to add to.
+ * @param rb_node The \ref rb_node of the type to add.
+ * @param hash The hash code of the name of the type of \a rb_node.
+ */
+static void tdef_index_add( tdef_index_t *ti, rb_node_t *rb_node,
+                            size_t hash ) {
+  assert( ti != NULL );
+  assert( rb_node != NULL );
+
+  if ( (ti->len + 1) * 2 > ti->cap ) {
+    // Keep the load factor at most 1/2 so probe sequences remain short.
+    tdef_index_entry_t *const old_entries = ti->entries;
+    size_t const old_cap = ti->cap;
+    ti->cap = old_cap == 0 ? TDEF_INDEX_CAP_MIN : old_cap * 2;
+    ti->entries = MALLOC( tdef_index_entry_t, ti->cap );
+    memset( ti->entries, 0, ti->cap * sizeof ti->entries[0] );
+    for ( size_t i = 0; i < old_cap; ++i ) {
+      tdef_index_entry_t const *const old_entry = &old_entries[i];
+      if ( old_entry->rb_node == NULL )
+        continue;
+      size_t j = old_entry->hash & (ti->cap - 1);
+      while ( ti->entries[j].rb_node != NULL )
+        j = (j + 1) & (ti->cap - 1);
+      ti->entries[j] = *old_entry;
+    } // for
+    FREE( old_entries );
+  }
 
-    predef_lang_ids = LANG_MIN(C_99);
-    parse_predef_types( PREDEFINED_STD_C_99 );
+  c_typedef_t const *const tdef = RB_DINT( rb_node );
+  tdef_index_entry_t *const entry =
+    tdef_index_find( ti, &tdef->ast->sname, hash );
+  assert( entry->rb_node == NULL );
+  *entry = (tdef_index_entry_t){ .hash = hash, .rb_node = rb_node };
+  ++ti->len;
+}
 
-    // However, Embedded C extensions are available only in C99.
-    opt_lang_id = LANG_C_99;
-    predef_lang_ids = LANG_C_99;
-    parse_predef_types( PREDEFINED_EMBEDDED_C );
-    opt_lang_id = LANG_C_NEW;
+/**
+ * Cleans-up all memory associated with \a ti but does _not_ free \a ti
+ * itself.
+ *
+ * @param ti The \ref tdef_index to clean up.
+ */
+static void tdef_index_cleanup( tdef_index_t *ti ) {
+  assert( ti != NULL );
+  FREE( ti->entries );
+  *ti = (tdef_index_t){ 0 };
+}
 
-    // Must be defined after C99.
-    predef_lang_ids = LANG_MIN(C_89);
-    parse_predef_types( PREDEFINED_MISC );
+/**
+ * Finds the entry in \a ti for \a sname.
+ *
+ * @remarks A \ref tdef_index uses open addressing with linear probing.  Since
+ * the hash code of every entry is compared first, c_sname_cmp() is called
+ * essentially only for the entry for \a sname, if any; hence, the common case
+ * of a name that isn't a type is fast.
+ *
+ * @param ti The \ref tdef_index to search.  Its capacity must be &gt; 0.
+ * @param sname The scoped name of the type to find.
+ * @param hash The hash code of \a sname.
+ * @return Returns a pointer to either the entry for \a sname or the empty
+ * entry where it would be added.
+ *
+ * @sa tdef_index_lookup()
+ */
+NODISCARD
+static tdef_index_entry_t* tdef_index_find( tdef_index_t const *ti,
+                                            c_sname_t const *sname,
+                                            size_t hash ) {
+  assert( ti != NULL );
+  assert( sname != NULL );
+  assert( ti->cap > 0 );
+
+  for ( size_t i = hash & (ti->cap - 1);; i = (i + 1) & (ti->cap - 1) ) {
+    tdef_index_entry_t *const entry = &ti->entries[i];
+    if ( entry->rb_node == NULL )
+      return entry;
+    if ( entry->hash == hash ) {
+      c_typedef_t const *const tdef = RB_DINT( entry->rb_node );
+      if ( c_sname_cmp( &tdef->ast->sname, sname ) == 0 )
+        return entry;
+    }
+  } // for
+}
 
-    predef_lang_ids = LANG_MIN(C_11);
-    parse_predef_types( PREDEFINED_STD_C_11 );
+/**
+ * Looks up the node of the type for \a sname in \a ti.
+ *
+ * @param ti The \ref tdef_index to search.  It may be empty.
+ * @param sname The scoped name of the type to find.
+ * @param hash The hash code of \a sname.
+ * @return Returns said node or NULL if not found.
+ *
+ * @sa tdef_index_find()
+ */
+NODISCARD
+static rb_node_t* tdef_index_lookup( tdef_index_t const *ti,
+                                     c_sname_t const *sname, size_t hash ) {
+  assert( ti != NULL );
+  return ti->len > 0 ? tdef_index_find( ti, sname, hash )->rb_node : NULL;
+}
 
-    predef_lang_ids = LANG_MIN(C_23);
-    parse_predef_types( PREDEFINED_STD_C_23 );
-  }
+/**
+ * Removes \a rb_node from \a ti.
+ *
+ * @param ti The \ref tdef_index to remove from.
+ * @param rb_node The \ref rb_node of the type to remove.
+ * @param hash The hash code of the name of the type of \a rb_node.
+ */
+static void tdef_index_remove( tdef_index_t *ti, rb_node_t const *rb_node,
+                               size_t hash ) {
+  assert( ti != NULL );
+  assert( rb_node != NULL );
+
+  c_typedef_t const *const tdef = RB_DINT( rb_node );
+  tdef_index_entry_t *const entry =
+    tdef_index_find( ti, &tdef->ast->sname, hash );
+  assert( entry->rb_node == rb_node );
 
   //
-  // Temporarily switch to the latest supported version of C++ so all keywords
-  // will be available.
+  // Rather than leaving a "tombstone," shift subsequent entries in the same
+  // probe sequence back so that no lookup is terminated early by the hole.
   //
-  opt_lang_id = LANG_CPP_NEW;
+  size_t const mask = ti->cap - 1;
+  size_t hole = STATIC_CAST( size_t, entry - ti->entries );
+  for ( size_t i = (hole + 1) & mask; ti->entries[i].rb_node != NULL;
+        i = (i + 1) & mask ) {
+    size_t const home = ti->entries[i].hash & mask;
+    // Move the entry only if its home isn't cyclically within (hole, i].
+    if ( ((i - home) & mask) >= ((i - hole) & mask) ) {
+      ti->entries[ hole ] = ti->entries[i];
+      hole = i;
+    }
+  } // for
+  ti->entries[ hole ] = (tdef_index_entry_t){ 0 };
+  --ti->len;
+}
+
+/**
+ * Initializes \a iter to iterate over \a set starting at the first type whose
+ * name has the literal prefix of \a sglob, if any.
+ *
+ * @param set The set of types to iterate over.
+ * @param sglob The scoped glob whose literal prefix to start at or NULL to
+ * start at the first type.
+ * @param iter The \ref rb_iterator to initialize.
+ *
+ * @sa tdef_iter_next()
+ */
+static void tdef_iter_init( rb_tree_t const *set, c_sglob_t const *sglob,
+                            rb_iterator_t *iter ) {
+  if ( sglob == NULL ) {
+    rb_iterator_init( set, iter );
+    return;
+  }
+  rb_iterator_init_lower(
+    set, iter, POINTER_CAST( rb_cmp_fn_t, &c_typedef_sglob_cmp ), sglob
+  );
+}
 
-  if ( opt_predef_types == PREDEF_TYPES_ALL ) {
-    predef_lang_ids = LANG_MIN(CPP_OLD);
-    parse_predef_types( PREDEFINED_STD_CPP );
+/**
+ * Iterates to the next type, if any.
+ *
+ * @param iter The \ref rb_iterator to use.
+ * @param sglob The scoped glob given to tdef_iter_init(), if any.
+ * @return Returns a pointer to the next \ref c_typedef or NULL if there are no
+ * more types or the next type's name doesn't have the literal prefix of \a
+ * sglob.
+ *
+ * @sa tdef_iter_init()
+ */
+NODISCARD
+static c_typedef_t const* tdef_iter_next( rb_iterator_t *iter,
+                                          c_sglob_t const *sglob ) {
+  c_typedef_t const *const tdef = rb_iterator_next( iter );
+  if ( tdef == NULL || sglob == NULL ||
+       c_typedef_sglob_cmp( sglob, tdef ) == 0 ) {
+    return tdef;
+  }
+  return NULL;
+}
 
-    predef_lang_ids = LANG_MIN(CPP_11);
-    parse_predef_types( PREDEFINED_STD_CPP_11 );
+/**
+ * Visits, in order, all types in all layers or only those matching \a sglob.
+ *
+ * @remarks If \a sglob doesn't match in any scope, all the types it can
+ * possibly match have names having its literal prefix, e.g., `std::chrono::`
+ * for `std::chrono::*` or `pthread_` for `pthread_*`, and so are contiguous;
+ * hence, only those types are iterated over.
+ *
+ * @param sglob The scoped glob to match or NULL for all.  If not NULL, it
+ * must not be empty.
+ * @param visit_fn The visitor function to use.
+ * @param visit_data Optional data passed to \a visit_fn.
+ */
+static void tdef_visit( c_sglob_t const *sglob, c_typedef_visit_fn_t visit_fn,
+                        void *visit_data ) {
+  assert( visit_fn != NULL );
+
+  c_sglob_t const *const range_sglob =
+    sglob != NULL && !sglob->match_in_any_scope ? sglob : NULL;
+
+  //
+  // Merge the types of both layers in order.  Since a type is added only if
+  // it's not in either layer, no type is ever in both.
+  //
+  rb_iterator_t base_iter, top_iter;
+  tdef_iter_init( &tdef_base.set, range_sglob, &base_iter );
+  tdef_iter_init( &tdef_overlay.set, range_sglob, &top_iter );
+  c_typedef_t const *base_tdef = tdef_iter_next( &base_iter, range_sglob );
+  c_typedef_t const *top_tdef = tdef_iter_next( &top_iter, range_sglob );
+
+  while ( base_tdef != NULL || top_tdef != NULL ) {
+    c_typedef_t const *tdef;
+    if ( top_tdef == NULL ||
+         (base_tdef != NULL && c_typedef_cmp( base_tdef, top_tdef ) < 0) ) {
+      tdef = base_tdef;
+      base_tdef = tdef_iter_next( &base_iter, range_sglob );
+    }
+    else {
+      tdef = top_tdef;
+      top_tdef = tdef_iter_next( &top_iter, range_sglob );
+    }
+    if ( sglob != NULL && !c_sname_match( &tdef->ast->sname, sglob ) )
+      continue;
+    if ( (*visit_fn)( tdef, visit_data ) )
+      break;
+  } // while
+}
+
+////////// extern functions ///////////////////////////////////////////////////
 
-    predef_lang_ids = LANG_MIN(CPP_17);
-    parse_predef_types( PREDEFINED_STD_CPP_17 );
+rb_node_t* c_typedef_add( c_ast_t const *ast, decl_flags_t decl_flags ) {
+  assert( ast != NULL );
+  assert( !c_sname_empty( &ast->sname ) );
 
-    predef_lang_ids = LANG_MIN(CPP_20);
-    parse_predef_types( PREDEFINED_STD_CPP_20 );
+  size_t const hash = c_sname_hash( &ast->sname );
+  rb_node_t *const found_rb = tdef_find( &ast->sname, hash );
+  if ( found_rb != NULL )
+    return found_rb;
 
-    predef_lang_ids = LANG_MIN(CPP_23);
-    parse_predef_types( PREDEFINED_STD_CPP_23 );
+  c_typedef_t tdef;
+  c_typedef_init( &tdef, ast, decl_flags );
+  rb_insert_rv_t const rv_rbi =
+    rb_tree_insert( &tdef_top->set, &tdef, sizeof tdef );
+  assert( rv_rbi.inserted );
+  tdef_index_add( &tdef_top->index, rv_rbi.node, hash );
+  ++tdef_gen;
+  return rv_rbi.node;
+}
 
-    predef_lang_ids = LANG_MIN(CPP_26);
-    parse_predef_types( PREDEFINED_STD_CPP_26 );
+c_typedef_t const* c_typedef_find_name( char const *name ) {
+  assert( name != NULL );
+  if ( strchr( name, ':' ) == NULL ) {  // don't parse an unscoped name
+    //
+    // Every name in the scoped name of a type is interned, so a name that
+    // isn't can't be that of a type.  Otherwise, using the interned copy lets
+    // c_scope_data_cmp() compare names by pointer.
+    //
+    char const *const iname = intern_str_find( name );
+    return iname == NULL ? NULL :
+      c_typedef_find_sname( &C_SNAME_LIT( iname ) );
   }
+  c_sname_t sname;
+  if ( c_sname_parse( name, &sname ) ) {
+    c_typedef_t const *const tdef = c_typedef_find_sname( &sname );
+    c_sname_cleanup( &sname );
+    return tdef;
+  }
+  return NULL;                          // LCOV_EXCL_LINE
+}
+
+c_typedef_t const* c_typedef_find_sname( c_sname_t const *sname ) {
+  assert( sname != NULL );
+  rb_node_t const *const found_rb = tdef_find( sname, c_sname_hash( sname ) );
+  return found_rb != NULL ? RB_DINT( found_rb ) : NULL;
+}
 
-  if ( opt_predef_types != PREDEF_TYPES_NONE ) {
-    predef_lang_ids = LANG_MIN(CPP_20);
-    parse_predef_types( PREDEFINED_STD_CPP_20_REQUIRED );
-    predef_lang_ids = LANG_NONE;
+void c_typedef_remove( rb_node_t *node ) {
+  assert( node != NULL );
+
+  c_typedef_t const *const tdef = RB_DINT( node );
+  size_t const hash = c_sname_hash( &tdef->ast->sname );
+
+  // A type in the frozen base layer can't be removed.
+  assert( tdef_index_lookup( &tdef_top->index, &tdef->ast->sname, hash ) ==
+          node );
+
+  tdef_index_remove( &tdef_top->index, node, hash );
+  rb_tree_delete( &tdef_top->set, node );
+  ++tdef_gen;
+}
+
+void c_typedef_visit( c_typedef_visit_fn_t visit_fn, void *visit_data ) {
+  tdef_visit( /*sglob=*/NULL, visit_fn, visit_data );
+}
+
+void c_typedef_visit_lazy( c_typedef_lazy_visit_fn_t visit_fn,
+                           void *visit_data ) {
+  assert( visit_fn != NULL );
+  if ( predef_lazy_undef == 0 )
+    return;
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+  for ( size_t i = 0; i < predef_lazy_len; ++i ) {
+    predef_lazy_t const *const pl = &predef_lazy[i];
+    if ( !pl->is_defined ) {
+      (*visit_fn)(
+        predef_lazy_sname( pl, &sbuf ), pl->set->lang_ids, visit_data
+      );
+    }
+  } // for
+  strbuf_cleanup( &sbuf );
+}
+
+void c_typedef_visit_sglob( c_sglob_t const *sglob,
+                            c_typedef_visit_fn_t visit_fn, void *visit_data ) {
+  assert( sglob != NULL );
+  tdef_visit( c_sglob_empty( sglob ) ? NULL : sglob, visit_fn, visit_data );
+}
+
+void c_typedefs_define_lazy( char const *s, size_t s_len ) {
+  assert( s != NULL );
+  if ( predef_lazy_undef == 0 )
+    return;
+
+  char const *const end = s + s_len;
+  char const *ident;
+  size_t ident_len;
+
+  //
+  // The "include" command reads commands that don't go through here and the
+  // "show" command may show all types, so both need every type defined.
+  //
+  for ( char const *t = s; (ident = next_ident( &t, end, &ident_len )); ) {
+    if ( predef_name_cmp( ident, ident_len, L_include,
+                          strlen( L_include ) ) == 0 ||
+         predef_name_cmp( ident, ident_len, L_show,
+                          strlen( L_show ) ) == 0 ) {
+      for ( size_t i = 0; i < predef_lazy_len; ++i )
+        predef_lazy_define( &predef_lazy[i] );
+      return;
+    }
+  } // for
+
+  for ( char const *t = s; (ident = next_ident( &t, end, &ident_len )); ) {
+    for ( size_t i = predef_lazy_find( ident, ident_len );
+          i < predef_lazy_len; ++i ) {
+      predef_lazy_t *const pl = predef_lazy_index[i];
+      if ( predef_name_cmp( pl->name, pl->name_len, ident, ident_len ) != 0 )
+        break;
+      predef_lazy_define( pl );
+    } // for
+  } // for
+}
+
+void c_typedefs_freeze( void ) {
+  ASSERT_RUN_ONCE();
+  tdef_top = &tdef_overlay;
+}
+
+unsigned c_typedefs_gen( void ) {
+  return tdef_gen;
+}
+
+void c_typedefs_init( void ) {
+  ASSERT_RUN_ONCE();
+
+  rb_tree_init(
+    &tdef_base.set, RB_DINT, POINTER_CAST( rb_cmp_fn_t, &c_typedef_cmp )
+  );
+  rb_tree_init(
+    &tdef_overlay.set, RB_DINT, POINTER_CAST( rb_cmp_fn_t, &c_typedef_cmp )
+  );
+  ATEXIT( &c_typedefs_cleanup );
+
+  predef_state_t ps;
+  predef_state_begin( &ps );
+
+  //
+  // If there's a cache directory, define the predefined types from an image
+  // of them saved by a previous run, if it's still valid, rather than parsing
+  // them all again.
+  //
+  strbuf_t image_path;
+  strbuf_init( &image_path );
+  bool const has_image =
+    result_cache_dir_path( PREDEF_IMAGE_NAME, &image_path );
+  uint64_t const image_key = has_image ? predef_image_key() : 0;
+
+  if ( !has_image || !predef_image_read( image_path.str, image_key ) ) {
+    FOREACH_ARRAY_ELEMENT( predef_set_t, set, PREDEFINED_SETS ) {
+      if ( opt_predef_types < set->min_predef || predef_set_is_lazy( set ) )
+        continue;
+      opt_lang_id = set->parse_lang_id;
+      predef_lang_ids = set->lang_ids;
+      parse_predef_types( set->types );
+    } // for
+    if ( has_image )
+      predef_image_write( image_path.str, image_key );
   }
 
-#ifdef ENABLE_BISON_DEBUG
-  opt_bison_debug = orig_bison_debug;
-#endif /* ENABLE_BISON_DEBUG */
-  opt_cdecl_debug = orig_cdecl_debug;
-  opt_echo_commands = orig_echo_commands;
-#ifdef ENABLE_FLEX_DEBUG
-  opt_flex_debug = orig_flex_debug;
-#endif /* ENABLE_FLEX_DEBUG */
-  opt_lang_id = orig_lang_id;
+  strbuf_cleanup( &image_path );
+  predef_state_end( &ps );
 
-  cdecl_input_path = NULL;
+  if ( opt_lazy_typedefs )
+    predef_lazy_init();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
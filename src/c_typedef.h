@@ -36,6 +36,7 @@
 
 // standard
 #include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
 
 /// @endcond
 
@@ -65,6 +66,7 @@ struct c_typedef {
   c_lang_id_t     lang_ids;             ///< Language(s) available in.
   decl_flags_t    decl_flags;           ///< How was the type defined?
   bool            is_predefined;        ///< Was the type predefined?
+  unsigned        def_order;            ///< Order defined in (starts at 1).
 };
 
 /**
@@ -79,6 +81,17 @@ struct c_typedef {
 typedef bool (*c_typedef_visit_fn_t)( c_typedef_t const *tdef,
                                       void *visit_data );
 
+/**
+ * The signature for a function passed to c_typedef_visit_lazy().
+ *
+ * @param name The scoped name of the type.  It's valid only during the call.
+ * @param lang_ids The language(s) the type is available in.
+ * @param visit_data Optional data passed to the visitor.
+ */
+typedef void (*c_typedef_lazy_visit_fn_t)( char const *name,
+                                           c_lang_id_t lang_ids,
+                                           void *visit_data );
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -126,7 +139,8 @@ c_typedef_t const* c_typedef_find_sname( c_sname_t const *sname );
 /**
  * Removes a `typedef` (or `using`) from the global set.
  *
- * @param node The rb_node containing the `typedef` to remove.
+ * @param node The rb_node containing the `typedef` to remove.  It must have
+ * been added after c_typedefs_freeze() was called, if it was.
  *
  * @sa c_typedef_add()
  */
@@ -140,6 +154,78 @@ void c_typedef_remove( rb_node_t *node );
  */
 void c_typedef_visit( c_typedef_visit_fn_t visit_fn, void *visit_data );
 
+/**
+ * Does an in-order traversal of only the \ref c_typedef whose names match \a
+ * sglob.
+ *
+ * @remarks Unless \a sglob matches in any scope, only the types whose names
+ * have its literal prefix, e.g., `std::chrono::` for `std::chrono::*`, are
+ * traversed, so this takes time proportional to the number of such types
+ * rather than all types.
+ *
+ * @param sglob The scoped glob to match.  If empty, all types are traversed.
+ * @param visit_fn The visitor function to use.
+ * @param visit_data Optional data passed to \a visit_fn.
+ *
+ * @sa c_typedef_visit()
+ */
+void c_typedef_visit_sglob( c_sglob_t const *sglob,
+                            c_typedef_visit_fn_t visit_fn, void *visit_data );
+
+/**
+ * Visits all predefined types that have not yet been defined because
+ * #opt_lazy_typedefs is set.
+ *
+ * @param visit_fn The visitor function to use.
+ * @param visit_data Optional data passed to \a visit_fn.
+ *
+ * @sa c_typedef_visit()
+ * @sa c_typedefs_define_lazy()
+ */
+void c_typedef_visit_lazy( c_typedef_lazy_visit_fn_t visit_fn,
+                           void *visit_data );
+
+/**
+ * If #opt_lazy_typedefs is set, defines all predefined types not yet defined
+ * whose names are any of the identifiers in \a s.
+ *
+ * @param s The string of one or more **cdecl** commands about to be parsed.
+ * @param s_len The length of \a s.
+ *
+ * @note This must be called _before_ \a s is parsed since the parser is not
+ * reentrant.  If \a s contains either `include` or `show`, all predefined
+ * types are defined.
+ *
+ * @sa c_typedef_visit_lazy()
+ */
+void c_typedefs_define_lazy( char const *s, size_t s_len );
+
+/**
+ * Freezes the set of all types defined so far so that, subsequently, types
+ * added are only layered on top of them: the frozen types are neither removed
+ * nor freed.
+ *
+ * @remarks This should be called once all predefined types and those in the
+ * configuration file have been defined, but before forking processes that may
+ * define types of their own (e.g., server sessions) so that the frozen types
+ * remain shared by all of them via copy-on-write.  Freezing takes constant
+ * time.
+ *
+ * @note This function must be called at most once.
+ */
+void c_typedefs_freeze( void );
+
+/**
+ * Gets the generation of the set of all types, i.e., a number that changes
+ * whenever any type is either added or removed.
+ *
+ * @return Returns said generation.
+ *
+ * @sa p_macros_gen()
+ */
+NODISCARD
+unsigned c_typedefs_gen( void );
+
 /**
  * Initializes all \ref c_typedef data.
  *
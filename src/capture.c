@@ -0,0 +1,156 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/capture.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for capturing everything written to standard output and
+ * standard error.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "capture.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sysexits.h>
+#include <unistd.h>                     /* for dup(), dup2(), lseek(), ... */
+
+/// @endcond
+
+/**
+ * @addtogroup capture-group
+ * @{
+ */
+
+////////// local variables ////////////////////////////////////////////////////
+
+static int  orig_stderr_fd = -1;        ///< Original standard error.
+static int  orig_stdout_fd = -1;        ///< Original standard output.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Restores standard output and standard error.
+ */
+static void capture_cleanup( void ) {
+  FFLUSH( stdout );
+  FFLUSH( stderr );
+  PJL_DISCARD_RV( dup2( orig_stdout_fd, STDOUT_FILENO ) );
+  PJL_DISCARD_RV( dup2( orig_stderr_fd, STDERR_FILENO ) );
+  close( orig_stdout_fd );
+  close( orig_stderr_fd );
+}
+
+/**
+ * Redirects \a fd to a new temporary file.
+ *
+ * @param fd The file descriptor to redirect.
+ * @return Returns a duplicate of the original \a fd.
+ */
+NODISCARD
+static int capture_fd( int fd ) {
+  int const orig_fd = dup( fd );
+  PERROR_EXIT_IF( orig_fd == -1, EX_OSERR );
+  FILE *const tmp_file = tmpfile();
+  PERROR_EXIT_IF( tmp_file == NULL, EX_CANTCREAT );
+  PERROR_EXIT_IF( dup2( fileno( tmp_file ), fd ) == -1, EX_OSERR );
+  fclose( tmp_file );                   // fd still refers to the file
+  return orig_fd;
+}
+
+/**
+ * Appends everything written to \a fd to \a sbuf.
+ *
+ * @param fd The file descriptor to read.
+ * @param sbuf The \ref strbuf to append to.
+ */
+static void capture_read( int fd, strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+
+  off_t const size = lseek( fd, 0, SEEK_END );
+  PERROR_EXIT_IF( size == -1, EX_IOERR );
+  PERROR_EXIT_IF( lseek( fd, 0, SEEK_SET ) == -1, EX_IOERR );
+
+  size_t left = STATIC_CAST( size_t, size );
+  strbuf_reserve( sbuf, left );
+  while ( left > 0 ) {
+    ssize_t const n = read( fd, sbuf->str + sbuf->len, left );
+    if ( n == -1 && errno == EINTR )
+      continue;
+    PERROR_EXIT_IF( n == -1, EX_IOERR );
+    if ( n == 0 )
+      break;                            // LCOV_EXCL_LINE
+    sbuf->len += STATIC_CAST( size_t, n );
+    left -= STATIC_CAST( size_t, n );
+  } // while
+  if ( sbuf->str != NULL )
+    sbuf->str[ sbuf->len ] = '\0';
+}
+
+/**
+ * Discards everything written to \a fd.
+ *
+ * @param fd The file descriptor to reset.
+ */
+static void capture_reset( int fd ) {
+  PERROR_EXIT_IF( ftruncate( fd, 0 ) == -1, EX_IOERR );
+  PERROR_EXIT_IF( lseek( fd, 0, SEEK_SET ) == -1, EX_IOERR );
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void capture_begin( void ) {
+  assert( orig_stdout_fd != -1 );
+  FFLUSH( stdout );
+  FFLUSH( stderr );
+  capture_reset( STDOUT_FILENO );
+  capture_reset( STDERR_FILENO );
+}
+
+void capture_end( strbuf_t *out_sbuf, strbuf_t *err_sbuf ) {
+  assert( orig_stdout_fd != -1 );
+  FFLUSH( stdout );
+  FFLUSH( stderr );
+  capture_read( STDOUT_FILENO, out_sbuf );
+  if ( err_sbuf != NULL )
+    capture_read( STDERR_FILENO, err_sbuf );
+}
+
+void capture_init( void ) {
+  ASSERT_RUN_ONCE();
+  FFLUSH( stdout );
+  FFLUSH( stderr );
+  orig_stdout_fd = capture_fd( STDOUT_FILENO );
+  orig_stderr_fd = capture_fd( STDERR_FILENO );
+  ATEXIT( &capture_cleanup );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,82 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/capture.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_capture_H
+#define cdecl_capture_H
+
+/**
+ * @file
+ * Declares functions for capturing everything written to standard output and
+ * standard error.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
+
+/**
+ * @defgroup capture-group Capturing Output
+ * Functions for capturing everything written to standard output and standard
+ * error so it can be sent somewhere other than the terminal.
+ *
+ * @remarks Capturing is done at the file descriptor level, so it captures
+ * output written by any means, not only via `stdout` and `stderr`.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Begins a new capture discarding anything previously captured.
+ *
+ * @sa capture_end()
+ * @sa capture_init()
+ */
+void capture_begin( void );
+
+/**
+ * Ends the current capture.
+ *
+ * @param out_sbuf The \ref strbuf to append everything written to standard
+ * output since the last call to capture_begin() to.
+ * @param err_sbuf The \ref strbuf to append everything written to standard
+ * error since the last call to capture_begin() to.  If NULL, it's discarded.
+ *
+ * @sa capture_begin()
+ */
+void capture_end( strbuf_t *out_sbuf, strbuf_t *err_sbuf );
+
+/**
+ * Initializes capturing by redirecting standard output and standard error to
+ * temporary files.  Standard output and standard error are restored upon
+ * program termination.
+ *
+ * @note This function must be called exactly once.
+ *
+ * @sa capture_begin()
+ */
+void capture_init( void );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_capture_H */
+/* vim:set et sw=2 ts=2: */
@@ -34,11 +34,18 @@
 #include "cdecl_term.h"
 #include "cli_options.h"
 #include "color.h"
+#include "config_file.h"
+#include "json_lines.h"
+#include "keyword.h"
 #include "lexer.h"
 #include "options.h"
 #include "p_keyword.h"
 #include "p_macro.h"
 #include "parse.h"
+#include "print.h"
+#include "result_cache.h"
+#include "server.h"
+#include "show.h"
 #include "types.h"
 #include "util.h"
 
@@ -46,6 +53,7 @@
 
 // standard
 #include <stdbool.h>
+#include <stdint.h>                     /* for uint64_t */
 #include <stdlib.h>
 #include <string.h>
 #include <sysexits.h>
@@ -77,6 +85,10 @@ char const   *prog_name;
  * @sa main()
  */
 static void cdecl_cleanup( void ) {
+  if ( opt_stats ) {
+    print_stderr_begin();
+    show_ast_stats( stderr );
+  }
   c_ast_cleanup_all();
 }
 
@@ -115,12 +127,36 @@ int main( int argc, char const *const argv[] ) {
     wait_for_debugger_attach();
 
   cli_options_init( &argc, &argv );     // must call before colors_init()
+
+  // A client doesn't need anything else initialized.  Note that
+  // cli_options_init() makes argv[0] be the first argument, if any, and no
+  // longer the program name.
+  if ( opt_client_path != NULL ) {
+    return cdecl_client(
+      opt_client_path, STATIC_CAST( size_t, argc ), argv
+    );
+  }
+
   colors_init();                        // must call before cdecl_term_init()
   cdecl_term_init();                    // call before possible print_error()
 
-  // The order of these doesn't matter.
+  if ( opt_cache_dir != NULL ) {
+    uint64_t hash = 0;
+    if ( !opt_read_config || config_hash( opt_config_path, &hash ) ) {
+      result_cache_dir_init( hash );
+      // A repeated command can be answered before doing anything else.
+      if ( opt_server_path == NULL && !opt_json_lines &&
+           cdecl_parse_cli_cached( STATIC_CAST( size_t, argc ), argv ) ) {
+        return EX_OK;
+      }
+    }
+  }
+
   c_keywords_init();
   cdecl_keywords_init();
+  keywords_init();                      // must call after the above two
+
+  // The order of these doesn't matter.
   lang_set( opt_lang_id );
   lexer_init();
   parser_init();
@@ -131,12 +167,17 @@ int main( int argc, char const *const argv[] ) {
   // uses the parser.
   c_typedefs_init();
 
-  if ( opt_read_config ) {
-    void config_init( char const* );
+  if ( opt_read_config )
     config_init( opt_config_path );
-  }
 
   cdecl_is_initialized = true;
+  result_cache_dir_ready();
+
+  if ( opt_server_path != NULL )
+    cdecl_server( opt_server_path );
+
+  if ( opt_json_lines )
+    return cdecl_json_lines( stdin );
 
   // cli_options_init() makes argv[0] be the first argument, if any, and no
   // longer the program name.
@@ -50,7 +50,7 @@
 #include <assert.h>
 #include <getopt.h>
 #include <stdbool.h>
-#include <stdlib.h>                     /* for calloc(3), NULL, size_t */
+#include <stddef.h>                     /* for NULL, size_t */
 
 /// @endcond
 
@@ -61,18 +61,48 @@
 
 ////////// typedefs ///////////////////////////////////////////////////////////
 
-typedef struct dym_rb_visit_data dym_rb_visit_data_t;
+typedef struct dym_kind_index dym_kind_index_t;
+typedef struct dym_kind_info  dym_kind_info_t;
+
+/**
+ * The signature for a function to add all candidates of a kind to a \ref
+ * dym_index.
+ *
+ * @param idx The \ref dym_index to add to.
+ */
+typedef void (*dym_prep_fn_t)( dym_index_t *idx );
+
+/**
+ * The signature for a function to get the generation of the things of a kind,
+ * i.e., a number that changes whenever any of them changes.
+ *
+ * @return Returns said generation.
+ */
+typedef unsigned (*dym_gen_fn_t)( void );
 
 ////////// structs ////////////////////////////////////////////////////////////
 
 /**
- * Used by visitor functions to pass and return data.
+ * The candidates of a kind of thing possibly meant.
+ *
+ * @remarks The candidates are kept across look-ups and rebuilt only when
+ * something they depend on changes: the current language or, if the kind has
+ * a \ref dym_kind_info::gen_fn "gen_fn", its generation.
  */
-struct dym_rb_visit_data {
-  /// Pointer to a pointer to a candidate list or NULL to just get the count.
-  did_you_mean_t  **pdym;
+struct dym_kind_index {
+  dym_index_t idx;                      ///< The candidates.
+  bool        is_built;                 ///< Has \ref idx been built?
+  c_lang_id_t lang_id;                  ///< \ref opt_lang_id when built.
+  unsigned    gen;                      ///< Generation when built.
+};
 
-  size_t            count;              ///< The count.
+/**
+ * Information about a kind of thing possibly meant.
+ */
+struct dym_kind_info {
+  dym_kind_t    kind;                   ///< The kind.
+  dym_prep_fn_t prep_fn;                ///< Adds candidates of \ref kind.
+  dym_gen_fn_t  gen_fn;                 ///< Generation of \ref kind or NULL.
 };
 
 ////////// local constants ////////////////////////////////////////////////////
@@ -87,14 +117,44 @@ static double const SIMILAR_ENOUGH_PERCENT = .37;
 ////////// local functions ////////////////////////////////////////////////////
 
 PJL_DISCARD
-static size_t prep_c_keywords( did_you_mean_t**, c_tpid_t ),
-              prep_cdecl_keywords( did_you_mean_t** ),
-              prep_commands( did_you_mean_t** ),
-              prep_cli_options( did_you_mean_t** ),
-              prep_help_options( did_you_mean_t** ),
-              prep_macros( did_you_mean_t** ),
-              prep_set_options( did_you_mean_t** ),
-              prep_typedefs( did_you_mean_t** );
+static bool prep_typedef_visitor( c_typedef_t const*, void* );
+
+static void prep_c_attributes( dym_index_t* ),
+            prep_c_keywords( dym_index_t* ),
+            prep_c_keywords_tpid( dym_index_t*, c_tpid_t ),
+            prep_c_types( dym_index_t* ),
+            prep_cdecl_keywords( dym_index_t* ),
+            prep_cli_options( dym_index_t* ),
+            prep_commands( dym_index_t* ),
+            prep_help_options( dym_index_t* ),
+            prep_macros( dym_index_t* ),
+            prep_set_options( dym_index_t* ),
+            prep_typedef_lazy_visitor( char const*, c_lang_id_t, void* );
+
+////////// local constants ////////////////////////////////////////////////////
+
+/**
+ * Information about every kind of thing possibly meant.
+ */
+static dym_kind_info_t const DYM_KIND_INFOS[] = {
+  { DYM_COMMANDS,       &prep_commands,       NULL            },
+  { DYM_CLI_OPTIONS,    &prep_cli_options,    NULL            },
+  { DYM_HELP_OPTIONS,   &prep_help_options,   NULL            },
+  { DYM_SET_OPTIONS,    &prep_set_options,    NULL            },
+  { DYM_C_ATTRIBUTES,   &prep_c_attributes,   NULL            },
+  { DYM_C_KEYWORDS,     &prep_c_keywords,     NULL            },
+  { DYM_C_MACROS,       &prep_macros,         &p_macros_gen   },
+  { DYM_C_TYPES,        &prep_c_types,        &c_typedefs_gen },
+  { DYM_CDECL_KEYWORDS, &prep_cdecl_keywords, NULL            },
+};
+
+////////// local variables ////////////////////////////////////////////////////
+
+/// Candidates of each kind in the same order as \ref DYM_KIND_INFOS.
+static dym_kind_index_t dym_kind_indexes[ ARRAY_SIZE( DYM_KIND_INFOS ) ];
+
+/// Suggestions found by the most recent cdecl_dym_find().
+static dym_index_t      dym_found;
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -116,119 +176,91 @@ static void dym_cleanup( did_you_mean_t const *dym ) {
 }
 
 /**
- * Gets whether \a dam_lev_dist is "similar enough" to be a candidate.
+ * Cleans-up all memory used by all candidates and suggestions.
  *
- * @remarks Using a Damerau-Levenshtein edit distance alone to implement "Did
- * you mean ...?" can yield poor results if you just always use the results
- * with the least distance.  For example, given a source string of "fixed" and
- * the best target string of "float", it's probably safe to assume that because
- * "fixed" is so different from "float" that there's no way "float" was meant.
- * It would be better to offer _no_ suggestions than not-even-close
- * suggestions.
- * @par
- * Hence, you need a heuristic to know whether a least edit distance is
- * "similar enough" to the target string even to bother offering suggestions.
- * This can be done by checking whether the distance is less than or equal to
- * some percentage of the target string's length in order to be considered
- * "similar enough" to be a reasonable suggestion.
+ * @note This function is called only via **atexit**(3).
+ */
+static void dym_indexes_cleanup( void ) {
+  for ( size_t i = 0; i < ARRAY_SIZE( dym_kind_indexes ); ++i )
+    dym_index_cleanup( &dym_kind_indexes[i].idx, &dym_cleanup );
+  dym_index_cleanup( &dym_found, /*cleanup_fn=*/NULL );
+}
+
+/**
+ * Gets the candidates of the kind of \a dki, (re)building them first if
+ * they're out of date.
  *
- * @param dym A pointer to the \ref did_you_mean to check.
- * @return Returns `true` only if \a dam_lev_dist is "similar enough."
+ * @param dki The \ref dym_kind_info of the kind.
+ * @param dkx The \ref dym_kind_index of the kind.
+ * @return Returns said candidates.
  */
 NODISCARD
-static bool is_similar_enough( did_you_mean_t const *dym ) {
-  return  dym->dam_lev_dist <= STATIC_CAST( size_t,
-          STATIC_CAST( double, dym->known_len ) * SIMILAR_ENOUGH_PERCENT + 0.5
-          );
+static dym_index_t const* dym_kind_index_get( dym_kind_info_t const *dki,
+                                              dym_kind_index_t *dkx ) {
+  unsigned const gen = dki->gen_fn != NULL ? (*dki->gen_fn)() : 0;
+  if ( !dkx->is_built || dkx->lang_id != opt_lang_id || dkx->gen != gen ) {
+    RUN_ONCE ATEXIT( &dym_indexes_cleanup );
+    dym_index_clear( &dkx->idx, &dym_cleanup );
+    (*dki->prep_fn)( &dkx->idx );
+    dym_index_sort( &dkx->idx );
+    dkx->is_built = true;
+    dkx->lang_id = opt_lang_id;
+    dkx->gen = gen;
+  }
+  return &dkx->idx;
 }
 
 /**
- * Either determines the number of candidate suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * Adds C/C++ attribute candidates to \a idx.
  *
- * @param kinds The bitwise-or of the kind(s) of things possibly meant.
- * @param dym If NULL, determines the number of candidate suggestions; if non-
- * NULL, sets \ref did_you_mean::known "known" of every element to a
- * suggestion.
- * @return If \a pdym is NULL, returns the number of suggestions; otherwise the
- * return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_all( dym_kind_t kinds, did_you_mean_t *dym ) {
-  did_you_mean_t **pdym = dym != NULL ? &dym : NULL;
-  return  ((kinds & DYM_COMMANDS) != DYM_NONE ?
-            prep_commands( pdym ) : 0)
-
-        + ((kinds & DYM_CLI_OPTIONS) != DYM_NONE ?
-            prep_cli_options( pdym ) : 0)
-
-        + ((kinds & DYM_HELP_OPTIONS) != DYM_NONE ?
-            prep_help_options( pdym ) : 0)
-
-        + ((kinds & DYM_SET_OPTIONS) != DYM_NONE ?
-            prep_set_options( pdym ) : 0)
-
-        + ((kinds & DYM_C_ATTRIBUTES) != DYM_NONE ?
-            prep_c_keywords( pdym, C_TPID_ATTR ) : 0)
-
-        + ((kinds & DYM_C_KEYWORDS) != DYM_NONE ?
-            prep_c_keywords( pdym, C_TPID_NONE ) +
-            prep_c_keywords( pdym, C_TPID_STORE ) : 0)
-
-        + ((kinds & DYM_C_MACROS) != DYM_NONE ?
-            prep_macros( pdym ) : 0)
-
-        + ((kinds & DYM_C_TYPES) != DYM_NONE ?
-            prep_c_keywords( pdym, C_TPID_BASE ) +
-            prep_typedefs( pdym ) : 0)
+static void prep_c_attributes( dym_index_t *idx ) {
+  prep_c_keywords_tpid( idx, C_TPID_ATTR );
+}
 
-        + ((kinds & DYM_CDECL_KEYWORDS) != DYM_NONE ?
-            prep_cdecl_keywords( pdym ) : 0);
+/**
+ * Adds C/C++ keyword candidates to \a idx.
+ *
+ * @param idx The \ref dym_index to add to.
+ */
+static void prep_c_keywords( dym_index_t *idx ) {
+  prep_c_keywords_tpid( idx, C_TPID_NONE );
+  prep_c_keywords_tpid( idx, C_TPID_STORE );
 }
 
 /**
- * Either determines the number of C keyword suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * Adds C/C++ keyword candidates having \a tpid to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @param tpid The type part ID that a keyword must have in order to be copied
- * (or counted).
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
+ * @param tpid The type part ID that a keyword must have in order to be added.
  */
-PJL_DISCARD
-static size_t prep_c_keywords( did_you_mean_t **pdym, c_tpid_t tpid ) {
-  size_t count = 0;
+static void prep_c_keywords_tpid( dym_index_t *idx, c_tpid_t tpid ) {
   FOREACH_C_KEYWORD( ck ) {
-    if ( opt_lang_is_any( ck->lang_ids ) && c_tid_tpid( ck->tid ) == tpid ) {
-      if ( pdym == NULL )
-        ++count;
-      else
-        (*pdym)++->known = ck->literal;
-    }
+    if ( opt_lang_is_any( ck->lang_ids ) && c_tid_tpid( ck->tid ) == tpid )
+      dym_index_add( idx, ck->literal, /*user_data=*/NULL );
   } // for
-  return count;
 }
 
 /**
- * Either determines the number of **cdecl** keyword suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * Adds C/C++ type candidates, both base types and `typedef`s, to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_cdecl_keywords( did_you_mean_t **pdym ) {
+static void prep_c_types( dym_index_t *idx ) {
+  prep_c_keywords_tpid( idx, C_TPID_BASE );
+  c_typedef_visit( &prep_typedef_visitor, idx );
+  c_typedef_visit_lazy( &prep_typedef_lazy_visitor, idx );
+}
+
+/**
+ * Adds **cdecl** keyword candidates to \a idx.
+ *
+ * @param idx The \ref dym_index to add to.
+ */
+static void prep_cdecl_keywords( dym_index_t *idx ) {
   assert( is_english_to_gibberish() );
 
-  size_t count = 0;
   FOREACH_CDECL_KEYWORD( cdk ) {
     if ( !opt_lang_is_any( cdk->lang_ids ) )
       continue;
@@ -237,169 +269,90 @@ static size_t prep_cdecl_keywords( did_you_mean_t **pdym ) {
       known = cdk->literal;
     else if ( (known = c_lang_literal( cdk->lang_syn )) == NULL )
       continue;
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->known = known;
+    dym_index_add( idx, known, /*user_data=*/NULL );
   } // for
-  return count;
 }
 
 /**
- * Either determines the number of **cdecl** command suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * Adds **cdecl** command-line-option candidates to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_commands( did_you_mean_t **pdym ) {
-  size_t count = 0;
-  FOREACH_CDECL_COMMAND( command ) {
-    if ( opt_lang_is_any( command->lang_ids ) ) {
-      if ( pdym == NULL )
-        ++count;
-      else
-        (*pdym)++->known = command->literal;
-    }
-  } // for
-  return count;
+static void prep_cli_options( dym_index_t *idx ) {
+  FOREACH_CLI_OPTION( opt )
+    dym_index_add( idx, opt->name, /*user_data=*/NULL );
 }
 
 /**
- * Either determines the number of **cdecl** command-line-option suggestions or
- * sets \ref did_you_mean::known "known" of every element to a suggestion.
+ * Adds **cdecl** command candidates to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_cli_options( did_you_mean_t **pdym ) {
-  size_t count = 0;
-  FOREACH_CLI_OPTION( opt ) {
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->known = opt->name;
+static void prep_commands( dym_index_t *idx ) {
+  FOREACH_CDECL_COMMAND( command ) {
+    if ( opt_lang_is_any( command->lang_ids ) )
+      dym_index_add( idx, command->literal, /*user_data=*/NULL );
   } // for
-  return count;
 }
 
 /**
- * Either determines the number of **cdecl** help-option suggestions or sets
- * \ref did_you_mean::known "known" of every element to a suggestion.
+ * Adds **cdecl** help-option candidates to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_help_options( did_you_mean_t **pdym ) {
-  size_t count = 0;
-  FOREACH_HELP_OPTION( opt ) {
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->known = *opt;
-  } // for
-  return count;
+static void prep_help_options( dym_index_t *idx ) {
+  FOREACH_HELP_OPTION( opt )
+    dym_index_add( idx, *opt, /*user_data=*/NULL );
 }
 
 /**
- * Either determines the number of macro suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * Adds macro candidates to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_macros( did_you_mean_t **pdym ) {
+static void prep_macros( dym_index_t *idx ) {
   p_macro_iterator_t iter;
   p_macro_iterator_init( &iter );
 
-  size_t count = 0;
   for ( p_macro_t const *macro;
         (macro = p_macro_iterator_next( &iter )) != NULL; ) {
     if ( macro->is_dynamic &&
          !opt_lang_is_any( (*macro->dyn_fn)( /*ptoken=*/NULL ) ) ) {
       continue;
     }
-
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->known = macro->name;
+    dym_index_add( idx, macro->name, /*user_data=*/NULL );
   } // for
-  return count;
 }
 
 /**
- * Either determines the number of **cdecl** set-option suggestions or sets
- * \ref did_you_mean::known "known" of every element to a suggestion.
+ * Adds **cdecl** set-option candidates to \a idx.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
- * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @param idx The \ref dym_index to add to.
  */
-PJL_DISCARD
-static size_t prep_set_options( did_you_mean_t **pdym ) {
-  size_t count = 0;
+static void prep_set_options( dym_index_t *idx ) {
   FOREACH_SET_OPTION( opt ) {
     switch ( opt->kind ) {
       case SET_OPTION_TOGGLE:
-        if ( pdym == NULL ) {
-          count += 2;
-        } else {
-          (*pdym)++->known = opt->name;
-          (*pdym)->known = check_prefix_strdup( "no", 2, opt->name );
-          (*pdym)->user_data = POINTER_CAST( void*, true );
-          ++*pdym;
-        }
+        dym_index_add( idx, opt->name, /*user_data=*/NULL );
+        FALLTHROUGH;
+      case SET_OPTION_NEG_ONLY:
+        dym_index_add(
+          idx, check_prefix_strdup( "no", 2, opt->name ),
+          POINTER_CAST( void*, true )
+        );
         break;
       case SET_OPTION_AFF_ONLY:
-        if ( pdym == NULL )
-          ++count;
-        else
-          (*pdym)++->known = opt->name;
-        break;
-      case SET_OPTION_NEG_ONLY:
-        if ( pdym == NULL ) {
-          ++count;
-        } else {
-          (*pdym)->known = check_prefix_strdup( "no", 2, opt->name );
-          (*pdym)->user_data = POINTER_CAST( void*, true );
-          ++*pdym;
-        }
+        dym_index_add( idx, opt->name, /*user_data=*/NULL );
         break;
     } // switch
   } // for
-  return count;
 }
 
 /**
- * A \ref c_typedef visitor function that either counts a `typedef` suggestion
- * or sets a \ref did_you_mean::known "known" to a suggestion.
+ * A \ref c_typedef visitor function that adds a `typedef` candidate.
  *
  * @param tdef The c_typedef to visit.
- * @param visit_data A pointer to a \ref dym_rb_visit_data.
+ * @param visit_data The \ref dym_index to add to.
  * @return Always returns `false`.
  */
 PJL_DISCARD
@@ -408,55 +361,79 @@ static bool prep_typedef_visitor( c_typedef_t const *tdef, void *visit_data ) {
   assert( visit_data != NULL );
 
   if ( opt_lang_is_any( tdef->lang_ids ) ) {
-    dym_rb_visit_data_t *const drvd = visit_data;
-    if ( drvd->pdym == NULL ) {
-      ++drvd->count;
-    } else {
-      char const *const name = c_sname_gibberish( &tdef->ast->sname );
-      (*drvd->pdym)->known = check_strdup( name );
-      (*drvd->pdym)->user_data = POINTER_CAST( void*, true );
-      ++*drvd->pdym;
-    }
+    char const *const name = c_sname_gibberish( &tdef->ast->sname );
+    dym_index_add(
+      visit_data, check_strdup( name ), POINTER_CAST( void*, true )
+    );
   }
   return false;
 }
 
 /**
- * Either determines the number of `typedef` suggestions or sets \ref
- * did_you_mean::known "known" of every element to a suggestion.
+ * A \ref c_typedef_lazy_visit_fn_t function that adds a `typedef` candidate
+ * for a predefined type that hasn't been defined yet.
  *
- * @param pdym If NULL, determines the number of suggestions; if non-NULL, sets
- * \ref did_you_mean::known "known" of every element to a suggestion.  Upon
- * return, the pointer to which \a pdym points is advanced by the number of
+ * @param name The scoped name of the type.
+ * @param lang_ids The language(s) the type is available in.
+ * @param visit_data The \ref dym_index to add to.
+ */
+static void prep_typedef_lazy_visitor( char const *name, c_lang_id_t lang_ids,
+                                       void *visit_data ) {
+  assert( name != NULL );
+  assert( visit_data != NULL );
+
+  if ( opt_lang_is_any( lang_ids ) ) {
+    dym_index_add(
+      visit_data, check_strdup( name ), POINTER_CAST( void*, true )
+    );
+  }
+}
+
+/**
+ * Gets the maximum edit distance a candidate of length \a known_len may be in
+ * order to be "similar enough" to be a suggestion.
+ *
+ * @remarks Using a Damerau-Levenshtein edit distance alone to implement "Did
+ * you mean ...?" can yield poor results if you just always use the results
+ * with the least distance.  For example, given a source string of "fixed" and
+ * the best target string of "float", it's probably safe to assume that because
+ * "fixed" is so different from "float" that there's no way "float" was meant.
+ * It would be better to offer _no_ suggestions than not-even-close
  * suggestions.
- * @return If \a pdym is NULL, returns said number of suggestions; otherwise
- * the return value is unspecified.
+ * @par
+ * Hence, you need a heuristic to know whether a least edit distance is
+ * "similar enough" to the target string even to bother offering suggestions.
+ * This can be done by checking whether the distance is less than or equal to
+ * some percentage of the target string's length in order to be considered
+ * "similar enough" to be a reasonable suggestion.
+ *
+ * @param known_len The length of the candidate.
+ * @return Returns said distance.
  */
-PJL_DISCARD
-static size_t prep_typedefs( did_you_mean_t **pdym ) {
-  dym_rb_visit_data_t drvd = { pdym, 0 };
-  c_typedef_visit( &prep_typedef_visitor, &drvd );
-  return drvd.count;
+NODISCARD
+static size_t similar_enough_dist( size_t known_len ) {
+  return STATIC_CAST( size_t,
+    STATIC_CAST( double, known_len ) * SIMILAR_ENOUGH_PERCENT + 0.5
+  );
 }
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void cdecl_dym_free( did_you_mean_t const *dym_array ) {
-  dym_free( dym_array, &dym_cleanup );
-}
-
-did_you_mean_t const* cdecl_dym_new( dym_kind_t kinds, char const *unknown ) {
+did_you_mean_t const* cdecl_dym_find( dym_kind_t kinds, char const *unknown ) {
   assert( unknown != NULL );
 
-  size_t const dym_size = prep_all( kinds, /*pdym=*/NULL );
-  if ( dym_size == 0 )
-    return NULL;
+  dym_index_t const *idxs[ ARRAY_SIZE( DYM_KIND_INFOS ) ];
+  size_t idxs_len = 0;
 
-  did_you_mean_t *const dym_array = calloc( dym_size + 1, sizeof *dym_array );
-  prep_all( kinds, dym_array );
+  for ( size_t i = 0; i < ARRAY_SIZE( DYM_KIND_INFOS ); ++i ) {
+    dym_kind_info_t const *const dki = &DYM_KIND_INFOS[i];
+    if ( (kinds & dki->kind) != DYM_NONE )
+      idxs[ idxs_len++ ] = dym_kind_index_get( dki, &dym_kind_indexes[i] );
+  } // for
 
-  return dym_calc( unknown, dym_array, &is_similar_enough, &dym_cleanup ) ?
-    dym_array : NULL;
+  return dym_index_find(
+      idxs, idxs_len, unknown, &similar_enough_dist, &dym_found
+    ) ? dym_found.dyms : NULL;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
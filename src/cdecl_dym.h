@@ -60,26 +60,20 @@ typedef enum dym_kind dym_kind_t;
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
- * Frees all memory used by \a dym_array _including_ \a dym_array itself.
+ * Finds "Did you mean ...?" suggestions for \a unknown.
  *
- * @param dym_array The \ref did_you_mean array to free.  If NULL, does
- * nothing.
- *
- * @sa cdecl_dym_new()
- */
-void cdecl_dym_free( did_you_mean_t const *dym_array );
-
-/**
- * Creates a new array of \ref did_you_mean elements containing "Did you mean
- * ...?" suggestion literals for \a unknown.
+ * @remarks The candidates of each kind are kept across calls and rebuilt only
+ * when the current language or, for macros and types, the set of them
+ * changes, so a call allocates nothing in the common case.
  *
  * @param kinds The bitwise-or of the kind(s) of things possibly meant.
  * @param unknown The unknown literal.
  * @return Returns a pointer to an array of elements terminated by one having a
- * NULL `literal` pointer if there are suggestions or NULL if not.  The caller
- * is responsible for calling cdecl_dym_free().
+ * NULL \ref did_you_mean::known "known" pointer if there are suggestions or
+ * NULL if not.  The array is valid only until the next call.
  */
-did_you_mean_t const* cdecl_dym_new( dym_kind_t kinds, char const *unknown );
+NODISCARD
+did_you_mean_t const* cdecl_dym_find( dym_kind_t kinds, char const *unknown );
 
 ///////////////////////////////////////////////////////////////////////////////
 
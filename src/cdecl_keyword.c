@@ -32,6 +32,7 @@
 #endif /* WITH_READLINE */
 #include "cdecl_parser.h"
 #include "c_lang.h"
+#include "keyword.h"
 #include "literals.h"
 #include "types.h"
 #include "util.h"
@@ -431,6 +432,15 @@ static cdecl_keyword_t CDECL_KEYWORDS[] = {
     )
   },
 
+  { L_cache,
+    LANG_ANY,
+    TOKEN( Y_cache ),
+    AC_SETTINGS(
+      AC_POLICY_DEFAULT,
+      AC_NO_NEXT_KEYWORDS               // see command_ac_keywords()
+    )
+  },
+
   { L_capture,
     LANG_LAMBDAS,
     TOKEN( Y_capturing ),
@@ -1753,11 +1763,8 @@ static int cdecl_keyword_cmp( cdecl_keyword_t const *i_cdk,
 
 cdecl_keyword_t const* cdecl_keyword_find( char const *literal ) {
   assert( literal != NULL );
-  return bsearch(
-    &(cdecl_keyword_t){ .literal = literal }, CDECL_KEYWORDS,
-    ARRAY_SIZE( CDECL_KEYWORDS ), sizeof CDECL_KEYWORDS[0],
-    POINTER_CAST( bsearch_cmp_fn_t, &cdecl_keyword_cmp )
-  );
+  keyword_t const *const kw = keyword_find( literal );
+  return kw != NULL ? kw->cdecl_keyword : NULL;
 }
 
 cdecl_keyword_t const* cdecl_keyword_next( cdecl_keyword_t const *cdk ) {
@@ -1766,7 +1773,7 @@ cdecl_keyword_t const* cdecl_keyword_next( cdecl_keyword_t const *cdk ) {
 
 void cdecl_keywords_init( void ) {
   ASSERT_RUN_ONCE();
-  qsort(                                // don't rely on manual sorting above
+  qsort(                                // for keywords_init()
     CDECL_KEYWORDS,
     ARRAY_SIZE( CDECL_KEYWORDS ), sizeof CDECL_KEYWORDS[0],
     POINTER_CAST( qsort_cmp_fn_t, &cdecl_keyword_cmp )
@@ -51,6 +51,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sysexits.h>
+#include <unistd.h>                     /* for sysconf(3) */
 
 // in ascending option character ASCII order
 #define OPT_DIGRAPHS              2
@@ -63,6 +64,7 @@
 #define OPT_CONFIG                c
 #define OPT_NO_CONFIG             C
 #define OPT_CDECL_DEBUG           d
+#define OPT_SERVER                D
 #define OPT_EAST_CONST            e
 #define OPT_ECHO_COMMANDS         E
 #define OPT_FILE                  f
@@ -70,11 +72,15 @@
 #define OPT_FLEX_DEBUG            F
 #endif /* ENABLE_FLEX_DEBUG */
 #define OPT_HELP                  h
+#define OPT_CACHE_DIR             H
 #define OPT_EXPLICIT_INT          i
 #define OPT_INFER_COMMAND         I
+#define OPT_JOBS                  j
+#define OPT_JSON_LINES            J
 #define OPT_COLOR                 k
 #define OPT_COMMANDS              K
 #define OPT_LINENO                L
+#define OPT_STATS                 M
 #define OPT_PERMISSIVE_TYPES      p
 #define OPT_OUTPUT                o
 #define OPT_OPTIONS               O
@@ -85,9 +91,12 @@
 #define OPT_NO_TYPEDEFS           t
 #define OPT_NO_ENGLISH_TYPES      T
 #define OPT_NO_USING              u
+#define OPT_CLIENT                U
 #define OPT_VERSION               v
 #define OPT_WEST_DECL             w
+#define OPT_WRITE_PER_COMMAND     W
 #define OPT_LANGUAGE              x
+#define OPT_LAZY_TYPEDEFS         z
 
 /// Command-line short option as a character literal.
 #define COPT(X)                   CHARIFY(OPT_##X)
@@ -118,6 +127,11 @@
     VA_OPT( (,), __VA_ARGS__ ) __VA_ARGS__                \
   )
 
+/**
+ * Maximum value for the `--jobs` option.
+ */
+#define JOBS_MAX                  1024u
+
 ////////// local constants ////////////////////////////////////////////////////
 
 /**
@@ -137,6 +151,8 @@ static struct option const OPTIONS[] = {
 #ifdef ENABLE_BISON_DEBUG
   { L_OPT_bison_debug,      no_argument,        NULL, COPT(BISON_DEBUG)       },
 #endif /* ENABLE_BISON_DEBUG */
+  { L_OPT_cache_dir,        optional_argument,  NULL, COPT(CACHE_DIR)         },
+  { L_OPT_client,           required_argument,  NULL, COPT(CLIENT)            },
   { L_OPT_color,            required_argument,  NULL, COPT(COLOR)             },
   { L_OPT_commands,         no_argument,        NULL, COPT(COMMANDS)          },
   { L_OPT_config,           required_argument,  NULL, COPT(CONFIG)            },
@@ -152,7 +168,10 @@ static struct option const OPTIONS[] = {
 #endif /* ENABLE_FLEX_DEBUG */
   { L_OPT_help,             no_argument,        NULL, COPT(HELP)              },
   { L_OPT_infer_command,    no_argument,        NULL, COPT(INFER_COMMAND)     },
+  { L_OPT_jobs,             required_argument,  NULL, COPT(JOBS)              },
+  { L_OPT_json_lines,       no_argument,        NULL, COPT(JSON_LINES)        },
   { L_OPT_language,         required_argument,  NULL, COPT(LANGUAGE)          },
+  { L_OPT_lazy_typedefs,    no_argument,        NULL, COPT(LAZY_TYPEDEFS)     },
   { L_OPT_lineno,           required_argument,  NULL, COPT(LINENO)            },
   { "no-buffer-stdout",     no_argument,        NULL, COPT(NO_BUFFER_STDOUT)  },
   { "no-config",            no_argument,        NULL, COPT(NO_CONFIG)         },
@@ -164,10 +183,13 @@ static struct option const OPTIONS[] = {
   { L_OPT_options,          no_argument,        NULL, COPT(OPTIONS)           },
   { L_OPT_output,           required_argument,  NULL, COPT(OUTPUT)            },
   { L_OPT_permissive_types, no_argument,        NULL, COPT(PERMISSIVE_TYPES)  },
+  { L_OPT_server,           required_argument,  NULL, COPT(SERVER)            },
+  { L_OPT_stats,            no_argument,        NULL, COPT(STATS)             },
   { L_OPT_trailing_return,  no_argument,        NULL, COPT(TRAILING_RETURN)   },
   { L_OPT_trigraphs,        no_argument,        NULL, COPT(TRIGRAPHS)         },
   { L_OPT_version,          no_argument,        NULL, COPT(VERSION)           },
   { L_OPT_west_decl,        required_argument,  NULL, COPT(WEST_DECL)         },
+  { "write-per-command",    no_argument,        NULL, COPT(WRITE_PER_COMMAND) },
   { NULL,                   0,                  NULL, 0                       }
 };
 
@@ -184,6 +206,8 @@ static char const *const OPTIONS_HELP[] = {
 #ifdef ENABLE_BISON_DEBUG
   [ COPT(BISON_DEBUG) ] = "Print Bison debug output",
 #endif /* ENABLE_BISON_DEBUG */
+  [ COPT(CACHE_DIR) ] = "Cache results across invocations in directory",
+  [ COPT(CLIENT) ] = "Send commands to server listening on socket",
   [ COPT(COLOR) ] = "Colorize output [default: not_file]",
   [ COPT(COMMANDS) ] = "Print commands (for shell completion)",
   [ COPT(CONFIG) ] = "Configuration file path",
@@ -199,7 +223,10 @@ static char const *const OPTIONS_HELP[] = {
 #endif /* ENABLE_FLEX_DEBUG */
   [ COPT(HELP) ] = "Print this help and exit",
   [ COPT(INFER_COMMAND) ] = "Try to infer command when none is given",
+  [ COPT(JOBS) ] = "Parallel jobs for non-interactive input [default: 1]",
+  [ COPT(JSON_LINES) ] = "Read requests & write responses as JSON Lines",
   [ COPT(LANGUAGE) ] = "Use language",
+  [ COPT(LAZY_TYPEDEFS) ] = "Define standard types only when first used",
   [ COPT(LINENO) ] = "Add to all line numbers in messages",
   [ COPT(NO_BUFFER_STDOUT) ] = "Set stdout to unbuffered",
   [ COPT(NO_CONFIG) ] = "Suppress reading configuration file",
@@ -211,10 +238,13 @@ static char const *const OPTIONS_HELP[] = {
   [ COPT(OPTIONS) ] = "Print command-line options (for shell completion)",
   [ COPT(OUTPUT) ] = "Write to file [default: stdout]",
   [ COPT(PERMISSIVE_TYPES) ] = "Permit other language keywords as types",
+  [ COPT(SERVER) ] = "Run as server listening on socket",
+  [ COPT(STATS) ] = "Print AST node memory statistics at exit",
   [ COPT(TRAILING_RETURN) ] = "Print trailing return type in C++",
   [ COPT(TRIGRAPHS) ] = "Print trigraphs",
   [ COPT(VERSION) ] = "Print version and exit",
   [ COPT(WEST_DECL) ] = "Print *, &, and && next to type",
+  [ COPT(WRITE_PER_COMMAND) ] = "Write stdout once per command",
 };
 
 ////////// local variables ////////////////////////////////////////////////////
@@ -295,8 +325,42 @@ static void check_options( void ) {
   check_opt_exclusive( COPT(HELP) );
   check_opt_exclusive( COPT(VERSION) );
 
+  check_opt_mutually_exclusive( COPT(CLIENT),
+    SOPT(ALT_TOKENS)
+    SOPT(CACHE_DIR)
+    SOPT(COLOR)
+    SOPT(COMMANDS)
+    SOPT(CONFIG)
+    SOPT(DIGRAPHS)
+    SOPT(EAST_CONST)
+    SOPT(ECHO_COMMANDS)
+    SOPT(EXPLICIT_ECSU)
+    SOPT(EXPLICIT_INT)
+    SOPT(INFER_COMMAND)
+    SOPT(JOBS)
+    SOPT(JSON_LINES)
+    SOPT(LANGUAGE)
+    SOPT(LAZY_TYPEDEFS)
+    SOPT(LINENO)
+    SOPT(NO_CONFIG)
+    SOPT(NO_ENGLISH_TYPES)
+    SOPT(NO_PROMPT)
+    SOPT(NO_SEMICOLON)
+    SOPT(NO_TYPEDEFS)
+    SOPT(NO_USING)
+    SOPT(OPTIONS)
+    SOPT(PERMISSIVE_TYPES)
+    SOPT(SERVER)
+    SOPT(STATS)
+    SOPT(TRAILING_RETURN)
+    SOPT(TRIGRAPHS)
+    SOPT(WEST_DECL)
+  );
+
   check_opt_mutually_exclusive( COPT(COMMANDS),
     SOPT(ALT_TOKENS)
+    SOPT(CACHE_DIR)
+    SOPT(CLIENT)
     SOPT(COLOR)
     SOPT(DIGRAPHS)
     SOPT(EAST_CONST)
@@ -304,12 +368,17 @@ static void check_options( void ) {
     SOPT(EXPLICIT_INT)
     SOPT(FILE)
     SOPT(INFER_COMMAND)
+    SOPT(JOBS)
+    SOPT(JSON_LINES)
+    SOPT(LAZY_TYPEDEFS)
     SOPT(NO_ENGLISH_TYPES)
     SOPT(NO_PROMPT)
     SOPT(NO_SEMICOLON)
     SOPT(NO_TYPEDEFS)
     SOPT(NO_USING)
     SOPT(OPTIONS)
+    SOPT(SERVER)
+    SOPT(STATS)
     SOPT(TRAILING_RETURN)
     SOPT(TRIGRAPHS)
     SOPT(WEST_DECL)
@@ -317,6 +386,8 @@ static void check_options( void ) {
 
   check_opt_mutually_exclusive( COPT(OPTIONS),
     SOPT(ALT_TOKENS)
+    SOPT(CACHE_DIR)
+    SOPT(CLIENT)
     SOPT(COLOR)
     SOPT(COMMANDS)
     SOPT(DIGRAPHS)
@@ -325,11 +396,16 @@ static void check_options( void ) {
     SOPT(EXPLICIT_INT)
     SOPT(FILE)
     SOPT(INFER_COMMAND)
+    SOPT(JOBS)
+    SOPT(JSON_LINES)
+    SOPT(LAZY_TYPEDEFS)
     SOPT(NO_ENGLISH_TYPES)
     SOPT(NO_PROMPT)
     SOPT(NO_SEMICOLON)
     SOPT(NO_TYPEDEFS)
     SOPT(NO_USING)
+    SOPT(SERVER)
+    SOPT(STATS)
     SOPT(TRAILING_RETURN)
     SOPT(TRIGRAPHS)
     SOPT(WEST_DECL)
@@ -337,6 +413,24 @@ static void check_options( void ) {
 
   check_opt_mutually_exclusive( COPT(DIGRAPHS), SOPT(TRIGRAPHS) );
   check_opt_mutually_exclusive( COPT(FILE), SOPT(LINENO) );
+  check_opt_mutually_exclusive( COPT(JSON_LINES), SOPT(COLOR) SOPT(JOBS) );
+  check_opt_mutually_exclusive( COPT(NO_BUFFER_STDOUT),
+    SOPT(WRITE_PER_COMMAND)
+  );
+  check_opt_mutually_exclusive( COPT(SERVER),
+    SOPT(FILE) SOPT(JOBS) SOPT(JSON_LINES)
+  );
+}
+
+/**
+ * Gets the number of online CPUs.
+ *
+ * @return Returns said number or 1 if it can't be determined.
+ */
+NODISCARD
+static unsigned cpu_count( void ) {
+  long const n = sysconf( _SC_NPROCESSORS_ONLN );
+  return n > 0 ? STATIC_CAST( unsigned, n ) : 1;
 }
 
 /**
@@ -519,6 +613,7 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
   bool              opt_no_config = false;
   bool              opt_options = false;
   unsigned          opt_version = 0;
+  bool              opt_write_per_command = false;
   int               short_opt;
   char const *const short_opts = make_short_opts( OPTIONS );
 
@@ -553,6 +648,12 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
           );
         }
         break;
+      case COPT(CACHE_DIR):
+        opt_cache_dir = empty_if_null( optarg );
+        break;
+      case COPT(CLIENT):
+        opt_client_path = optarg;
+        break;
       case COPT(COLOR):
         opt_color_when = parse_color_when( optarg );
         break;
@@ -596,9 +697,21 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
       case COPT(INFER_COMMAND):
         opt_infer_command = true;
         break;
+      case COPT(JOBS):;
+        unsigned long long const jobs = check_strtoull( optarg, 0, JOBS_MAX );
+        if ( jobs == ULLONG_MAX )
+          INVALID_OPT_VALUE( JOBS, optarg, "in range 0-%u", JOBS_MAX );
+        opt_jobs = jobs > 0 ? STATIC_CAST( unsigned, jobs ) : cpu_count();
+        break;
+      case COPT(JSON_LINES):
+        opt_json_lines = true;
+        break;
       case COPT(LANGUAGE):
         opt_lang_id = parse_lang( optarg );
         break;
+      case COPT(LAZY_TYPEDEFS):
+        opt_lazy_typedefs = true;
+        break;
       case COPT(LINENO):;
         unsigned long long n = check_strtoull( optarg, 1, USHRT_MAX );
         if ( n == ULLONG_MAX ) {
@@ -635,6 +748,12 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
       case COPT(PERMISSIVE_TYPES):
         opt_permissive_types = true;
         break;
+      case COPT(SERVER):
+        opt_server_path = optarg;
+        break;
+      case COPT(STATS):
+        opt_stats = true;
+        break;
       case COPT(TRAILING_RETURN):
         opt_trailing_ret = true;
         break;
@@ -657,6 +776,9 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
           );
         }
         break;
+      case COPT(WRITE_PER_COMMAND):
+        opt_write_per_command = true;
+        break;
 
       case ':':
         goto missing_arg;
@@ -683,6 +805,8 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
 
   if ( !opt_buffer_stdout )
     setvbuf( stdout, /*buf=*/NULL, _IONBF, /*size=*/0 );
+  else if ( opt_write_per_command )
+    print_stdout_per_command();
 
   if ( opt_commands ) {
     if ( *pargc > 0 )                   // cdecl -K foo
@@ -694,6 +818,15 @@ static void parse_options( int *const pargc, char const *const *pargv[] ) {
   if ( opt_help )
     print_usage( *pargc > 0 ? EX_USAGE : EX_OK );
 
+  if ( opt_server_path != NULL && *pargc > 0 )
+    print_usage( EX_USAGE );            // cdecl --server=PATH foo
+
+  if ( opt_json_lines ) {
+    if ( *pargc > 0 )                   // cdecl --json-lines foo
+      print_usage( EX_USAGE );
+    opt_color_when = COLOR_NEVER;       // responses are read by programs
+  }
+
   if ( opt_no_config )
     opt_read_config = false;
   else if ( opt_config_path != NULL )
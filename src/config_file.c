@@ -25,10 +25,21 @@
 
 // local
 #include "pjl_config.h"                 /* must go first */
+#include "config_file.h"
+#include "c_ast.h"
+#include "c_ast_save.h"
+#include "bit_util.h"
+#include "c_sname.h"
+#include "c_typedef.h"
 #include "cdecl.h"
+#include "lexer.h"
 #include "options.h"
+#include "p_macro.h"
+#include "p_token.h"
 #include "parse.h"
 #include "print.h"
+#include "prompt.h"
+#include "result_cache.h"
 #include "strbuf.h"
 #include "types.h"
 #include "util.h"
@@ -38,15 +49,20 @@
 // standard
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>                   /* for PRIx64, SCNx64 */
+#include <limits.h>                     /* for PATH_MAX */
 #if HAVE_PWD_H
 # include <pwd.h>                       /* for getpwuid() */
 #endif /* HAVE_PWD_H */
 #include <stdbool.h>
+#include <stdint.h>                     /* for uint64_t */
 #include <stdio.h>
 #include <stdlib.h>                     /* for exit(3), getenv(3) */
 #include <string.h>
+#include <sys/stat.h>
 #include <sysexits.h>
 #include <unistd.h>                     /* for geteuid(2) */
+#include <wordexp.h>
 
 /// @endcond
 
@@ -56,6 +72,11 @@
  * @{
  */
 
+/**
+ * The first line of a configuration snapshot file.
+ */
+#define CONFIG_SNAPSHOT_MAGIC     "// " CDECL " configuration snapshot 2\n"
+
 ////////// enums //////////////////////////////////////////////////////////////
 
 /**
@@ -67,20 +88,133 @@ enum config_opts {
   CONFIG_OPT_IGNORE_NOT_FOUND  = 1 << 1   ///< Ignore file not found.
 };
 
+/**
+ * Every option a configuration file may set.
+ *
+ * @sa #CONFIG_OPTION_NAMES
+ * @sa config_options
+ */
+enum config_option {
+  CONFIG_OPTION_ALT_TOKENS,             ///< \ref opt_alt_tokens.
+  CONFIG_OPTION_EAST_CONST,             ///< \ref opt_east_const.
+  CONFIG_OPTION_ENGLISH_TYPES,          ///< \ref opt_english_types.
+  CONFIG_OPTION_EXPLICIT_ECSU,          ///< \ref opt_explicit_ecsu_btids.
+  CONFIG_OPTION_EXPLICIT_INT_SIGNED,    ///< Explicit signed `int` types.
+  CONFIG_OPTION_EXPLICIT_INT_UNSIGNED,  ///< Explicit unsigned `int` types.
+  CONFIG_OPTION_GRAPH,                  ///< \ref opt_graph.
+  CONFIG_OPTION_INCLUDE_ONCE,           ///< \ref opt_include_once.
+  CONFIG_OPTION_INFER_COMMAND,          ///< \ref opt_infer_command.
+  CONFIG_OPTION_LANG,                   ///< \ref opt_lang_id.
+  CONFIG_OPTION_PERMISSIVE_TYPES,       ///< \ref opt_permissive_types.
+  CONFIG_OPTION_PROMPT,                 ///< \ref opt_prompt.
+  CONFIG_OPTION_SEMICOLON,              ///< \ref opt_semicolon.
+  CONFIG_OPTION_TRAILING_RETURN,        ///< \ref opt_trailing_ret.
+  CONFIG_OPTION_USING,                  ///< \ref opt_using.
+  CONFIG_OPTION_WEST_DECL,              ///< \ref opt_west_decl_kinds.
+  CONFIG_OPTION_COUNT                   ///< Number of options.
+};
+
 ////////// typedefs ///////////////////////////////////////////////////////////
 
 typedef enum config_opts config_opts_t;
 
+////////// structs ////////////////////////////////////////////////////////////
+
+/**
+ * The values of every option a configuration file may set.
+ *
+ * @remarks Every value is stored as a `uint64_t` so that each can be written
+ * to and read from a configuration snapshot by name independently of the
+ * types and layout of the option variables.
+ *
+ * @sa config_options_get()
+ * @sa config_options_set()
+ */
+struct config_options {
+  uint64_t  value[ CONFIG_OPTION_COUNT ]; ///< Indexed by \ref config_option.
+};
+typedef struct config_options config_options_t;
+
+/**
+ * A growable array of user-defined types.
+ *
+ * @sa config_snapshot_tdef_visitor()
+ */
+struct config_tdefs {
+  c_typedef_t const **tdefs;            ///< The types.
+  size_t              len;              ///< Length of \ref tdefs.
+  size_t              cap;              ///< Capacity of \ref tdefs.
+};
+typedef struct config_tdefs config_tdefs_t;
+
+////////// local constants ////////////////////////////////////////////////////
+
+/**
+ * The names of the options in a configuration snapshot indexed by \ref
+ * config_option.
+ */
+static char const *const CONFIG_OPTION_NAMES[] = {
+  [ CONFIG_OPTION_ALT_TOKENS            ] = "alt-tokens",
+  [ CONFIG_OPTION_EAST_CONST            ] = "east-const",
+  [ CONFIG_OPTION_ENGLISH_TYPES         ] = "english-types",
+  [ CONFIG_OPTION_EXPLICIT_ECSU         ] = "explicit-ecsu",
+  [ CONFIG_OPTION_EXPLICIT_INT_SIGNED   ] = "explicit-int-signed",
+  [ CONFIG_OPTION_EXPLICIT_INT_UNSIGNED ] = "explicit-int-unsigned",
+  [ CONFIG_OPTION_GRAPH                 ] = "graph",
+  [ CONFIG_OPTION_INCLUDE_ONCE          ] = "include-once",
+  [ CONFIG_OPTION_INFER_COMMAND         ] = "infer-command",
+  [ CONFIG_OPTION_LANG                  ] = "lang",
+  [ CONFIG_OPTION_PERMISSIVE_TYPES      ] = "permissive-types",
+  [ CONFIG_OPTION_PROMPT                ] = "prompt",
+  [ CONFIG_OPTION_SEMICOLON             ] = "semicolon",
+  [ CONFIG_OPTION_TRAILING_RETURN       ] = "trailing-return",
+  [ CONFIG_OPTION_USING                 ] = "using",
+  [ CONFIG_OPTION_WEST_DECL             ] = "west-decl",
+};
+static_assert( ARRAY_SIZE( CONFIG_OPTION_NAMES ) == CONFIG_OPTION_COUNT );
+
 ////////// local functions ////////////////////////////////////////////////////
 
 NODISCARD
 static FILE*        config_open( char const*, config_opts_t );
 
+static void         config_snapshot_put_file( char const*, char const*,
+                                              struct stat const* );
+
 NODISCARD
 static char const*  home_dir( void );
 
+////////// local variables ////////////////////////////////////////////////////
+
+/// AST nodes of the types read from a configuration snapshot.
+static c_ast_arena_t config_ast_arena;
+
+static FILE        *config_found_file;  ///< Configuration file, if found.
+static bool         config_found;       ///< Was config_find_once() called?
+static strbuf_t     config_path_sbuf;   ///< Path of \ref config_found_file.
+
+/// The `file` lines of the configuration snapshot being written.
+static strbuf_t     config_snapshot_files;
+
+/// Can the files read so far be written to a configuration snapshot?
+static bool         config_snapshot_files_ok;
+
+/// Did the configuration file include any other file?
+static bool         config_included_files;
+
 ////////// local functions ////////////////////////////////////////////////////
 
+/**
+ * Cleans-up all configuration file data at program termination.
+ *
+ * @note This function is called only via **atexit**(3).
+ *
+ * @sa config_snapshot_get_types()
+ */
+static void config_cleanup( void ) {
+  c_ast_arena_cleanup( &config_ast_arena );
+}
+
 /**
  * Finds and opens the configuration file.
  *
@@ -192,6 +326,25 @@ static FILE* config_find( char const *config_path, strbuf_t *sbuf ) {
   return config_file;
 }
 
+/**
+ * Finds and opens the configuration file, but only the first time it's
+ * called.
+ *
+ * @param config_path The full path to a configuration file.  May be NULL.
+ * @return Returns the `FILE*` for the configuration file if found or NULL if
+ * not.
+ *
+ * @sa config_find()
+ */
+NODISCARD
+static FILE* config_find_once( char const *config_path ) {
+  if ( !config_found ) {
+    config_found_file = config_find( config_path, &config_path_sbuf );
+    config_found = true;
+  }
+  return config_found_file;
+}
+
 /**
  * Tries to open a configuration file given by \a path.
  *
@@ -213,6 +366,7 @@ static FILE* config_open( char const *path, config_opts_t opts ) {
           break;
         FALLTHROUGH;
       default:
+        print_stderr_begin();
         EPRINTF( "%s: ", prog_name );
         if ( (opts & CONFIG_OPT_ERROR_IS_FATAL) != 0 ) {
           print_error( /*loc=*/NULL,
@@ -230,6 +384,558 @@ static FILE* config_open( char const *path, config_opts_t opts ) {
   return config_file;
 }
 
+/**
+ * Gets the values of every option a configuration file may set.
+ *
+ * @param options The \ref config_options to get the values into.
+ *
+ * @sa config_options_set()
+ */
+static void config_options_get( config_options_t *options ) {
+  assert( options != NULL );
+
+  options_snapshot_t snapshot;
+  options_save( &snapshot );
+
+  *options = (config_options_t){ .value = {
+    [ CONFIG_OPTION_ALT_TOKENS            ] = opt_alt_tokens,
+    [ CONFIG_OPTION_EAST_CONST            ] = snapshot.east_const,
+    [ CONFIG_OPTION_ENGLISH_TYPES         ] = opt_english_types,
+    [ CONFIG_OPTION_EXPLICIT_ECSU         ] = opt_explicit_ecsu_btids,
+    [ CONFIG_OPTION_EXPLICIT_INT_SIGNED   ] = snapshot.explicit_int_btids[0],
+    [ CONFIG_OPTION_EXPLICIT_INT_UNSIGNED ] = snapshot.explicit_int_btids[1],
+    [ CONFIG_OPTION_GRAPH                 ] = opt_graph,
+    [ CONFIG_OPTION_INCLUDE_ONCE          ] = opt_include_once,
+    [ CONFIG_OPTION_INFER_COMMAND         ] = opt_infer_command,
+    [ CONFIG_OPTION_LANG                  ] = snapshot.lang_id,
+    [ CONFIG_OPTION_PERMISSIVE_TYPES      ] = opt_permissive_types,
+    [ CONFIG_OPTION_PROMPT                ] = opt_prompt,
+    [ CONFIG_OPTION_SEMICOLON             ] = opt_semicolon,
+    [ CONFIG_OPTION_TRAILING_RETURN       ] = opt_trailing_ret,
+    [ CONFIG_OPTION_USING                 ] = opt_using,
+    [ CONFIG_OPTION_WEST_DECL             ] = opt_west_decl_kinds,
+  } };
+}
+
+/**
+ * Sets the values of every option a configuration file may set.
+ *
+ * @remarks Unlike the `set` command, this never warns about an option that's
+ * not supported in the current language.
+ *
+ * @param options The \ref config_options to set the values from.
+ *
+ * @sa config_options_get()
+ */
+static void config_options_set( config_options_t const *options ) {
+  assert( options != NULL );
+  uint64_t const *const value = options->value;
+
+  options_restore( &(options_snapshot_t){
+    .east_const = value[ CONFIG_OPTION_EAST_CONST ] != 0,
+    .explicit_int_btids = {
+      value[ CONFIG_OPTION_EXPLICIT_INT_SIGNED   ],
+      value[ CONFIG_OPTION_EXPLICIT_INT_UNSIGNED ]
+    },
+    .lang_id = STATIC_CAST( c_lang_id_t, value[ CONFIG_OPTION_LANG ] )
+  } );
+  opt_alt_tokens = value[ CONFIG_OPTION_ALT_TOKENS ] != 0;
+  opt_english_types = value[ CONFIG_OPTION_ENGLISH_TYPES ] != 0;
+  opt_explicit_ecsu_btids = value[ CONFIG_OPTION_EXPLICIT_ECSU ];
+  opt_graph = STATIC_CAST( c_graph_t, value[ CONFIG_OPTION_GRAPH ] );
+  opt_include_once = value[ CONFIG_OPTION_INCLUDE_ONCE ] != 0;
+  opt_infer_command = value[ CONFIG_OPTION_INFER_COMMAND ] != 0;
+  opt_permissive_types = value[ CONFIG_OPTION_PERMISSIVE_TYPES ] != 0;
+  opt_prompt = value[ CONFIG_OPTION_PROMPT ] != 0;
+  opt_semicolon = value[ CONFIG_OPTION_SEMICOLON ] != 0;
+  opt_trailing_ret = value[ CONFIG_OPTION_TRAILING_RETURN ] != 0;
+  opt_using = value[ CONFIG_OPTION_USING ] != 0;
+  opt_west_decl_kinds =
+    STATIC_CAST( c_ast_kind_t, value[ CONFIG_OPTION_WEST_DECL ] );
+  cdecl_prompt_enable();
+}
+
+/**
+ * Notes that the configuration file included a file and, if a configuration
+ * snapshot is being written, appends a `file` line for it.
+ *
+ * @param path The path of the file as given by the `include` command.
+ * @param real_path The resolved path of the file.
+ * @param st The status of the file.
+ *
+ * @sa config_snapshot_put_file()
+ */
+static void config_include_file( char const *path, char const *real_path,
+                                 struct stat const *st ) {
+  config_included_files = true;
+  if ( config_snapshot_files_ok )
+    config_snapshot_put_file( path, real_path, st );
+}
+
+/**
+ * Checks whether \a line is a `file` line of a configuration snapshot whose
+ * file hasn't changed.
+ *
+ * @param line The line to check.
+ * @return Returns `true` only if the file hasn't changed.
+ *
+ * @sa config_snapshot_put_file()
+ */
+NODISCARD
+static bool config_snapshot_check_file( char *line ) {
+  assert( line != NULL );
+
+  intmax_t mtime, size;
+  int n = 0;
+  if ( sscanf( line, "// file %jd %jd %n", &mtime, &size, &n ) != 2 ||
+       n == 0 ) {
+    return false;
+  }
+
+  char *const real_path = line + n;
+  char *const tab = strchr( real_path, '\t' );
+  if ( tab == NULL )
+    return false;
+  *tab = '\0';
+  char *const path = tab + 1;
+  path[ strcspn( path, "\n" ) ] = '\0';
+
+  struct stat st;
+  if ( stat( real_path, &st ) < 0 ||
+       STATIC_CAST( intmax_t, st.st_mtime ) != mtime ||
+       STATIC_CAST( intmax_t, st.st_size ) != size ) {
+    return false;
+  }
+
+  if ( path[0] == '\0' )               // the configuration file itself
+    return true;
+  config_included_files = true;
+
+  //
+  // An included file must still be what its path resolves to since the path
+  // may be relative or contain environment variables.
+  //
+  wordexp_t we;
+  if ( wordexp( path, &we, WRDE_NOCMD ) != 0 )
+    return false;
+  char real_path_buf[ PATH_MAX ];
+  bool const ok = we.we_wordc == 1 &&
+    realpath( we.we_wordv[0], real_path_buf ) != NULL &&
+    strcmp( real_path_buf, real_path ) == 0;
+  wordfree( &we );
+  return ok;
+}
+
+/**
+ * Checks the header of a configuration snapshot file.
+ *
+ * @param file The configuration snapshot file to check.
+ * @param options The \ref config_options to receive the values of the options
+ * after the configuration file was read.
+ * @param rv_tdef_count A pointer to receive the number of types that follow
+ * the header.
+ * @return Returns `true` only if the snapshot was written by this version of
+ * **cdecl** given the same options and the configuration file and every file
+ * it included is unchanged.
+ *
+ * @sa config_snapshot_write()
+ */
+NODISCARD
+static bool config_snapshot_check( FILE *file, config_options_t *options,
+                                   size_t *rv_tdef_count ) {
+  assert( file != NULL );
+  assert( options != NULL );
+  assert( rv_tdef_count != NULL );
+
+  char *line = NULL;
+  size_t line_cap = 0;
+  bool ok = false;
+
+  if ( getline( &line, &line_cap, file ) == -1 ||
+       strcmp( line, CONFIG_SNAPSHOT_MAGIC ) != 0 ) {
+    goto done;
+  }
+
+  size_t hash;
+  if ( getline( &line, &line_cap, file ) == -1 ||
+       sscanf( line, "// key %zx", &hash ) != 1 ||
+       hash != result_cache_dir_hash() ) {
+    goto done;
+  }
+
+  for ( unsigned i = 0; i < CONFIG_OPTION_COUNT; ++i ) {
+    char name[ 32 ];
+    if ( getline( &line, &line_cap, file ) == -1 ||
+         sscanf( line, "// option %31s %" SCNx64, name,
+                 &options->value[i] ) != 2 ||
+         strcmp( name, CONFIG_OPTION_NAMES[i] ) != 0 ) {
+      goto done;
+    }
+  } // for
+
+  bool any_files = false;
+  while ( getline( &line, &line_cap, file ) != -1 &&
+          strncmp( line, "// file ", STRLITLEN( "// file " ) ) == 0 ) {
+    if ( !config_snapshot_check_file( line ) )
+      goto done;
+    any_files = true;
+  } // while
+
+  ok = any_files && sscanf( line, "// types %zu", rv_tdef_count ) == 1;
+
+done:
+  free( line );
+  return ok;
+}
+
+/**
+ * Gets the path of the configuration snapshot file for a configuration file.
+ *
+ * @param real_path The resolved path of the configuration file.
+ * @param rv_path The \ref strbuf to append the path onto.
+ * @return Returns `true` only if the path was gotten.
+ */
+NODISCARD
+static bool config_snapshot_path( char const *real_path, strbuf_t *rv_path ) {
+  assert( real_path != NULL );
+  assert( rv_path != NULL );
+
+  char name[ STRLITLEN( "config-" ) + 16 + 1/*\0*/ ];
+  check_snprintf( name, sizeof name, "config-%016" PRIx64,
+    fnv1a( FNV1A_INIT, real_path, strlen( real_path ) )
+  );
+  return result_cache_dir_path( name, rv_path );
+}
+
+/**
+ * Appends a `file` line for a file that was read onto \ref
+ * config_snapshot_files.
+ *
+ * @param path The path of the file as given by the `include` command or the
+ * empty string for the configuration file itself.
+ * @param real_path The resolved path of the file.
+ * @param st The status of the file.
+ *
+ * @sa config_snapshot_check_file()
+ */
+static void config_snapshot_put_file( char const *path, char const *real_path,
+                                      struct stat const *st ) {
+  assert( path != NULL );
+  assert( real_path != NULL );
+  assert( st != NULL );
+
+  if ( strpbrk( path, "\t\n" ) != NULL ||
+       strpbrk( real_path, "\t\n" ) != NULL ) {
+    config_snapshot_files_ok = false;
+    return;
+  }
+
+  strbuf_printf( &config_snapshot_files,
+    "// file %jd %jd %s\t%s\n",
+    STATIC_CAST( intmax_t, st->st_mtime ),
+    STATIC_CAST( intmax_t, st->st_size ),
+    real_path, path
+  );
+}
+
+/**
+ * Appends a `#define` for \a macro onto \a sbuf.
+ *
+ * @param macro The \ref p_macro to append.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa show_macro()
+ */
+static void config_snapshot_put_macro( p_macro_t const *macro,
+                                       strbuf_t *sbuf ) {
+  assert( macro != NULL );
+  assert( sbuf != NULL );
+
+  strbuf_printf( sbuf, "#define %s", macro->name );
+  if ( macro->param_list != NULL ) {
+    strbuf_putc( sbuf, '(' );
+    FOREACH_SLIST_NODE( param_node, macro->param_list ) {
+      p_param_t const *const param = param_node->data;
+      strbuf_puts( sbuf, param->name );
+      if ( param_node->next != NULL )
+        strbuf_puts( sbuf, ", " );
+    } // for
+    strbuf_putc( sbuf, ')' );
+  }
+  if ( !slist_empty( &macro->replace_list ) ) {
+    strbuf_putc( sbuf, ' ' );
+    strbuf_puts( sbuf, p_token_list_str( &macro->replace_list ) );
+  }
+  strbuf_putc( sbuf, '\n' );
+}
+
+/**
+ * Compares two \ref c_typedef pointers by the order in which they were
+ * defined.
+ *
+ * @param i_tdef A pointer to the first \ref c_typedef pointer.
+ * @param j_tdef A pointer to the second \ref c_typedef pointer.
+ * @return Returns a number less than 0, 0, or greater than 0 if the type
+ * pointed to by \a i_tdef was defined before, at the same time as, or after
+ * that pointed to by \a j_tdef, respectively.
+ */
+NODISCARD
+static int config_snapshot_tdef_cmp( c_typedef_t const *const *i_tdef,
+                                     c_typedef_t const *const *j_tdef ) {
+  unsigned const i_order = (*i_tdef)->def_order;
+  unsigned const j_order = (*j_tdef)->def_order;
+  return (i_order > j_order) - (i_order < j_order);
+}
+
+/**
+ * A visitor function to append \a tdef onto a \ref config_tdefs if it's
+ * user-defined.
+ *
+ * @param tdef The \ref c_typedef to visit.
+ * @param visit_data A \ref config_tdefs.
+ * @return Always returns `false`.
+ */
+NODISCARD
+static bool config_snapshot_tdef_visitor( c_typedef_t const *tdef,
+                                          void *visit_data ) {
+  assert( tdef != NULL );
+  assert( visit_data != NULL );
+
+  if ( !tdef->is_predefined ) {
+    config_tdefs_t *const ct = visit_data;
+    if ( ct->len == ct->cap ) {
+      ct->cap = ct->cap > 0 ? ct->cap * 2 : 16;
+      REALLOC( ct->tdefs, ct->cap );
+    }
+    ct->tdefs[ ct->len++ ] = tdef;
+  }
+  return /*stop=*/false;
+}
+
+/**
+ * Appends every user-defined type, each saved via c_ast_save(), then every
+ * macro, as a **cdecl** command, onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @return Returns `true` only if every type was saved.
+ *
+ * @sa config_snapshot_get_types()
+ */
+NODISCARD
+static bool config_snapshot_put_defs( strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+
+  config_tdefs_t ct = { 0 };
+  c_typedef_visit( &config_snapshot_tdef_visitor, &ct );
+  if ( ct.len > 0 ) {
+    qsort(
+      ct.tdefs, ct.len, sizeof ct.tdefs[0],
+      POINTER_CAST( qsort_cmp_fn_t, &config_snapshot_tdef_cmp )
+    );
+  }
+
+  strbuf_printf( sbuf, "// types %zu\n", ct.len );
+  bool ok = true;
+  for ( size_t i = 0; ok && i < ct.len; ++i ) {
+    c_typedef_t const *const tdef = ct.tdefs[i];
+    strbuf_printf( sbuf,
+      "%x %x ",
+      STATIC_CAST( unsigned, tdef->lang_ids ),
+      STATIC_CAST( unsigned, tdef->decl_flags )
+    );
+    ok = c_ast_save( tdef->ast, sbuf );
+    strbuf_putc( sbuf, '\n' );
+  } // for
+  free( ct.tdefs );
+  if ( !ok )
+    return false;
+
+  //
+  // Print macros without either alternative tokens or di/trigraphs so they
+  // can always be read back.
+  //
+  bool const      orig_alt_tokens = opt_alt_tokens;
+  c_graph_t const orig_graph      = opt_graph;
+  opt_alt_tokens = false;
+  opt_graph = C_GRAPH_NONE;
+
+  p_macro_iterator_t iter;
+  p_macro_iterator_init( &iter );
+  for ( p_macro_t const *macro;
+        (macro = p_macro_iterator_next( &iter )) != NULL; ) {
+    if ( !macro->is_dynamic )
+      config_snapshot_put_macro( macro, sbuf );
+  } // for
+
+  opt_alt_tokens = orig_alt_tokens;
+  opt_graph = orig_graph;
+  return true;
+}
+
+/**
+ * Reads the types of a configuration snapshot file and defines them.
+ *
+ * @param file The configuration snapshot file to read from positioned just
+ * after its header.
+ * @param tdef_count The number of types to read.
+ * @return Returns `true` only if all the types were defined.  If not, none
+ * are.
+ *
+ * @sa config_snapshot_put_defs()
+ */
+NODISCARD
+static bool config_snapshot_get_types( FILE *file, size_t tdef_count ) {
+  assert( file != NULL );
+
+  rb_node_t **const nodes = MALLOC( rb_node_t*, tdef_count + 1 );
+  char *line = NULL;
+  size_t line_cap = 0;
+  size_t added = 0;
+
+  for ( ; added < tdef_count; ++added ) {
+    unsigned lang_ids, decl_flags;
+    int ast_pos = 0;
+    if ( getline( &line, &line_cap, file ) == -1 ||
+         sscanf( line, "%x %x %n", &lang_ids, &decl_flags, &ast_pos ) != 2 ||
+         ast_pos == 0 ||
+         !is_1_bit_only_in_set( decl_flags, C_TYPE_DECL_ANY ) ) {
+      break;
+    }
+
+    char const *s = line + ast_pos;
+    c_ast_t *const ast = c_ast_load( &s, &config_ast_arena );
+    if ( ast == NULL || *s != '\n' || c_sname_empty( &ast->sname ) )
+      break;
+
+    rb_node_t *const node =
+      c_typedef_add( ast, STATIC_CAST( decl_flags_t, decl_flags ) );
+    c_typedef_t *const tdef = RB_DINT( node );
+    if ( tdef->ast != ast )             // type was already defined
+      break;
+    tdef->lang_ids = lang_ids;
+    nodes[ added ] = node;
+  } // for
+
+  bool const ok = added == tdef_count;
+  if ( ok ) {
+    c_ast_arena_keep( &config_ast_arena );
+    ATEXIT( &config_cleanup );
+  }
+  else {
+    while ( added > 0 )
+      c_typedef_remove( nodes[ --added ] );
+    c_ast_arena_cleanup( &config_ast_arena );
+  }
+
+  free( line );
+  free( nodes );
+  return ok;
+}
+
+/**
+ * Reads a configuration snapshot file, if it exists and is still valid,
+ * instead of the configuration file.
+ *
+ * @param path The path of the configuration snapshot file.
+ * @return Returns `true` only if the snapshot was read.
+ *
+ * @sa config_snapshot_write()
+ */
+NODISCARD
+static bool config_snapshot_read( char const *path ) {
+  assert( path != NULL );
+
+  FILE *const file = fopen( path, "r" );
+  if ( file == NULL )
+    return false;
+
+  config_options_t options;
+  size_t tdef_count;
+  bool const ok = config_snapshot_check( file, &options, &tdef_count ) &&
+                  config_snapshot_get_types( file, tdef_count );
+  if ( ok ) {
+    config_options_set( &options );
+
+    int const c = getc( file );
+    if ( c != EOF ) {
+      //
+      // Only macros, if any, are still defined by parsing cdecl commands, but
+      // they're printed without either alternative tokens or di/trigraphs.
+      //
+      PJL_DISCARD_RV( ungetc( c, file ) );
+      bool const      orig_alt_tokens = opt_alt_tokens;
+      c_graph_t const orig_graph      = opt_graph;
+      opt_alt_tokens = false;
+      opt_graph = C_GRAPH_NONE;
+
+      char const *const orig_input_path = cdecl_input_path;
+      cdecl_input_path = path;
+      int const rv_parse = cdecl_parse_file( file );
+      cdecl_input_path = orig_input_path;
+
+      opt_alt_tokens = orig_alt_tokens;
+      opt_graph = orig_graph;
+
+      if ( rv_parse != EX_OK ) {
+        PJL_DISCARD_RV( unlink( path ) ); // so it's not read again
+        exit( rv_parse );
+      }
+    }
+  }
+
+  fclose( file );
+  return ok;
+}
+
+/**
+ * Writes a configuration snapshot file.
+ *
+ * @param path The path of the configuration snapshot file.
+ *
+ * @note Since the snapshot is only a cache, errors are silently ignored.
+ *
+ * @sa config_snapshot_read()
+ */
+static void config_snapshot_write( char const *path ) {
+  assert( path != NULL );
+
+  strbuf_t sbuf, tmp_path;
+  strbuf_init( &sbuf );
+  strbuf_init( &tmp_path );
+
+  config_options_t options;
+  config_options_get( &options );
+
+  strbuf_puts( &sbuf, CONFIG_SNAPSHOT_MAGIC );
+  strbuf_printf( &sbuf, "// key %zx\n", result_cache_dir_hash() );
+  for ( unsigned i = 0; i < CONFIG_OPTION_COUNT; ++i ) {
+    strbuf_printf( &sbuf,
+      "// option %s %" PRIx64 "\n", CONFIG_OPTION_NAMES[i], options.value[i]
+    );
+  } // for
+  strbuf_putsn( &sbuf, config_snapshot_files.str, config_snapshot_files.len );
+  if ( !config_snapshot_put_defs( &sbuf ) )
+    goto done;
+
+  //
+  // Write to a temporary file first and rename it so a reader never sees a
+  // partially written snapshot.
+  //
+  strbuf_printf( &tmp_path, "%s.%ld", path, STATIC_CAST( long, getpid() ) );
+
+  FILE *const file = fopen( tmp_path.str, "w" );
+  if ( file != NULL ) {
+    bool const ok = fwrite( sbuf.str, 1, sbuf.len, file ) == sbuf.len;
+    if ( fclose( file ) == 0 && ok && rename( tmp_path.str, path ) == 0 )
+      goto done;
+    PJL_DISCARD_RV( unlink( tmp_path.str ) );
+  }
+
+done:
+  strbuf_cleanup( &tmp_path );
+  strbuf_cleanup( &sbuf );
+}
+
 // LCOV_EXCL_START
 /**
  * Gets the full path of the user's home directory.
@@ -259,40 +965,95 @@ static char const* home_dir( void ) {
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-/**
- * Initializes **cdecl** via a configuration file.
- *
- * @param config_path The full path of the configuration file to read. May be
- * NULL.
- *
- * @note This function must be called at most once.
- */
+bool config_hash( char const *config_path, uint64_t *rv_hash ) {
+  assert( rv_hash != NULL );
+
+  *rv_hash = 0;
+  FILE *const file = config_find_once( config_path );
+  if ( file == NULL )
+    return true;
+
+  struct stat st;
+  if ( fstat( fileno( file ), &st ) < 0 || !S_ISREG( st.st_mode ) )
+    return false;
+
+  uint64_t hash = FNV1A_INIT;
+  char buf[ 4096 ];
+  for ( size_t n; (n = fread( buf, 1, sizeof buf, file )) > 0; )
+    hash = fnv1a( hash, buf, n );
+
+  bool const ok = !ferror( file );
+  rewind( file );
+  *rv_hash = hash;
+  return ok;
+}
+
 void config_init( char const *config_path ) {
   ASSERT_RUN_ONCE();
 
-  strbuf_t sbuf;
-  strbuf_init( &sbuf );
-
-  FILE *const config_file = config_find( config_path, &sbuf );
+  FILE *const config_file = config_find_once( config_path );
 
   int rv_parse = EX_OK;
 
   if ( config_file != NULL ) {
-    cdecl_input_path = sbuf.str;
-    bool const echo_file_markers = opt_echo_commands && !cdecl_is_interactive;
-    if ( echo_file_markers )
-      PRINTF( "/* begin \"%s\" */\n", cdecl_input_path );
-    rv_parse = cdecl_parse_file( config_file );
-    if ( echo_file_markers && rv_parse == EX_OK )
-      PRINTF( "/* end \"%s\" */\n", cdecl_input_path );
+    cdecl_input_path = config_path_sbuf.str;
+
+    strbuf_t snapshot_path;
+    strbuf_init( &snapshot_path );
+    char real_path_buf[ PATH_MAX ];
+    bool const use_snapshot = opt_cache_dir != NULL && !opt_echo_commands &&
+      opt_cdecl_debug == CDECL_DEBUG_NO &&
+      realpath( config_path_sbuf.str, real_path_buf ) != NULL &&
+      config_snapshot_path( real_path_buf, &snapshot_path );
+
+    if ( !use_snapshot || !config_snapshot_read( snapshot_path.str ) ) {
+      struct stat st;
+      config_snapshot_files_ok = use_snapshot &&
+        fstat( fileno( config_file ), &st ) == 0;
+      if ( config_snapshot_files_ok )
+        config_snapshot_put_file( "", real_path_buf, &st );
+      lexer_include_fn = &config_include_file;
+      unsigned const output_gen = print_output_gen();
+
+      bool const echo_file_markers = opt_echo_commands && !cdecl_is_interactive;
+      if ( echo_file_markers )
+        PRINTF( "/* begin \"%s\" */\n", cdecl_input_path );
+      rv_parse = cdecl_parse_file( config_file );
+      if ( echo_file_markers && rv_parse == EX_OK )
+        PRINTF( "/* end \"%s\" */\n", cdecl_input_path );
+
+      lexer_include_fn = NULL;
+      //
+      // Write a snapshot only if reading the configuration file printed
+      // nothing since reading the snapshot instead wouldn't print anything.
+      //
+      if ( rv_parse == EX_OK && config_snapshot_files_ok &&
+           print_output_gen() == output_gen && !opt_echo_commands &&
+           opt_cdecl_debug == CDECL_DEBUG_NO ) {
+        config_snapshot_write( snapshot_path.str );
+      }
+      strbuf_cleanup( &config_snapshot_files );
+    }
+
+    strbuf_cleanup( &snapshot_path );
     fclose( config_file );
     cdecl_input_path = NULL;
   }
 
-  strbuf_cleanup( &sbuf );
+  strbuf_cleanup( &config_path_sbuf );
 
   if ( rv_parse != EX_OK )
     exit( rv_parse );
+
+  //
+  // The hash given to result_cache_dir_init() is only that of the
+  // configuration file itself, so results can't be cached when what an
+  // included file defines could change without the configuration file
+  // changing.  Since no result is ever added under such a configuration file,
+  // one can't have been found by cdecl_parse_cli_cached() either.
+  //
+  if ( config_included_files )
+    result_cache_dir_disable();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
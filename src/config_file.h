@@ -0,0 +1,76 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/config_file.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas, et al.
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_config_file_H
+#define cdecl_config_file_H
+
+/**
+ * @file
+ * Declares functions for reading **cdecl**'s configuration file.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+// standard
+#include <stdbool.h>
+#include <stdint.h>                     /* for uint64_t */
+
+/**
+ * @addtogroup config-file-group
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Gets a hash code of the contents of the configuration file.
+ *
+ * @param config_path The full path of the configuration file to read. May be
+ * NULL.
+ * @param rv_hash A pointer to receive said hash code.  If there is no
+ * configuration file, it's 0.
+ * @return Returns `true` only if the configuration file either wasn't found or
+ * is a plain file whose contents were read.
+ *
+ * @note The file, if found, is kept open to be read by config_init().
+ * @note The contents of files the configuration file includes aren't known
+ * until it's read, so they aren't part of the hash code; instead,
+ * config_init() disables the results cache directory if there are any.
+ */
+NODISCARD
+bool config_hash( char const *config_path, uint64_t *rv_hash );
+
+/**
+ * Initializes **cdecl** via a configuration file.
+ *
+ * @param config_path The full path of the configuration file to read. May be
+ * NULL.
+ *
+ * @note This function must be called at most once.
+ */
+void config_init( char const *config_path );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_config_file_H */
+/* vim:set et sw=2 ts=2: */
@@ -20,7 +20,7 @@
 
 /**
  * @file
- * Defines a function for calculating an _edit distance_ between two strings.
+ * Defines functions for calculating an _edit distance_ between two strings.
  */
 
 // local
@@ -33,6 +33,8 @@
 #include <stdalign.h>
 #include <stdbool.h>
 #include <stddef.h>                     /* for NULL, size_t */
+#include <stdint.h>                     /* for uint64_t */
+#include <string.h>                     /* for memset(3) */
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -64,6 +66,74 @@ static void** matrix2d_new( size_t esize, size_t ealign, size_t idim,
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+size_t dam_lev_bits_dist( dam_lev_bits_t const *dlb, char const *target,
+                          size_t tlen, size_t max_dist ) {
+  assert( dlb != NULL );
+  assert( target != NULL );
+
+  size_t const slen = dlb->len;
+  size_t const len_diff = slen > tlen ? slen - tlen : tlen - slen;
+  if ( len_diff > max_dist )
+    return max_dist + 1;
+  if ( slen == 0 )
+    return tlen;
+
+  //
+  // Each column j of the distance matrix is represented by the vertical
+  // deltas between adjacent rows: bit i of vp (vn) is set if D[i+1][j] -
+  // D[i][j] is +1 (-1).  Only the distance in the last row is kept explicitly.
+  //
+  uint64_t const last_bit = 1ull << (slen - 1);
+  uint64_t vp = ~0ull;
+  uint64_t vn = 0;
+  uint64_t d0 = ~0ull;                  // previous column's zero deltas
+  uint64_t pm_prev = 0;                 // previous column's match vector
+  size_t dist = slen;
+
+  for ( size_t col = 1; col <= tlen; ++col ) {
+    uint64_t const pm = dlb->peq[ STATIC_CAST( unsigned char, target[ col - 1 ] ) ];
+    uint64_t const tr = ((~d0 & pm) << 1) & pm_prev;
+    d0 = (((pm & vp) + vp) ^ vp) | pm | vn | tr;
+    uint64_t hp = vn | ~(d0 | vp);
+    uint64_t hn = d0 & vp;
+
+    if ( (hp & last_bit) != 0 )
+      ++dist;
+    else if ( (hn & last_bit) != 0 )
+      --dist;
+
+    //
+    // The distance can decrease by at most 1 per remaining column, so if it
+    // can't get back down to max_dist, stop.
+    //
+    if ( dist > max_dist + (tlen - col) )
+      return max_dist + 1;
+
+    hp = (hp << 1) | 1;
+    hn <<= 1;
+    vp = hn | ~(d0 | hp);
+    vn = hp & d0;
+    pm_prev = pm;
+  } // for
+
+  return dist;
+}
+
+bool dam_lev_bits_init( dam_lev_bits_t *dlb, char const *source,
+                        size_t slen ) {
+  assert( dlb != NULL );
+  assert( source != NULL );
+
+  if ( slen > DAM_LEV_BITS_MAX )
+    return false;
+
+  memset( dlb->peq, 0, sizeof dlb->peq );
+  for ( size_t i = 0; i < slen; ++i )
+    dlb->peq[ STATIC_CAST( unsigned char, source[i] ) ] |= 1ull << i;
+  dlb->len = slen;
+  return true;
+}
+
 size_t dam_lev_dist( void *working_mem, char const *source, size_t slen,
                      char const *target, size_t tlen ) {
   assert( working_mem != NULL );
@@ -23,17 +23,79 @@
 
 /**
  * @file
- * Declares a function for calculating an _edit distance_ between two strings.
+ * Declares functions for calculating an _edit distance_ between two strings.
  */
 
 // local
 #include "pjl_config.h"                 /* must go first */
 
 // standard
+#include <stdbool.h>
 #include <stddef.h>                     /* for size_t */
+#include <stdint.h>                     /* for uint64_t */
+
+/**
+ * The maximum length of a source string that dam_lev_bits_init() accepts.
+ */
+#define DAM_LEV_BITS_MAX          64u
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A source string compiled for use with dam_lev_bits_dist().
+ *
+ * @sa dam_lev_bits_init()
+ */
+struct dam_lev_bits {
+  uint64_t  peq[256];                   ///< Bit-vector of positions per char.
+  size_t    len;                        ///< Length of the source string.
+};
+typedef struct dam_lev_bits dam_lev_bits_t;
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+/**
+ * Calculates the _restricted_ Damerau-Levenshtein distance (also known as the
+ * _optimal string alignment distance_) between the source string given to
+ * dam_lev_bits_init() and \a target, but only up to \a max_dist.
+ *
+ * @remarks Unlike dam_lev_dist(), this uses bit-parallelism to calculate an
+ * entire column of the distance matrix at once, needs no working memory, and
+ * stops as soon as the distance is known to exceed \a max_dist.  It differs
+ * from dam_lev_dist() only in that a substring may not be edited more than
+ * once, e.g., the distance between `ca` and `abc` is 3 rather than 2.
+ *
+ * @param dlb The \ref dam_lev_bits initialized by dam_lev_bits_init().
+ * @param target The target string.
+ * @param target_len The length of \a target.
+ * @param max_dist The maximum distance of interest.
+ * @return Returns said distance if it's &le; \a max_dist or \a max_dist + 1
+ * otherwise.
+ *
+ * @sa Heikki Hyyrö. "A Bit-Vector Algorithm for Computing Levenshtein and
+ * Damerau Edit Distances." _Nordic Journal of Computing_, 10(1), 2003.
+ * @sa dam_lev_bits_init()
+ * @sa dam_lev_dist()
+ */
+NODISCARD
+size_t dam_lev_bits_dist( dam_lev_bits_t const *dlb, char const *target,
+                          size_t target_len, size_t max_dist );
+
+/**
+ * Initializes \a dlb for use with subsequent calls of dam_lev_bits_dist().
+ *
+ * @param dlb The \ref dam_lev_bits to initialize.
+ * @param source The source string.
+ * @param source_len The length of \a source.
+ * @return Returns `true` only if \a source_len &le; #DAM_LEV_BITS_MAX; if
+ * `false`, \a dlb is not initialized and dam_lev_dist() must be used instead.
+ *
+ * @sa dam_lev_bits_dist()
+ */
+NODISCARD
+bool dam_lev_bits_init( dam_lev_bits_t *dlb, char const *source,
+                        size_t source_len );
+
 /**
  * Calculates the _Damerau-Levenshtein distance_ between two strings, that is
  * the number of letters that need to be transposed within, substituted within,
@@ -48,6 +110,7 @@
  *
  * @sa [Damerau–Levenshtein distance](https://en.wikipedia.org/wiki/Damerau–Levenshtein_distance)
  * @sa [Damerau–Levenshtein Edit Distance Explained](https://www.lemoda.net/text-fuzzy/damerau-levenshtein/)
+ * @sa dam_lev_bits_dist()
  */
 NODISCARD
 size_t dam_lev_dist( void *working_mem, char const *source, size_t source_len,
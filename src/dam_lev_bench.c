@@ -0,0 +1,194 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/dam_lev_bench.c
+**
+**      Copyright (C) 2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Benchmarks dam_lev_bits_dist() against dam_lev_dist() by calculating the
+ * distances between a number of unknown words and a large set of identifiers
+ * the way dym_index_find() does.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "dam_lev.h"
+#include "util.h"
+
+// standard
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <time.h>
+
+/// The number of known identifiers.
+#define BENCH_KNOWN_MAX           20000u
+
+/// The maximum length of an identifier.
+#define BENCH_KNOWN_LEN_MAX       24u
+
+/// The number of unknown words.
+#define BENCH_UNKNOWN_MAX         200u
+
+/// The edit distance must be less than or equal to this percent of a known
+/// identifier's length in order to be "similar enough" (same as cdecl_dym.c).
+#define BENCH_SIMILAR_PERCENT     .37
+
+////////// extern variables ///////////////////////////////////////////////////
+
+char const *prog_name;
+
+////////// local variables ////////////////////////////////////////////////////
+
+/// The known identifiers.
+static char   known[ BENCH_KNOWN_MAX ][ BENCH_KNOWN_LEN_MAX + 1 ];
+
+/// The lengths of \ref known.
+static size_t known_len[ BENCH_KNOWN_MAX ];
+
+/// The maximum of \ref known_len.
+static size_t known_len_max;
+
+/// The unknown words.
+static char   unknown[ BENCH_UNKNOWN_MAX ][ BENCH_KNOWN_LEN_MAX + 1 ];
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Benchmarks dam_lev_bits_dist().
+ *
+ * @param rv_similar Set to the number of candidates that are similar enough.
+ * @return Returns the number of CPU seconds taken.
+ */
+static double bench_bits( size_t *rv_similar ) {
+  size_t similar = 0;
+  clock_t const start = clock();
+
+  for ( size_t u = 0; u < BENCH_UNKNOWN_MAX; ++u ) {
+    dam_lev_bits_t dlb;
+    if ( !dam_lev_bits_init( &dlb, unknown[u], strlen( unknown[u] ) ) )
+      continue;                         // LCOV_EXCL_LINE
+    for ( size_t k = 0; k < BENCH_KNOWN_MAX; ++k ) {
+      size_t const max_dist = STATIC_CAST( size_t,
+        STATIC_CAST( double, known_len[k] ) * BENCH_SIMILAR_PERCENT + 0.5
+      );
+      size_t const dist =
+        dam_lev_bits_dist( &dlb, known[k], known_len[k], max_dist );
+      similar += dist <= max_dist;
+    } // for
+  } // for
+
+  *rv_similar = similar;
+  return STATIC_CAST( double, clock() - start ) / CLOCKS_PER_SEC;
+}
+
+/**
+ * Benchmarks dam_lev_dist().
+ *
+ * @param rv_similar Set to the number of candidates that are similar enough.
+ * @return Returns the number of CPU seconds taken.
+ */
+static double bench_matrix( size_t *rv_similar ) {
+  size_t similar = 0;
+  clock_t const start = clock();
+
+  for ( size_t u = 0; u < BENCH_UNKNOWN_MAX; ++u ) {
+    size_t const unknown_len = strlen( unknown[u] );
+    void *const dam_lev_mem = dam_lev_new( unknown_len, known_len_max );
+    for ( size_t k = 0; k < BENCH_KNOWN_MAX; ++k ) {
+      size_t const max_dist = STATIC_CAST( size_t,
+        STATIC_CAST( double, known_len[k] ) * BENCH_SIMILAR_PERCENT + 0.5
+      );
+      size_t const dist = dam_lev_dist(
+        dam_lev_mem, unknown[u], unknown_len, known[k], known_len[k]
+      );
+      similar += dist <= max_dist;
+    } // for
+    free( dam_lev_mem );
+  } // for
+
+  *rv_similar = similar;
+  return STATIC_CAST( double, clock() - start ) / CLOCKS_PER_SEC;
+}
+
+/**
+ * Generates the known identifiers and the unknown words.
+ *
+ * @remarks Each unknown word is a known identifier with a typo.
+ */
+static void generate( void ) {
+  static char const ALPHABET[] = "_abcdefghijklmnopqrstuvwxyz0123456789";
+  int const alphabet_len = STATIC_CAST( int, STRLITLEN( ALPHABET ) );
+
+  srand( 42 );
+
+  for ( size_t k = 0; k < BENCH_KNOWN_MAX; ++k ) {
+    size_t const len = 3 + STATIC_CAST( size_t, rand() ) %
+      (BENCH_KNOWN_LEN_MAX - 3 + 1);
+    for ( size_t i = 0; i < len; ++i )
+      known[k][i] = ALPHABET[ rand() % alphabet_len ];
+    known[k][ len ] = '\0';
+    known_len[k] = len;
+    if ( len > known_len_max )
+      known_len_max = len;
+  } // for
+
+  for ( size_t u = 0; u < BENCH_UNKNOWN_MAX; ++u ) {
+    size_t const k = STATIC_CAST( size_t, rand() ) % BENCH_KNOWN_MAX;
+    strcpy( unknown[u], known[k] );
+    // transpose two adjacent characters
+    size_t const i = STATIC_CAST( size_t, rand() ) % (known_len[k] - 1);
+    char const c = unknown[u][i];
+    unknown[u][i] = unknown[u][i+1];
+    unknown[u][i+1] = c;
+  } // for
+}
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *const argv[] ) {
+  prog_name = path_basename( argv[0] );
+  if ( argc != 1 ) {
+    EPRINTF( "usage: %s\n", prog_name );
+    exit( EX_USAGE );
+  }
+
+  generate();
+
+  size_t matrix_similar, bits_similar;
+  double const matrix_secs = bench_matrix( &matrix_similar );
+  double const bits_secs = bench_bits( &bits_similar );
+
+  printf( "%u unknowns x %u knowns:\n", BENCH_UNKNOWN_MAX, BENCH_KNOWN_MAX );
+  printf(
+    "  dam_lev_dist():      %8.3fs  (%zu similar)\n",
+    matrix_secs, matrix_similar
+  );
+  printf(
+    "  dam_lev_bits_dist(): %8.3fs  (%zu similar)\n",
+    bits_secs, bits_similar
+  );
+  if ( bits_secs > 0 )
+    printf( "  speed-up:            %8.1fx\n", matrix_secs / bits_secs );
+
+  exit( EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
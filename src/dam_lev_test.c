@@ -0,0 +1,189 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/dam_lev_test.c
+**
+**      Copyright (C) 2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "dam_lev.h"
+#include "util.h"
+#include "unit_test.h"
+
+// standard
+#include <stdbool.h>
+#include <stdint.h>                     /* for SIZE_MAX */
+#include <stdlib.h>                     /* for free(3) */
+#include <string.h>
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Calculates the restricted Damerau-Levenshtein distance between \a s and \a
+ * t the straightforward way to check dam_lev_bits_dist() against.
+ *
+ * @param s The source string.
+ * @param t The target string.
+ * @return Returns said distance.
+ */
+static size_t osa_dist( char const *s, char const *t ) {
+  size_t const slen = strlen( s ), tlen = strlen( t );
+  size_t d[ DAM_LEV_BITS_MAX + 1 ][ DAM_LEV_BITS_MAX + 1 ];
+
+  for ( size_t i = 0; i <= slen; ++i )
+    d[i][0] = i;
+  for ( size_t j = 0; j <= tlen; ++j )
+    d[0][j] = j;
+
+  for ( size_t i = 1; i <= slen; ++i ) {
+    for ( size_t j = 1; j <= tlen; ++j ) {
+      size_t dist = d[i-1][j-1] + (s[i-1] != t[j-1]);
+      dist = MIN( dist, d[i-1][j] + 1 );
+      dist = MIN( dist, d[i][j-1] + 1 );
+      if ( i > 1 && j > 1 && s[i-1] == t[j-2] && s[i-2] == t[j-1] )
+        dist = MIN( dist, d[i-2][j-2] + 1 );
+      d[i][j] = dist;
+    } // for
+  } // for
+
+  return d[ slen ][ tlen ];
+}
+
+/**
+ * Calculates the distance between \a s and \a t via dam_lev_bits_dist().
+ *
+ * @param s The source string.
+ * @param t The target string.
+ * @param max_dist The maximum distance of interest.
+ * @return Returns said distance.
+ */
+static size_t bits_dist( char const *s, char const *t, size_t max_dist ) {
+  dam_lev_bits_t dlb;
+  if ( !dam_lev_bits_init( &dlb, s, strlen( s ) ) )
+    return 0;
+  return dam_lev_bits_dist( &dlb, t, strlen( t ), max_dist );
+}
+
+/**
+ * Calculates the distance between \a s and \a t via dam_lev_dist().
+ *
+ * @param s The source string.
+ * @param t The target string.
+ * @return Returns said distance.
+ */
+static size_t matrix_dist( char const *s, char const *t ) {
+  size_t const slen = strlen( s ), tlen = strlen( t );
+  void *const mem = dam_lev_new( slen, tlen );
+  size_t const dist = dam_lev_dist( mem, s, slen, t, tlen );
+  free( mem );
+  return dist;
+}
+
+////////// test functions /////////////////////////////////////////////////////
+
+static bool test_dam_lev_bits_dist( void ) {
+  TEST_FUNC_BEGIN();
+
+  TEST( bits_dist( "", "", 9 ) == 0 );
+  TEST( bits_dist( "", "abc", 9 ) == 3 );
+  TEST( bits_dist( "abc", "", 9 ) == 3 );
+  TEST( bits_dist( "abc", "abc", 9 ) == 0 );
+  TEST( bits_dist( "abc", "abd", 9 ) == 1 );
+  TEST( bits_dist( "abc", "acb", 9 ) == 1 );
+  TEST( bits_dist( "abc", "ab", 9 ) == 1 );
+  TEST( bits_dist( "abc", "abcd", 9 ) == 1 );
+  TEST( bits_dist( "ca", "abc", 9 ) == 3 );
+  TEST( bits_dist( "fixed", "float", 9 ) == 4 );
+  TEST( bits_dist( "pointr", "pointer", 9 ) == 1 );
+  TEST( bits_dist( "retrun", "return", 9 ) == 1 );
+
+  // distances exceeding max_dist
+  TEST( bits_dist( "abc", "xyz", 1 ) == 2 );
+  TEST( bits_dist( "abc", "abcdefgh", 2 ) == 3 );
+  TEST( bits_dist( "fixed", "float", 0 ) == 1 );
+  TEST( bits_dist( "fixed", "float", 4 ) == 4 );
+
+  // longest source
+  char s[ DAM_LEV_BITS_MAX + 2 ];
+  memset( s, 'a', DAM_LEV_BITS_MAX );
+  s[ DAM_LEV_BITS_MAX ] = '\0';
+  TEST( bits_dist( s, s, 0 ) == 0 );
+  TEST( bits_dist( s, "a", DAM_LEV_BITS_MAX ) == DAM_LEV_BITS_MAX - 1 );
+  s[ DAM_LEV_BITS_MAX - 1 ] = 'b';
+  TEST( bits_dist( s, s + 1, 9 ) == 1 );
+
+  // too long a source
+  s[ DAM_LEV_BITS_MAX ] = 'a';
+  s[ DAM_LEV_BITS_MAX + 1 ] = '\0';
+  dam_lev_bits_t dlb;
+  TEST( !dam_lev_bits_init( &dlb, s, DAM_LEV_BITS_MAX + 1 ) );
+
+  TEST_FUNC_END();
+}
+
+static bool test_dam_lev_bits_dist_random( void ) {
+  TEST_FUNC_BEGIN();
+
+  char s[ 16 ], t[ 16 ];
+  srand( 42 );
+
+  for ( unsigned n = 0; n < 10000; ++n ) {
+    // use a small alphabet to get lots of matches and transpositions
+    size_t const slen = STATIC_CAST( size_t, rand() ) % sizeof s;
+    size_t const tlen = STATIC_CAST( size_t, rand() ) % sizeof t;
+    for ( size_t i = 0; i < slen; ++i )
+      s[i] = STATIC_CAST( char, 'a' + rand() % 4 );
+    s[ slen ] = '\0';
+    for ( size_t i = 0; i < tlen; ++i )
+      t[i] = STATIC_CAST( char, 'a' + rand() % 4 );
+    t[ tlen ] = '\0';
+
+    size_t const dist = osa_dist( s, t );
+    TEST( bits_dist( s, t, SIZE_MAX / 2 ) == dist );
+    size_t const max_dist = STATIC_CAST( size_t, rand() ) % 8;
+    TEST( bits_dist( s, t, max_dist ) == MIN( dist, max_dist + 1 ) );
+    // restricting Damerau-Levenshtein can only ever increase the distance
+    TEST( matrix_dist( s, t ) <= dist );
+  } // for
+
+  TEST_FUNC_END();
+}
+
+static bool test_dam_lev_dist( void ) {
+  TEST_FUNC_BEGIN();
+
+  TEST( matrix_dist( "abc", "abc" ) == 0 );
+  TEST( matrix_dist( "abc", "acb" ) == 1 );
+  TEST( matrix_dist( "ca", "abc" ) == 2 );
+  TEST( matrix_dist( "fixed", "float" ) == 4 );
+  TEST( matrix_dist( "retrun", "return" ) == 1 );
+
+  TEST_FUNC_END();
+}
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *const argv[] ) {
+  test_prog_init( argc, argv );
+
+  test_dam_lev_bits_dist();
+  test_dam_lev_bits_dist_random();
+  test_dam_lev_dist();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
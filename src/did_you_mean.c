@@ -46,22 +46,35 @@
  * @{
  */
 
+////////// typedefs ///////////////////////////////////////////////////////////
+
+typedef struct dym_dist dym_dist_t;
+
+////////// structs ////////////////////////////////////////////////////////////
+
+/**
+ * Data for calculating edit distances from an unknown literal.
+ */
+struct dym_dist {
+  char const     *unknown;              ///< The unknown literal.
+  size_t          unknown_len;          ///< Length of \ref unknown.
+  dam_lev_bits_t  dlb;                  ///< \ref unknown compiled, if short.
+  bool            is_bits;              ///< Is \ref dlb initialized?
+  void           *dam_lev_mem;          ///< Working memory if not \ref is_bits.
+};
+
 ////////// local functions ////////////////////////////////////////////////////
 
 /**
- * Frees memory used by \a dym.
+ * Gets the absolute difference between \a i and \a j.
  *
- * @param dym A pointer to the first \ref did_you_mean to free and continuing
- * until \ref did_you_mean::known "known" is NULL.
- * @param cleanup_fn A pointer to the \ref dym_cleanup_fn_t to use.  May be
- * NULL.
+ * @param i The first size.
+ * @param j The second size.
+ * @return Returns said difference.
  */
-static void dym_cleanup_all( did_you_mean_t const *dym,
-                             dym_cleanup_fn_t cleanup_fn ) {
-  if ( dym == NULL || cleanup_fn == NULL )
-    return;
-  while ( dym->known != NULL )
-    (*cleanup_fn)( dym++ );
+NODISCARD
+static inline size_t abs_diff( size_t i, size_t j ) {
+  return i > j ? i - j : j - i;
 }
 
 /**
@@ -81,83 +94,257 @@ static int dym_cmp( did_you_mean_t const *i_dym, did_you_mean_t const *j_dym ) {
           strcmp( i_dym->known, j_dym->known );
 }
 
+/**
+ * Calculates the Damerau-Levenshtein edit distance between the unknown literal
+ * and \a dym, but only up to \a max_dist.
+ *
+ * @remarks If the unknown literal is at most #DAM_LEV_BITS_MAX characters
+ * long (as nearly all are), this calculates the _restricted_ distance via
+ * dam_lev_bits_dist(); otherwise it calculates the unrestricted distance via
+ * dam_lev_dist().  The two differ only when a substring would be edited more
+ * than once, e.g., `ca` is 3 rather than 2 away from `abc`, so a very long
+ * unknown literal may rarely get a suggestion a short one wouldn't.
+ *
+ * @param dd The \ref dym_dist to use.
+ * @param dym The \ref did_you_mean to calculate the distance to.
+ * @param max_dist The maximum distance of interest.
+ * @return Returns said distance if it's &le; \a max_dist or \a max_dist + 1
+ * otherwise.
+ */
+NODISCARD
+static size_t dym_dist( dym_dist_t const *dd, did_you_mean_t const *dym,
+                        size_t max_dist ) {
+  if ( dd->is_bits )
+    return dam_lev_bits_dist( &dd->dlb, dym->known, dym->known_len, max_dist );
+  size_t const dist = dam_lev_dist(
+    dd->dam_lev_mem, dd->unknown, dd->unknown_len, dym->known, dym->known_len
+  );
+  return MIN( dist, max_dist + 1 );
+}
+
+/**
+ * Gets the range of candidates in \a idx whose lengths are within
+ * [\a min_len, \a max_len].
+ *
+ * @param idx The \ref dym_index to get the candidates of.
+ * @param min_len The minimum length.
+ * @param max_len The maximum length.
+ * @param rv_end Set to one past the last candidate.
+ * @return Returns a pointer to the first candidate.
+ */
+NODISCARD
+static did_you_mean_t const* dym_index_range( dym_index_t const *idx,
+                                              size_t min_len, size_t max_len,
+                                              did_you_mean_t const **rv_end ) {
+  size_t const len_max = idx->max_known_len + 1;
+  *rv_end = idx->dyms + idx->len_offs[ MIN( max_len + 1, len_max ) ];
+  return idx->dyms + idx->len_offs[ MIN( min_len, len_max ) ];
+}
+
+/**
+ * Appends a copy of \a dym to \a idx.
+ *
+ * @param idx The \ref dym_index to append to.
+ * @param dym The \ref did_you_mean to append.
+ */
+static void dym_index_push( dym_index_t *idx, did_you_mean_t const *dym ) {
+  if ( idx->len == idx->cap ) {
+    idx->cap = idx->cap == 0 ? 16 : idx->cap * 2;
+    REALLOC( idx->dyms, idx->cap );
+  }
+  idx->dyms[ idx->len++ ] = *dym;
+}
+
+/**
+ * Comparison function for two \ref did_you_mean objects by length only.
+ *
+ * @param i_dym A pointer to the first \ref did_you_mean.
+ * @param j_dym A pointer to the second \ref did_you_mean.
+ * @return Returns a number less than 0, 0, or greater than 0 if \a i_dym is
+ * shorter than, the same length as, or longer than \a j_dym, respectively.
+ */
+NODISCARD
+static int dym_len_cmp( did_you_mean_t const *i_dym,
+                        did_you_mean_t const *j_dym ) {
+  return  (i_dym->known_len > j_dym->known_len) -
+          (i_dym->known_len < j_dym->known_len);
+}
+
 ////////// extern functions ///////////////////////////////////////////////////
 
-bool dym_calc( char const *unknown, did_you_mean_t *dym_array,
-               dym_similar_fn_t similar_fn, dym_cleanup_fn_t cleanup_fn ) {
-  assert( unknown != NULL );
-  assert( similar_fn != NULL );
+void dym_index_add( dym_index_t *idx, char const *known, void *user_data ) {
+  assert( idx != NULL );
+  assert( known != NULL );
+  dym_index_push( idx, &(did_you_mean_t){
+    .known = known,
+    .known_len = strlen( known ),
+    .user_data = user_data
+  } );
+}
 
-  if ( dym_array == NULL )
-    return false;                       // LCOV_EXCL_LINE
+void dym_index_cleanup( dym_index_t *idx, dym_cleanup_fn_t cleanup_fn ) {
+  if ( idx == NULL )
+    return;
+  dym_index_clear( idx, cleanup_fn );
+  free( idx->dyms );
+  free( idx->len_offs );
+  *idx = (dym_index_t){ 0 };
+}
 
-  did_you_mean_t *dym;
+void dym_index_clear( dym_index_t *idx, dym_cleanup_fn_t cleanup_fn ) {
+  assert( idx != NULL );
+  if ( cleanup_fn != NULL ) {
+    for ( size_t i = 0; i < idx->len; ++i )
+      (*cleanup_fn)( &idx->dyms[i] );
+  }
+  idx->len = 0;
+  idx->max_known_len = 0;
+}
 
-  // calculate the maximum known lengths
-  size_t max_known_len = 0;
-  for ( dym = dym_array; dym->known != NULL; ++dym ) {
-    dym->known_len = strlen( dym->known );
-    if ( dym->known_len > max_known_len )
-      max_known_len = dym->known_len;
-  } // for
+bool dym_index_find( dym_index_t const *const idxs[], size_t idxs_len,
+                     char const *unknown, dym_max_dist_fn_t max_dist_fn,
+                     dym_index_t *rv_found ) {
+  assert( idxs != NULL );
+  assert( unknown != NULL );
+  assert( max_dist_fn != NULL );
+  assert( rv_found != NULL );
 
   /*
    * Adapted from the code:
    * <https://github.com/git/git/blob/3a0b884caba2752da0af626fb2de7d597c844e8b/help.c#L516>
    */
 
-  // calculate Damerau-Levenshtein edit distance for all candidates
-  size_t const unknown_len = strlen( unknown );
-  void *const dam_lev_mem = dam_lev_new( unknown_len, max_known_len );
-  for ( dym = dym_array; dym->known != NULL; ++dym ) {
-    dym->dam_lev_dist = dam_lev_dist(
-      dam_lev_mem, unknown, unknown_len, dym->known, dym->known_len
-    );
-  } // for
-  free( dam_lev_mem );
+  dym_index_clear( rv_found, /*cleanup_fn=*/NULL );
 
-  // sort by Damerau-Levenshtein distance
-  size_t const dym_size = STATIC_CAST( size_t, dym - dym_array );
-  qsort(
-    dym_array, dym_size, sizeof dym_array[0],
-    POINTER_CAST( qsort_cmp_fn_t, &dym_cmp )
-  );
+  dym_dist_t dd = { .unknown = unknown, .unknown_len = strlen( unknown ) };
+  dd.is_bits = dam_lev_bits_init( &dd.dlb, unknown, dd.unknown_len );
+  if ( !dd.is_bits ) {
+    size_t max_known_len = 0;
+    for ( size_t i = 0; i < idxs_len; ++i ) {
+      if ( idxs[i]->max_known_len > max_known_len )
+        max_known_len = idxs[i]->max_known_len;
+    } // for
+    dd.dam_lev_mem = dam_lev_new( dd.unknown_len, max_known_len );
+  }
+
+  //
+  // First, find the candidates that are similar enough.  A candidate of length
+  // len is at least |len - unknown_len| away, so only those whose length is
+  // close enough need be considered.
+  //
+  size_t similar_max = 0;
+  for ( size_t i = 0; i < idxs_len; ++i ) {
+    dym_index_t const *const idx = idxs[i];
+    if ( idx->len == 0 )
+      continue;
+    for ( size_t len = 0; len <= idx->max_known_len; ++len ) {
+      size_t const max_dist = (*max_dist_fn)( len );
+      if ( abs_diff( len, dd.unknown_len ) > max_dist )
+        continue;
+      did_you_mean_t const *end;
+      for ( did_you_mean_t const *dym = dym_index_range( idx, len, len, &end );
+            dym < end; ++dym ) {
+        size_t const dist = dym_dist( &dd, dym, max_dist );
+        if ( dist > max_dist )
+          continue;
+        dym_index_push( rv_found, dym );
+        rv_found->dyms[ rv_found->len - 1 ].dam_lev_dist = dist;
+        if ( dist > similar_max )
+          similar_max = dist;
+      } // for
+    } // for
+  } // for
 
-  if ( dym_array->dam_lev_dist > 0 ) {
-    bool found_at_least_1 = false;
+  if ( rv_found->len > 0 ) {
+    qsort(
+      rv_found->dyms, rv_found->len, sizeof rv_found->dyms[0],
+      POINTER_CAST( qsort_cmp_fn_t, &dym_cmp )
+    );
+  }
 
-    for ( dym = dym_array; dym->known != NULL; ++dym ) {
-      if ( !(*similar_fn)( dym ) )
-        break;
-      found_at_least_1 = true;
+  //
+  // The suggestions are those that sort before the first candidate that isn't
+  // similar enough, so such a candidate matters only if its distance is no
+  // greater than similar_max: find the least such candidate, if any.
+  //
+  did_you_mean_t stop = { 0 };
+  if ( rv_found->len > 0 && rv_found->dyms[0].dam_lev_dist > 0 ) {
+    for ( size_t i = 0; i < idxs_len; ++i ) {
+      dym_index_t const *const idx = idxs[i];
+      if ( idx->len == 0 )
+        continue;
+      size_t const min_len = dd.unknown_len > similar_max ?
+        dd.unknown_len - similar_max : 0;
+      size_t const max_len = dd.unknown_len + similar_max;
+      for ( size_t len = min_len; len <= max_len; ++len ) {
+        size_t const max_dist = (*max_dist_fn)( len );
+        if ( max_dist >= similar_max )
+          continue;                     // not similar means > similar_max
+        did_you_mean_t const *end;
+        for ( did_you_mean_t const *dym =
+                dym_index_range( idx, len, len, &end );
+              dym < end; ++dym ) {
+          did_you_mean_t cand = *dym;
+          cand.dam_lev_dist = dym_dist( &dd, dym, similar_max );
+          if ( cand.dam_lev_dist <= max_dist ||
+               cand.dam_lev_dist > similar_max ) {
+            continue;
+          }
+          if ( stop.known == NULL || dym_cmp( &cand, &stop ) < 0 )
+            stop = cand;
+        } // for
+      } // for
     } // for
 
-    if ( found_at_least_1 ) {
-      //
-      // Free known literals past the best ones and set the one past the last
-      // to NULL to mark the end.
-      //
-      dym_cleanup_all( dym, cleanup_fn );
-      *dym = (did_you_mean_t){ 0 };
-      return true;
+    if ( stop.known != NULL ) {
+      size_t n = 0;
+      while ( n < rv_found->len && dym_cmp( &rv_found->dyms[n], &stop ) < 0 )
+        ++n;
+      rv_found->len = n;
     }
   }
   else {
     //
-    // This means unknown was an exact match for a known literal which means we
-    // shouldn't suggest it for itself.
+    // Either there's nothing similar enough or unknown was an exact match for
+    // a known literal which means we shouldn't suggest it for itself.
     //
+    rv_found->len = 0;
   }
 
-  dym_free( dym_array, cleanup_fn );
-  return false;
+  free( dd.dam_lev_mem );
+
+  if ( rv_found->len == 0 )
+    return false;
+
+  // mark the end
+  dym_index_push( rv_found, &(did_you_mean_t){ 0 } );
+  --rv_found->len;
+  return true;
 }
 
-void dym_free( did_you_mean_t const *dym_array, dym_cleanup_fn_t cleanup_fn ) {
-  if ( dym_array != NULL ) {
-    dym_cleanup_all( dym_array, cleanup_fn );
-    FREE( dym_array );
+void dym_index_sort( dym_index_t *idx ) {
+  assert( idx != NULL );
+
+  idx->max_known_len = 0;
+  for ( size_t i = 0; i < idx->len; ++i ) {
+    if ( idx->dyms[i].known_len > idx->max_known_len )
+      idx->max_known_len = idx->dyms[i].known_len;
+  } // for
+
+  if ( idx->len > 0 ) {
+    qsort(
+      idx->dyms, idx->len, sizeof idx->dyms[0],
+      POINTER_CAST( qsort_cmp_fn_t, &dym_len_cmp )
+    );
   }
+
+  REALLOC( idx->len_offs, idx->max_known_len + 2 );
+  size_t i = 0;
+  for ( size_t len = 0; len <= idx->max_known_len + 1; ++len ) {
+    while ( i < idx->len && idx->dyms[i].known_len < len )
+      ++i;
+    idx->len_offs[ len ] = i;
+  } // for
 }
 
 ///////////////////////////////////////////////////////////////////////////////
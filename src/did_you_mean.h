@@ -64,51 +64,111 @@ typedef struct did_you_mean did_you_mean_t;
 typedef void (*dym_cleanup_fn_t)( did_you_mean_t const *dym );
 
 /**
- * The signature for a function to determine whether \a dym is similar enough
- * to the unknown literal given to dym_calc().
+ * The signature for a function to get the maximum edit distance a known
+ * literal of length \a known_len may be from an unknown literal in order to be
+ * similar enough.
  *
- * @param dym A pointer to the \ref did_you_mean structure to check.
- * @return Returns `true` only if \a dym is similar enough to the unknown
- * literal.
+ * @param known_len The length of the known literal.
+ * @return Returns said distance.
  */
-typedef bool (*dym_similar_fn_t)( did_you_mean_t const *dym );
+typedef size_t (*dym_max_dist_fn_t)( size_t known_len );
+
+/**
+ * An index of \ref did_you_mean candidates that persists across look-ups.
+ *
+ * @remarks Candidates are kept grouped by length so that a look-up need
+ * consider only those whose length is close enough to that of the unknown
+ * literal for them possibly to be similar enough.
+ *
+ * @sa dym_index_add()
+ * @sa dym_index_find()
+ * @sa dym_index_sort()
+ */
+struct dym_index {
+  did_you_mean_t *dyms;                 ///< Candidates.
+  size_t          len;                  ///< Number of candidates.
+  size_t          cap;                  ///< Capacity of \ref dyms.
+  size_t          max_known_len;        ///< Maximum \ref did_you_mean::known_len.
+
+  /// Offsets into \ref dyms of the first candidate of each length from 0 to
+  /// \ref max_known_len + 1; valid only after dym_index_sort().
+  size_t         *len_offs;
+};
+typedef struct dym_index dym_index_t;
 
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
- * Given an array of \ref did_you_mean suggestions for \a unknown, calculates a
- * Damerau-Levenshtein edit distance for each suggestion, sorts the array by
- * it, and removes suggestions that are not similar enough according to \a
- * similar_fn.
+ * Adds a candidate to \a idx.
  *
- * @param unknown The unknown literal.
- * @param dym_array The array of \ref did_you_mean to use.  May be NULL.  If
- * not, each element _must_ have \ref did_you_mean::known "known" point to a
- * suggestion except the last _must_ be NULL.  The \ref did_you_mean::user_data
- * "user_data" member may be used for any purpose.
- * @param similar_fn A pointer to a \ref dym_similar_fn_t function to use.
- * @param cleanup_fn A pointer to a function to clean-up each element of \a
- * dym_array.  May be NULL if no clean-up is needed.
- * @return Returns `true` only if there is at least one suggestion according to
- * \a similar_fn; `false` otherwise.
+ * @param idx The \ref dym_index to add to.
+ * @param known The known candidate literal.
+ * @param user_data Optional user data.
+ *
+ * @note dym_index_sort() must be called after all candidates have been added
+ * and before \a idx is used with dym_index_find().
+ */
+void dym_index_add( dym_index_t *idx, char const *known, void *user_data );
+
+/**
+ * Cleans-up all memory associated with \a idx but does _not_ free \a idx
+ * itself.
  *
- * @sa dym_free()
+ * @param idx The \ref dym_index to clean up.
+ * @param cleanup_fn A pointer to a function to clean-up each candidate.  May
+ * be NULL if no clean-up is needed.
+ *
+ * @sa dym_index_clear()
+ */
+void dym_index_cleanup( dym_index_t *idx, dym_cleanup_fn_t cleanup_fn );
+
+/**
+ * Removes all candidates from \a idx, but keeps its memory for reuse.
+ *
+ * @param idx The \ref dym_index to clear.
+ * @param cleanup_fn A pointer to a function to clean-up each candidate.  May
+ * be NULL if no clean-up is needed.
+ *
+ * @sa dym_index_cleanup()
+ */
+void dym_index_clear( dym_index_t *idx, dym_cleanup_fn_t cleanup_fn );
+
+/**
+ * Finds the candidates in \a idxs that are similar enough to \a unknown
+ * according to \a max_dist_fn.
+ *
+ * @remarks The suggestions are the candidates having the least
+ * Damerau-Levenshtein edit distances from \a unknown up to, but not including,
+ * the first that is not similar enough.  Only candidates whose length is close
+ * enough to \a unknown's to make a difference are considered and, for each,
+ * the distance is calculated only as far as needed.
+ *
+ * @param idxs The \ref dym_index array to search.
+ * @param idxs_len The number of elements of \a idxs.
+ * @param unknown The unknown literal.
+ * @param max_dist_fn A pointer to a \ref dym_max_dist_fn_t function to use.
+ * @param rv_found The \ref dym_index to put the suggestions into sorted by
+ * distance; terminated by an element whose \ref did_you_mean::known "known"
+ * is NULL.  It doesn't own its candidates, so it must be cleaned up without a
+ * \ref dym_cleanup_fn_t and its candidates are valid only until the next time
+ * any of \a idxs is changed.  Its memory is reused across calls, so a look-up
+ * allocates nothing once it has grown large enough.
+ * @return Returns `true` only if there is at least one suggestion; `false`
+ * otherwise, including when \a unknown is itself a candidate.
  */
 NODISCARD
-bool dym_calc( char const *unknown, did_you_mean_t *dym_array,
-              dym_similar_fn_t similar_fn, dym_cleanup_fn_t cleanup_fn );
+bool dym_index_find( dym_index_t const *const idxs[], size_t idxs_len,
+                     char const *unknown, dym_max_dist_fn_t max_dist_fn,
+                     dym_index_t *rv_found );
 
 /**
- * Frees all memory used by \a dym_array _including_ \a dym_array itself.
+ * Groups the candidates of \a idx by length.
  *
- * @param dym_array The \ref did_you_mean array to free.  If NULL, does
- * nothing.
- * @param cleanup_fn A pointer to a function to clean-up a \ref did_you_mean
- * structure.  May be NULL.
+ * @param idx The \ref dym_index to sort.
  *
- * @sa dym_calc()
+ * @sa dym_index_add()
  */
-void dym_free( did_you_mean_t const *dym_array, dym_cleanup_fn_t cleanup_fn );
+void dym_index_sort( dym_index_t *idx );
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -175,34 +175,37 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
     json_object_begin( JSON_INIT, /*key=*/NULL, dump );
 
   DUMP_SNAME( dump, "sname", &ast->sname );
-  DUMP_BOOL( dump, "is_param_pack", ast->is_param_pack );
+  DUMP_BOOL( dump, "is_param_pack", c_ast_is_param_pack( ast ) );
   DUMP_KEY( dump,
     "kind: { value: 0x%X, string: \"%s\" }",
     ast->kind, c_kind_name( ast->kind )
   );
   if ( (opt_cdecl_debug & CDECL_DEBUG_OPT_AST_UNIQUE_ID) != 0 ) {
     // LCOV_EXCL_START
-    DUMP_KEY( dump, "unique_id: " PRId_C_AST_ID_T, ast->unique_id );
-    if ( ast->dup_from_ast != NULL ) {
+    DUMP_KEY( dump, "unique_id: " PRId_C_AST_ID_T, c_ast_unique_id( ast ) );
+    c_ast_t const *const dup_from_ast = c_ast_dup_from( ast );
+    if ( dup_from_ast != NULL ) {
       DUMP_KEY( dump,
-        "dup_from_id: " PRId_C_AST_ID_T, ast->dup_from_ast->unique_id
+        "dup_from_id: " PRId_C_AST_ID_T, c_ast_unique_id( dup_from_ast )
       );
     }
     DUMP_KEY( dump,
       "parent_id: " PRId_C_AST_ID_T,
-      ast->parent_ast != NULL ? ast->parent_ast->unique_id : 0
+      ast->parent_ast != NULL ? c_ast_unique_id( ast->parent_ast ) : 0
     );
     if ( c_ast_is_param( ast ) ) {
       DUMP_KEY( dump,
-        "param_of_id: " PRId_C_AST_ID_T, ast->param_of_ast->unique_id
+        "param_of_id: " PRId_C_AST_ID_T,
+        c_ast_unique_id( ast->param_of_ast )
       );
     }
     // LCOV_EXCL_STOP
   }
   DUMP_KEY( dump, "depth: %u", ast->depth );
-  if ( ast->align.kind != C_ALIGNAS_NONE ) {
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align != NULL ) {
     DUMP_KEY( dump, "align: " );
-    c_alignas_dump_impl( &ast->align, dump );
+    c_alignas_dump_impl( align, dump );
   }
   DUMP_LOC( dump, "loc", &ast->loc );
   DUMP_KEY( dump, "type: " );
@@ -386,7 +389,7 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
 /**
  * Dumps \a list of ASTs in [JSON5](https://json5.org) format (for debugging).
  *
- * @param list The \ref slist of ASTs to dump.
+ * @param list The \ref c_ast_list to dump.
  * @param dump The dump_state to use.
  */
 static void c_ast_list_dump_impl( c_ast_list_t const *list,
@@ -394,7 +397,7 @@ static void c_ast_list_dump_impl( c_ast_list_t const *list,
   assert( list != NULL );
   assert( dump != NULL );
 
-  if ( slist_empty( list ) ) {
+  if ( c_ast_list_empty( list ) ) {
     FPUTS( "[]", dump->fout );
     return;
   }
@@ -403,9 +406,9 @@ static void c_ast_list_dump_impl( c_ast_list_t const *list,
   dump_state_t list_dump;
   dump_init( &list_dump, dump->indent + 1, dump->fout );
 
-  FOREACH_SLIST_NODE( node, list ) {
+  FOREACH_AST_LIST( ast_elt, list ) {
     DUMP_KEY( &list_dump, "%s", "" );
-    c_ast_dump_impl( c_param_ast( node ), &list_dump );
+    c_ast_dump_impl( *ast_elt, &list_dump );
   } // for
 
   FPUTC( '\n', dump->fout );
@@ -90,7 +90,7 @@ void c_ast_dump( c_ast_t const *ast, FILE *fout );
 /**
  * Dumps \a list of ASTs in [JSON5](https://json5.org) format (for debugging).
  *
- * @param list The \ref slist of ASTs to dump.
+ * @param list The \ref c_ast_list to dump.
  * @param fout The `FILE` to dump to.
  *
  * @sa c_ast_dump()
@@ -70,7 +70,7 @@ typedef struct eng_state eng_state_t;
  * State maintained by c_ast_visit_english().
  */
 struct eng_state {
-  FILE           *fout;                 ///< Where to print the English.
+  strbuf_t       *sbuf;                 ///< Where to print the English.
   c_ast_t const  *func_ast;             ///< The current function AST, if any.
 };
 
@@ -90,12 +90,12 @@ static void c_lambda_ast_english( c_ast_t const*, eng_state_t const* );
 static void c_name_ast_english( c_ast_t const*, eng_state_t const* );
 static void c_ptr_mbr_ast_english( c_ast_t const*, eng_state_t const* );
 static void c_ptr_ref_ast_english( c_ast_t const*, eng_state_t const* );
-static void c_sname_english( c_sname_t const*, FILE* );
+static void c_sname_english( c_sname_t const*, strbuf_t* );
 static void c_struct_bind_ast_english( c_ast_t const*, eng_state_t const* );
-static void c_type_name_nobase_english( c_type_t const*, FILE* );
+static void c_type_name_nobase_english( c_type_t const*, strbuf_t* );
 static void c_typedef_ast_english( c_ast_t const*, eng_state_t const* );
 static void c_udef_conv_ast_english( c_ast_t const*, eng_state_t const* );
-static void eng_init( eng_state_t*, FILE* );
+static void eng_init( eng_state_t*, strbuf_t* );
 
 ////////// inline functions ///////////////////////////////////////////////////
 
@@ -126,24 +126,24 @@ static void c_array_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
   assert( ast->kind == K_ARRAY );
   assert( eng != NULL );
 
-  c_type_name_nobase_english( &ast->type, eng->fout );
+  c_type_name_nobase_english( &ast->type, eng->sbuf );
 
   if ( c_ast_is_likely_vla( ast, eng ) )
-    FPUTS( "variable length ", eng->fout );
-  FPUTS( "array ", eng->fout );
+    strbuf_puts( eng->sbuf, "variable length " );
+  strbuf_puts( eng->sbuf, "array " );
 
   switch ( ast->array.kind ) {
     case C_ARRAY_SIZE_INT:
-      FPRINTF( eng->fout, "%u ", ast->array.size_int );
+      strbuf_printf( eng->sbuf, "%u ", ast->array.size_int );
       break;
     case C_ARRAY_SIZE_NAME:
-      FPRINTF( eng->fout, "%s ", ast->array.size_name );
+      strbuf_printf( eng->sbuf, "%s ", ast->array.size_name );
       break;
     case C_ARRAY_SIZE_NONE:
     case C_ARRAY_SIZE_VLA:
       break;
   } // switch
-  FPUTS( "of ", eng->fout );
+  strbuf_puts( eng->sbuf, "of " );
 }
 
 /**
@@ -157,21 +157,25 @@ static void c_ast_alignas_english( c_ast_t const *ast,
   assert( ast != NULL );
   assert( eng != NULL );
 
-  switch ( ast->align.kind ) {
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL )
+    return;
+
+  switch ( align->kind ) {
     case C_ALIGNAS_NONE:
-      break;
+      unreachable();
     case C_ALIGNAS_BYTES:
-      if ( ast->align.bytes > 0 )
-        FPRINTF( eng->fout, " aligned as %u bytes", ast->align.bytes );
+      if ( align->bytes > 0 )
+        strbuf_printf( eng->sbuf, " aligned as %u bytes", align->bytes );
       break;
     case C_ALIGNAS_SNAME:
-      FPUTS( " aligned as ", eng->fout );
-      c_sname_english( &ast->align.sname, eng->fout );
-      FPUTS( " bytes", eng->fout );
+      strbuf_puts( eng->sbuf, " aligned as " );
+      c_sname_english( &align->sname, eng->sbuf );
+      strbuf_puts( eng->sbuf, " bytes" );
       break;
     case C_ALIGNAS_TYPE:
-      FPUTS( " aligned as ", eng->fout );
-      c_ast_visit_english( ast->align.type_ast, eng );
+      strbuf_puts( eng->sbuf, " aligned as " );
+      c_ast_visit_english( align->type_ast, eng );
       break;
   } // switch
 }
@@ -180,15 +184,15 @@ static void c_ast_alignas_english( c_ast_t const *ast,
  * Prints a bit-field width, if any, in pseudo-English.
  *
  * @param ast The AST to print the bit-field width of.
- * @param fout The `FILE` to emit to.
+ * @param sbuf The \ref strbuf to emit to.
  */
-static void c_ast_bit_width_english( c_ast_t const *ast, FILE *fout ) {
+static void c_ast_bit_width_english( c_ast_t const *ast, strbuf_t *sbuf ) {
   assert( ast != NULL );
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_BIT_FIELD ) );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   if ( ast->bit_field.bit_width > 0 )
-    FPRINTF( fout, " width %u bits", ast->bit_field.bit_width );
+    strbuf_printf( sbuf, " width %u bits", ast->bit_field.bit_width );
 }
 
 /**
@@ -203,17 +207,17 @@ static void c_ast_func_params_english( c_ast_t const *ast,
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_FUNCTION_LIKE ) );
   assert( eng != NULL );
 
-  FPUTC( '(', eng->fout );
+  strbuf_putc( eng->sbuf, '(' );
 
   eng_state_t param_eng;
-  eng_init( &param_eng, eng->fout );
+  eng_init( &param_eng, eng->sbuf );
   param_eng.func_ast = ast;
 
   FOREACH_AST_FUNC_PARAM( param, ast ) {
     c_ast_t const *const param_ast = c_param_ast( param );
     c_sname_t const *const sname = c_ast_find_name( param_ast, C_VISIT_DOWN );
     if ( sname != NULL ) {
-      c_sname_english( sname, eng->fout );
+      c_sname_english( sname, eng->sbuf );
       //
       // For all kinds except K_NAME, we have to print:
       //
@@ -227,7 +231,7 @@ static void c_ast_func_params_english( c_ast_t const *ast,
       //
       if ( param_ast->kind != K_NAME ||
            (!opt_permissive_types && OPT_LANG_IS( PROTOTYPES )) ) {
-        FPUTS( " as ", eng->fout );
+        strbuf_puts( eng->sbuf, " as " );
       }
     }
     else {
@@ -241,11 +245,11 @@ static void c_ast_func_params_english( c_ast_t const *ast,
     }
 
     c_ast_visit_english( param_ast, &param_eng );
-    if ( param->next != NULL )
-      FPUTS( ", ", eng->fout );
+    if ( c_param_next( param ) != NULL )
+      strbuf_puts( eng->sbuf, ", " );
   } // for
 
-  FPUTC( ')', eng->fout );
+  strbuf_putc( eng->sbuf, ')' );
 }
 
 /**
@@ -306,56 +310,57 @@ static bool c_ast_is_likely_vla( c_ast_t const *ast, eng_state_t const *eng ) {
  * Prints a lambda AST's captures, if any, in pseudo-English.
  *
  * @param ast The lambda AST to print the captures of.
- * @param fout The `FILE` to emit to.
+ * @param sbuf The \ref strbuf to emit to.
  */
-static void c_ast_lambda_captures_english( c_ast_t const *ast, FILE *fout ) {
+static void c_ast_lambda_captures_english( c_ast_t const *ast,
+                                           strbuf_t *sbuf ) {
   assert( ast != NULL );
   assert( ast->kind == K_LAMBDA );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
-  FPUTC( '[', fout );
+  strbuf_putc( sbuf, '[' );
 
   FOREACH_AST_LAMBDA_CAPTURE( capture, ast ) {
     c_ast_t const *const capture_ast = c_capture_ast( capture );
 
     switch ( capture_ast->capture.kind ) {
       case C_CAPTURE_COPY:
-        FPUTS( "copy by default", fout );
+        strbuf_puts( sbuf, "copy by default" );
         break;
       case C_CAPTURE_REFERENCE:
         if ( c_sname_empty( &capture_ast->sname ) ) {
-          FPUTS( "reference by default", fout );
+          strbuf_puts( sbuf, "reference by default" );
           break;
         }
-        FPUTS( "reference to ", fout );
+        strbuf_puts( sbuf, "reference to " );
         FALLTHROUGH;
       case C_CAPTURE_VARIABLE:
-        c_sname_english( &capture_ast->sname, fout );
+        c_sname_english( &capture_ast->sname, sbuf );
         break;
       case C_CAPTURE_STAR_THIS:
-        FPUTC( '*', fout );
+        strbuf_putc( sbuf, '*' );
         FALLTHROUGH;
       case C_CAPTURE_THIS:
-        FPUTS( L_this, fout );
+        strbuf_puts( sbuf, L_this );
         break;
     } // switch
 
-    if ( capture->next != NULL )
-      FPUTS( ", ", fout );
+    if ( c_capture_next( capture ) != NULL )
+      strbuf_puts( sbuf, ", " );
   } // for
 
-  FPUTC( ']', fout );
+  strbuf_putc( sbuf, ']' );
 }
 
 /**
  * Prints the scoped name of \a AST in pseudo-English.
  *
  * @param ast The AST to print the name of.
- * @param fout The `FILE` to emit to.
+ * @param sbuf The \ref strbuf to emit to.
  */
-static void c_ast_name_english( c_ast_t const *ast, FILE *fout ) {
+static void c_ast_name_english( c_ast_t const *ast, strbuf_t *sbuf ) {
   assert( ast != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   c_sname_t const *const found_sname = c_ast_find_name( ast, C_VISIT_DOWN );
   char const *local_name = "", *scope_name = "";
@@ -376,10 +381,12 @@ static void c_ast_name_english( c_ast_t const *ast, FILE *fout ) {
   }
 
   assert( local_name[0] != '\0' );
-  FPUTS( local_name, fout );
+  strbuf_puts( sbuf, local_name );
   if ( scope_name[0] != '\0' ) {
     assert( !c_type_is_none( scope_type ) );
-    FPRINTF( fout, " of %s %s", c_type_english( scope_type ), scope_name );
+    strbuf_printf(
+      sbuf, " of %s %s", c_type_english( scope_type ), scope_name
+    );
   }
 }
 
@@ -387,7 +394,7 @@ static void c_ast_name_english( c_ast_t const *ast, FILE *fout ) {
  * Visitor function that prints \a ast as pseudo-English.
  *
  * @param ast The AST to print.
- * @param user_data A pointer to a `FILE` to emit to.
+ * @param user_data A pointer to a \ref strbuf to emit to.
  * @return Always returns `false`.
  */
 NODISCARD
@@ -466,7 +473,7 @@ static bool c_ast_visitor_english( c_ast_t const *ast, user_data_t user_data ) {
       break;
 
     case K_VARIADIC:
-      FPUTS( c_kind_name( ast->kind ), eng->fout );
+      strbuf_puts( eng->sbuf, c_kind_name( ast->kind ) );
       break;
 
     case K_PLACEHOLDER:
@@ -488,7 +495,7 @@ static void c_builtin_ast_english( c_ast_t const *ast,
   assert( ast->kind == K_BUILTIN );
   assert( eng != NULL );
 
-  if ( c_ast_root( ast )->is_param_pack ) {
+  if ( c_ast_is_param_pack( c_ast_root( ast ) ) ) {
     //
     // Special case: if the root AST is a parameter pack, print that instead of
     // this AST's type.
@@ -496,14 +503,14 @@ static void c_builtin_ast_english( c_ast_t const *ast,
     c_type_t type = ast->type;
     assert( type.btids == TB_auto );
     type.btids = TB_NONE;
-    fputs_sp( c_type_english( &type ), eng->fout );
-    FPUTS( "parameter pack", eng->fout );
+    strbuf_puts_sp( eng->sbuf, c_type_english( &type ) );
+    strbuf_puts( eng->sbuf, "parameter pack" );
   }
   else {
-    FPUTS( c_type_english( &ast->type ), eng->fout );
+    strbuf_puts( eng->sbuf, c_type_english( &ast->type ) );
     if ( c_ast_is_tid_any( ast, TB__BitInt ) )
-      FPRINTF( eng->fout, " width %u bits", ast->builtin.BitInt.width );
-    c_ast_bit_width_english( ast, eng->fout );
+      strbuf_printf( eng->sbuf, " width %u bits", ast->builtin.BitInt.width );
+    c_ast_bit_width_english( ast, eng->sbuf );
   }
 }
 
@@ -519,13 +526,13 @@ static void c_cast_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
   assert( eng != NULL );
 
   if ( ast->cast.kind != C_CAST_C )
-    FPRINTF( eng->fout, "%s ", c_cast_english( ast->cast.kind ) );
-  FPUTS( L_cast, eng->fout );
+    strbuf_printf( eng->sbuf, "%s ", c_cast_english( ast->cast.kind ) );
+  strbuf_puts( eng->sbuf, L_cast );
   if ( !c_sname_empty( &ast->sname ) ) {
-    FPUTC( ' ', eng->fout );
-    c_sname_english( &ast->sname, eng->fout );
+    strbuf_putc( eng->sbuf, ' ' );
+    c_sname_english( &ast->sname, eng->sbuf );
   }
-  FPUTS( " into ", eng->fout );
+  strbuf_puts( eng->sbuf, " into " );
 }
 
 /**
@@ -540,11 +547,11 @@ static void c_concept_ast_english( c_ast_t const *ast,
   assert( ast->kind == K_CONCEPT );
   assert( eng != NULL );
 
-  fputs_sp( c_type_english( &ast->type ), eng->fout );
-  FPUTS( "concept ", eng->fout );
-  c_sname_english( &ast->concept.concept_sname, eng->fout );
-  if ( c_ast_root( ast )->is_param_pack )
-    FPUTS( " parameter pack", eng->fout );
+  strbuf_puts_sp( eng->sbuf, c_type_english( &ast->type ) );
+  strbuf_puts( eng->sbuf, "concept " );
+  c_sname_english( &ast->concept.concept_sname, eng->sbuf );
+  if ( c_ast_is_param_pack( c_ast_root( ast ) ) )
+    strbuf_puts( eng->sbuf, " parameter pack" );
 }
 
 /**
@@ -558,8 +565,8 @@ static void c_csu_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
   assert( ast->kind == K_CLASS_STRUCT_UNION );
   assert( eng != NULL );
 
-  FPRINTF( eng->fout, "%s ", c_type_english( &ast->type ) );
-  c_sname_english( &ast->csu.csu_sname, eng->fout );
+  strbuf_printf( eng->sbuf, "%s ", c_type_english( &ast->type ) );
+  c_sname_english( &ast->csu.csu_sname, eng->sbuf );
 }
 
 /**
@@ -573,12 +580,12 @@ static void c_enum_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
   assert( ast->kind == K_ENUM );
   assert( eng != NULL );
 
-  FPRINTF( eng->fout, "%s ", c_type_english( &ast->type ) );
-  c_sname_english( &ast->enum_.enum_sname, eng->fout );
+  strbuf_printf( eng->sbuf, "%s ", c_type_english( &ast->type ) );
+  c_sname_english( &ast->enum_.enum_sname, eng->sbuf );
   if ( ast->enum_.of_ast != NULL )
-    FPUTS( " of type ", eng->fout );
+    strbuf_puts( eng->sbuf, " of type " );
   else
-    c_ast_bit_width_english( ast, eng->fout );
+    c_ast_bit_width_english( ast, eng->sbuf );
 }
 
 /**
@@ -595,11 +602,11 @@ static void c_func_like_ast_english( c_ast_t const *ast,
                         K_FUNCTION | K_OPERATOR | K_USER_DEFINED_LIT)) != 0 );
   assert( eng != NULL );
 
-  c_type_name_nobase_english( &ast->type, eng->fout );
+  c_type_name_nobase_english( &ast->type, eng->sbuf );
   switch ( ast->kind ) {
     case K_FUNCTION:
       if ( c_tid_is_any( ast->type.stids, TS_MEMBER_FUNC_ONLY ) )
-        FPUTS( "member ", eng->fout );
+        strbuf_puts( eng->sbuf, "member " );
       break;
     case K_OPERATOR:;
       c_func_member_t const op_mbr = c_ast_op_overload( ast );
@@ -607,19 +614,19 @@ static void c_func_like_ast_english( c_ast_t const *ast,
         op_mbr == C_FUNC_MEMBER     ? "member "     :
         op_mbr == C_FUNC_NON_MEMBER ? "non-member " :
         "";
-      FPUTS( op_literal, eng->fout );
+      strbuf_puts( eng->sbuf, op_literal );
       break;
     default:
       /* suppress warning */;
   } // switch
 
-  FPUTS( c_kind_name( ast->kind ), eng->fout );
-  if ( !slist_empty( &ast->func.param_ast_list ) ) {
-    FPUTC( ' ', eng->fout );
+  strbuf_puts( eng->sbuf, c_kind_name( ast->kind ) );
+  if ( !c_ast_list_empty( &ast->func.param_ast_list ) ) {
+    strbuf_putc( eng->sbuf, ' ' );
     c_ast_func_params_english( ast, eng );
   }
   if ( ast->func.ret_ast != NULL )
-    FPUTS( " returning ", eng->fout );
+    strbuf_puts( eng->sbuf, " returning " );
 }
 
 /**
@@ -642,10 +649,10 @@ static void c_name_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
     //      cdecl> explain char f(x)
     //      declare f as function (x as integer) returning char
     //
-    FPUTS( c_tid_english( TB_int ), eng->fout );
+    strbuf_puts( eng->sbuf, c_tid_english( TB_int ) );
   }
   else {
-    c_sname_english( &ast->name.sname, eng->fout );
+    c_sname_english( &ast->name.sname, eng->sbuf );
   }
 }
 
@@ -661,18 +668,18 @@ static void c_lambda_ast_english( c_ast_t const *ast, eng_state_t const *eng ) {
   assert( eng != NULL );
 
   if ( !c_type_is_none( &ast->type ) )
-    FPRINTF( eng->fout, "%s ", c_type_english( &ast->type ) );
-  FPUTS( L_lambda, eng->fout );
-  if ( !slist_empty( &ast->lambda.capture_ast_list ) ) {
-    FPUTS( " capturing ", eng->fout );
-    c_ast_lambda_captures_english( ast, eng->fout );
+    strbuf_printf( eng->sbuf, "%s ", c_type_english( &ast->type ) );
+  strbuf_puts( eng->sbuf, L_lambda );
+  if ( !c_ast_list_empty( &ast->lambda.capture_ast_list ) ) {
+    strbuf_puts( eng->sbuf, " capturing " );
+    c_ast_lambda_captures_english( ast, eng->sbuf );
   }
-  if ( !slist_empty( &ast->lambda.param_ast_list ) ) {
-    FPUTC( ' ', eng->fout );
+  if ( !c_ast_list_empty( &ast->lambda.param_ast_list ) ) {
+    strbuf_putc( eng->sbuf, ' ' );
     c_ast_func_params_english( ast, eng );
   }
   if ( ast->lambda.ret_ast != NULL )
-    FPUTS( " returning ", eng->fout );
+    strbuf_puts( eng->sbuf, " returning " );
 }
 
 /**
@@ -687,11 +694,11 @@ static void c_ptr_mbr_ast_english( c_ast_t const *ast,
   assert( ast->kind == K_POINTER_TO_MEMBER );
   assert( eng != NULL );
 
-  c_type_name_nobase_english( &ast->type, eng->fout );
-  FPRINTF( eng->fout, "%s of ", c_kind_name( ast->kind ) );
-  fputs_sp( c_tid_english( ast->type.btids ), eng->fout );
-  c_sname_english( &ast->ptr_mbr.class_sname, eng->fout );
-  FPUTC( ' ', eng->fout );
+  c_type_name_nobase_english( &ast->type, eng->sbuf );
+  strbuf_printf( eng->sbuf, "%s of ", c_kind_name( ast->kind ) );
+  strbuf_puts_sp( eng->sbuf, c_tid_english( ast->type.btids ) );
+  c_sname_english( &ast->ptr_mbr.class_sname, eng->sbuf );
+  strbuf_putc( eng->sbuf, ' ' );
 }
 
 /**
@@ -706,8 +713,8 @@ static void c_ptr_ref_ast_english( c_ast_t const *ast,
   assert( (ast->kind & (K_POINTER | K_ANY_REFERENCE)) != 0 );
   assert( eng != NULL );
 
-  c_type_name_nobase_english( &ast->type, eng->fout );
-  FPRINTF( eng->fout, "%s to ", c_kind_name( ast->kind ) );
+  c_type_name_nobase_english( &ast->type, eng->sbuf );
+  strbuf_printf( eng->sbuf, "%s to ", c_kind_name( ast->kind ) );
 }
 
 /**
@@ -716,16 +723,18 @@ static void c_ptr_ref_ast_english( c_ast_t const *ast,
  * `S::T::x` is printed as "of scope T of scope S."
  *
  * @param scope A pointer to the outermost scope.
- * @param fout The `FILE` to emit to.
+ * @param sbuf The \ref strbuf to emit to.
  */
-static void c_scope_english( c_scope_t const *scope, FILE *fout ) {
+static void c_scope_english( c_scope_t const *scope, strbuf_t *sbuf ) {
   assert( scope != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   if ( scope->next != NULL ) {
-    c_scope_english( scope->next, fout );
+    c_scope_english( scope->next, sbuf );
     c_scope_data_t const *const data = c_scope_data( scope );
-    FPRINTF( fout, " of %s %s", c_type_english( &data->type ), data->name );
+    strbuf_printf(
+      sbuf, " of %s %s", c_type_english( &data->type ), data->name
+    );
   }
 }
 
@@ -733,19 +742,19 @@ static void c_scope_english( c_scope_t const *scope, FILE *fout ) {
  * Prints \a sname in pseudo-English.
  *
  * @param sname The name to print.
- * @param fout The `FILE` to print to.
+ * @param sbuf The \ref strbuf to print to.
  *
  * @note A newline is _not_ printed.
  *
  * @sa c_sname_gibberish()
  */
-static void c_sname_english( c_sname_t const *sname, FILE *fout ) {
+static void c_sname_english( c_sname_t const *sname, strbuf_t *sbuf ) {
   assert( sname != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   if ( !c_sname_empty( sname ) ) {
-    FPUTS( c_sname_local_name( sname ), fout );
-    c_scope_english( sname->head, fout );
+    strbuf_puts( sbuf, c_sname_local_name( sname ) );
+    c_scope_english( sname->head, sbuf );
   }
 }
 
@@ -761,10 +770,10 @@ static void c_struct_bind_ast_english( c_ast_t const *ast,
   assert( ast->kind == K_STRUCTURED_BINDING );
   assert( eng != NULL );
 
-  fputs_sp( c_tid_english( ast->type.stids ), eng->fout );
+  strbuf_puts_sp( eng->sbuf, c_tid_english( ast->type.stids ) );
   if ( c_tid_is_any( ast->type.stids, TS_ANY_REFERENCE ) )
-    FPUTS( "to ", eng->fout );
-  FPUTS( c_kind_name( ast->kind ), eng->fout );
+    strbuf_puts( eng->sbuf, "to " );
+  strbuf_puts( eng->sbuf, c_kind_name( ast->kind ) );
 }
 
 /**
@@ -772,14 +781,14 @@ static void c_struct_bind_ast_english( c_ast_t const *ast,
  * of \a type, if any.
  *
  * @param type The type to perhaps print.
- * @param fout The `FILE` to emit to.
+ * @param sbuf The \ref strbuf to emit to.
  */
-static void c_type_name_nobase_english( c_type_t const *type, FILE *fout ) {
+static void c_type_name_nobase_english( c_type_t const *type, strbuf_t *sbuf ) {
   assert( type != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   c_type_t const nobase_type = { TB_NONE, type->stids, type->atids };
-  fputs_sp( c_type_english( &nobase_type ), fout );
+  strbuf_puts_sp( sbuf, c_type_english( &nobase_type ) );
 }
 
 /**
@@ -802,9 +811,9 @@ static void c_typedef_ast_english( c_ast_t const *ast,
     print_type = true;
   }
   if ( print_type )
-    FPRINTF( eng->fout, "%s ", c_type_english( &type ) );
-  c_sname_english( &ast->tdef.for_ast->sname, eng->fout );
-  c_ast_bit_width_english( ast, eng->fout );
+    strbuf_printf( eng->sbuf, "%s ", c_type_english( &type ) );
+  c_sname_english( &ast->tdef.for_ast->sname, eng->sbuf );
+  c_ast_bit_width_english( ast, eng->sbuf );
 }
 
 /**
@@ -819,29 +828,29 @@ static void c_udef_conv_ast_english( c_ast_t const *ast,
   assert( ast->kind == K_USER_DEFINED_CONV );
   assert( eng != NULL );
 
-  fputs_sp( c_type_english( &ast->type ), eng->fout );
-  FPUTS( c_kind_name( ast->kind ), eng->fout );
+  strbuf_puts_sp( eng->sbuf, c_type_english( &ast->type ) );
+  strbuf_puts( eng->sbuf, c_kind_name( ast->kind ) );
   if ( !c_sname_empty( &ast->sname ) ) {
-    FPRINTF( eng->fout,
+    strbuf_printf( eng->sbuf,
       " of %s ", c_type_english( c_sname_local_type( &ast->sname ) )
     );
-    c_sname_english( &ast->sname, eng->fout );
+    c_sname_english( &ast->sname, eng->sbuf );
   }
-  FPUTS( " returning ", eng->fout );
+  strbuf_puts( eng->sbuf, " returning " );
 }
 
 /**
  * Initializes an eng_state.
  *
  * @param eng The eng_state to initialize.
- * @param fout The `FILE` to print to.
+ * @param sbuf The \ref strbuf to print to.
  */
-static void eng_init( eng_state_t *eng, FILE *fout ) {
+static void eng_init( eng_state_t *eng, strbuf_t *sbuf ) {
   assert( eng != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   *eng = (eng_state_t){
-    .fout = fout
+    .sbuf = sbuf
   };
 }
 
@@ -880,8 +889,8 @@ static slist_t make_declare_ast_lists( c_ast_list_t const *ast_list ) {
   slist_t declare_lists;
   slist_init( &declare_lists );
 
-  FOREACH_SLIST_NODE( ast_node, ast_list ) {
-    c_ast_t *const list_ast = ast_node->data;
+  FOREACH_AST_LIST( ast_elt, ast_list ) {
+    c_ast_t *const list_ast = *ast_elt;
     slist_t *equal_ast_list = NULL;
 
     if ( (list_ast->kind & (K_ANY_OBJECT | K_FUNCTION | K_OPERATOR)) != 0 ) {
@@ -931,13 +940,23 @@ static slist_t make_declare_ast_lists( c_ast_list_t const *ast_list ) {
 ////////// extern functions ///////////////////////////////////////////////////
 
 void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_ast_english_sbuf( ast, eng_flags, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_ast_english_sbuf( c_ast_t const *ast, decl_flags_t eng_flags,
+                         strbuf_t *sbuf ) {
   assert( ast != NULL );
   assert( is_1n_bit_only_in_set( eng_flags, C_ENG_ANY ) );
   assert( (eng_flags & C_ENG_DECL) != 0 );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   if ( (eng_flags & C_ENG_OPT_OMIT_DECLARE) == 0 && ast->kind != K_CAST ) {
-    FPUTS( "declare ", fout );
+    strbuf_puts( sbuf, "declare " );
 
     // We can't just check to see if ast->sname is empty and print it only if
     // it isn't because operators have a name but don't use ast->sname.
@@ -959,8 +978,8 @@ void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout ) {
       case K_RVALUE_REFERENCE:
       case K_TYPEDEF:
       case K_USER_DEFINED_LIT:
-        c_ast_name_english( ast, fout );
-        FPUTS( " as ", fout );
+        c_ast_name_english( ast, sbuf );
+        strbuf_puts( sbuf, " as " );
         break;
 
       case K_LAMBDA:
@@ -969,11 +988,11 @@ void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout ) {
 
       case K_STRUCTURED_BINDING:
         FOREACH_SLIST_NODE( sname_node, &ast->struct_bind.sname_list ) {
-          FPUTS( c_sname_local_name( sname_node->data ), fout );
+          strbuf_puts( sbuf, c_sname_local_name( sname_node->data ) );
           if ( sname_node->next != NULL )
-            FPUTS( ", ", fout );
+            strbuf_puts( sbuf, ", " );
         } // for
-        FPUTS( " as ", fout );
+        strbuf_puts( sbuf, " as " );
         break;
 
       case K_CAPTURE:
@@ -987,19 +1006,28 @@ void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout ) {
   }
 
   eng_state_t eng;
-  eng_init( &eng, fout );
+  eng_init( &eng, sbuf );
   c_ast_visit_english( ast, &eng );
   c_ast_alignas_english( ast, &eng );
 }
 
 void c_ast_list_english( c_ast_list_t const *ast_list, FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_ast_list_english_sbuf( ast_list, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_ast_list_english_sbuf( c_ast_list_t const *ast_list, strbuf_t *sbuf ) {
   assert( ast_list != NULL );
 
-  switch ( slist_len( ast_list ) ) {
+  switch ( c_ast_list_len( ast_list ) ) {
     case 1:;
-      c_ast_t const *const ast = slist_front( ast_list );
-      c_ast_english( ast, C_ENG_DECL, fout );
-      FPUTC( '\n', fout );
+      c_ast_t const *const ast = c_ast_list_front( ast_list );
+      c_ast_english_sbuf( ast, C_ENG_DECL, sbuf );
+      strbuf_putc( sbuf, '\n' );
       FALLTHROUGH;
     case 0:
       return;
@@ -1017,21 +1045,21 @@ void c_ast_list_english( c_ast_list_t const *ast_list, FILE *fout ) {
     // First, print "declare" followed by the names of all the declarations
     // that have the same base type.
     //
-    FPUTS( "declare ", fout );
+    strbuf_puts( sbuf, "declare " );
     FOREACH_SLIST_NODE( equal_node, equal_ast_list ) {
       c_ast_t const *const equal_ast = equal_node->data;
-      c_ast_name_english( equal_ast, fout );
+      c_ast_name_english( equal_ast, sbuf );
       if ( equal_node->next != NULL )
-        FPUTS( ", ", fout );
+        strbuf_puts( sbuf, ", " );
     } // for
 
     //
     // Now print "as" followed by the type.
     //
-    FPUTS( " as ", fout );
+    strbuf_puts( sbuf, " as " );
     c_ast_t const *const ast = slist_front( equal_ast_list );
-    c_ast_english( ast, C_ENG_DECL | C_ENG_OPT_OMIT_DECLARE, fout );
-    FPUTC( '\n', fout );
+    c_ast_english_sbuf( ast, C_ENG_DECL | C_ENG_OPT_OMIT_DECLARE, sbuf );
+    strbuf_putc( sbuf, '\n' );
   } // for
 
   // Clean-up list and sub-lists.
@@ -1054,16 +1082,25 @@ char const* c_cast_english( c_cast_kind_t kind ) {
 }
 
 void c_typedef_english( c_typedef_t const *tdef, FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_typedef_english_sbuf( tdef, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_typedef_english_sbuf( c_typedef_t const *tdef, strbuf_t *sbuf ) {
   assert( tdef != NULL );
   assert( tdef->ast != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
-  FPUTS( "define ", fout );
-  c_sname_english( &tdef->ast->sname, fout );
-  FPUTS( " as ", fout );
+  strbuf_puts( sbuf, "define " );
+  c_sname_english( &tdef->ast->sname, sbuf );
+  strbuf_puts( sbuf, " as " );
 
   eng_state_t eng;
-  eng_init( &eng, fout );
+  eng_init( &eng, sbuf );
   c_ast_visit_english( tdef->ast, &eng );
 }
 
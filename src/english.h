@@ -28,6 +28,7 @@
 
 // local
 #include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
 #include "types.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -54,6 +55,7 @@
  *
  * @note A newline is _not_ printed.
  *
+ * @sa c_ast_english_sbuf()
  * @sa c_ast_gibberish()
  * @sa c_ast_list_english()
  * @sa c_typedef_english()
@@ -62,6 +64,21 @@
  */
 void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout );
 
+/**
+ * Explains \a ast in pseudo-English into \a sbuf.
+ *
+ * @param ast The AST to explain.
+ * @param eng_flags The English flags to use; _must_ include #C_ENG_DECL.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @note A newline is _not_ appended.
+ *
+ * @sa c_ast_english()
+ * @sa c_ast_gibberish_sbuf()
+ */
+void c_ast_english_sbuf( c_ast_t const *ast, decl_flags_t eng_flags,
+                         strbuf_t *sbuf );
+
 /**
  * Explains \a ast_list in pseudo-English.
  *
@@ -72,10 +89,23 @@ void c_ast_english( c_ast_t const *ast, decl_flags_t eng_flags, FILE *fout );
  *
  * @sa c_ast_english()
  * @sa c_ast_gibberish()
+ * @sa c_ast_list_english_sbuf()
  * @sa c_typedef_english()
  */
 void c_ast_list_english( c_ast_list_t const *ast_list, FILE *fout );
 
+/**
+ * Explains \a ast_list in pseudo-English into \a sbuf.
+ *
+ * @param ast_list The list of AST nodes to explain.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @note A newline _is_ appended.
+ *
+ * @sa c_ast_list_english()
+ */
+void c_ast_list_english_sbuf( c_ast_list_t const *ast_list, strbuf_t *sbuf );
+
 /**
  * Given \a kind, gets the associated English literal.
  *
@@ -94,12 +124,24 @@ char const* c_cast_english( c_cast_kind_t kind );
  * @param fout The `FILE` to print to.
  *
  * @sa c_ast_english()
+ * @sa c_typedef_english_sbuf()
  * @sa c_typedef_gibberish()
  * @sa print_type_decl()
  * @sa show_type()
  */
 void c_typedef_english( c_typedef_t const *tdef, FILE *fout );
 
+/**
+ * Explains \a tdef as a type in pseudo-English into \a sbuf.
+ *
+ * @param tdef The type to explain.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa c_typedef_english()
+ * @sa c_typedef_gibberish_sbuf()
+ */
+void c_typedef_english_sbuf( c_typedef_t const *tdef, strbuf_t *sbuf );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
@@ -61,19 +61,75 @@
  * @{
  */
 
+/**
+ * The maximum length of a chain of children for which c_ast_gibberish_impl()
+ * allocates the nodes of its \ref gib_chain on the stack rather than the heap.
+ */
+#define GIB_CHAIN_LOCAL_LEN_MAX    8u
+
 ////////// typedefs ///////////////////////////////////////////////////////////
 
-typedef struct gib_state gib_state_t;
+typedef struct gib_chain      gib_chain_t;
+typedef struct gib_chain_node gib_chain_node_t;
+typedef struct gib_func_quals gib_func_quals_t;
+typedef struct gib_state      gib_state_t;
 
 ////////// structs ////////////////////////////////////////////////////////////
 
+/**
+ * An AST in a \ref gib_chain along with the results of searches relative to
+ * it.
+ */
+struct gib_chain_node {
+  c_ast_t const  *ast;                  ///< The AST.
+  c_ast_t const  *func_ast;             ///< Function-like ancestor, if any.
+  bool            has_name_up;          ///< It or an ancestor has a name?
+  bool            is_west_decl_kind;    ///< It or a child is west decl kind?
+};
+
+/**
+ * The chain of children that c_ast_gibberish_impl() is printing.
+ *
+ * @remarks Printing each pointer or reference requires searching up or down
+ * the chain from it.  The results of those searches are calculated once for
+ * the whole chain so that printing takes time linear rather than quadratic in
+ * the length of the chain.
+ *
+ * @sa gib_chain_find()
+ * @sa gib_chain_init()
+ */
+struct gib_chain {
+  gib_chain_node_t *nodes;              ///< Nodes from root to leaf.
+  size_t            hint;               ///< Index at which to start finding.
+};
+
+/**
+ * The parts of the type of a function-like AST that are printed after its
+ * parameters rather than before its name.
+ *
+ * @sa gib_func_quals_take()
+ */
+struct gib_func_quals {
+  c_tid_t cv_qual_stids;                ///< `const`, `volatile`, etc.
+  c_tid_t msc_call_atids;               ///< Microsoft calling convention.
+  c_tid_t ref_qual_stids;               ///< `&` or `&&`.
+  bool    is_default;                   ///< `= default`?
+  bool    is_delete;                    ///< `= delete`?
+  bool    is_final;                     ///< `final`?
+  bool    is_noexcept;                  ///< `noexcept`?
+  bool    is_override;                  ///< `override`?
+  bool    is_pure_virtual;              ///< `= 0`?
+  bool    is_throw;                     ///< `throw()`?
+};
+
 /**
  * State maintained by c_ast_gibberish() (because there'd be too many function
  * arguments otherwise).
  */
 struct gib_state {
   decl_flags_t  gib_flags;              ///< Gibberish printing flags.
-  FILE         *fout;                   ///< Where to print the gibberish.
+  strbuf_t     *sbuf;                   ///< Where to print the gibberish.
+  gib_chain_t  *chain;                  ///< Chain being printed, if any.
   bool          is_nested_scope;        ///< Within `{` ... `}`?
   bool          is_postfix;             ///< Doing postfix gibberish?
   bool          printed_space;          ///< Printed a space yet?
@@ -82,6 +138,7 @@ struct gib_state {
 
 ////////// local functions ////////////////////////////////////////////////////
 
+static void c_ast_gibberish_up( c_ast_t const*, gib_state_t* );
 static void c_ast_list_gibberish( c_ast_list_t const*, gib_state_t const* );
 static void c_ast_name_gibberish( c_ast_t const*, gib_state_t* );
 static void c_ast_postfix_gibberish( c_ast_t const*, gib_state_t* );
@@ -96,17 +153,21 @@ static void c_ecsu_ast_gibberish( c_ast_t const*, c_type_t*, gib_state_t* );
 static void c_lambda_ast_gibberish( c_ast_t const*, c_type_t const*,
                                     gib_state_t* );
 static void c_name_ast_gibberish( c_ast_t const*, gib_state_t* );
-static void c_ptr_mbr_ast_gibberish( c_ast_t const*, gib_state_t* );
-static void c_ptr_ref_ast_gibberish( c_ast_t const*, c_type_t const*,
-                                     gib_state_t* );
 static void c_struct_bind_ast_gibberish( c_ast_t const*, gib_state_t* );
 static void c_typedef_ast_gibberish( c_ast_t const*, c_type_t const*,
                                      gib_state_t* );
-static void gib_init( gib_state_t*, decl_flags_t, FILE* );
+static void gib_chain_init( gib_chain_t*, c_ast_t const*, size_t,
+                            gib_chain_node_t* );
+static void gib_func_quals_take( c_type_t*, gib_func_quals_t* );
+static void gib_init( gib_state_t*, decl_flags_t, strbuf_t* );
 
 NODISCARD
 static bool c_ast_space_before_ptr_ref( c_ast_t const*, gib_state_t const* );
 
+NODISCARD
+static gib_chain_node_t const* gib_chain_find( gib_state_t const*,
+                                               c_ast_t const* );
+
 ////////// inline functions ///////////////////////////////////////////////////
 
 /**
@@ -114,26 +175,85 @@ static bool c_ast_space_before_ptr_ref( c_ast_t const*, gib_state_t const* );
  * #K_ANY_FUNCTION_LIKE, if any.
  *
  * @param ast The AST node whose parent to start from.
+ * @param gib The gib_state to use.
  * @return Returns a pointer to an ancestor of \a ast that is of kind
  * #K_ANY_FUNCTION_LIKE or NULL for none.
  */
 NODISCARD
-static inline c_ast_t const* c_ast_find_parent_func( c_ast_t const *ast ) {
+static inline c_ast_t const* c_ast_find_parent_func( c_ast_t const *ast,
+                                                     gib_state_t const *gib ) {
+  gib_chain_node_t const *const node = gib_chain_find( gib, ast );
+  if ( node != NULL )
+    return node->func_ast;
   c_ast_t const *const parent_ast = ast->parent_ast;
   return parent_ast != NULL ?
     c_ast_find_kind_any( parent_ast, C_VISIT_UP, K_ANY_FUNCTION_LIKE ) : NULL;
 }
 
+/**
+ * Checks whether \a ast or any ancestor AST thereof has a name.
+ *
+ * @param ast The AST node to start checking at.
+ * @param gib The gib_state to use.
+ * @return Returns `true` only if it does.
+ */
+NODISCARD
+static inline bool c_ast_has_name_up( c_ast_t const *ast,
+                                      gib_state_t const *gib ) {
+  gib_chain_node_t const *const node = gib_chain_find( gib, ast );
+  return node != NULL ?
+    node->has_name_up : c_ast_find_name( ast, C_VISIT_UP ) != NULL;
+}
+
 /**
  * Checks whether \a ast or any child AST thereof is one of \ref
  * opt_west_decl_kinds.
  *
  * @param ast The AST node to start checking at.
+ * @param gib The gib_state to use.
  * @return Returns `true` only if it is.
  */
 NODISCARD
-static inline bool c_ast_is_west_decl_kind( c_ast_t const *ast ) {
-  return c_ast_find_kind_any( ast, C_VISIT_DOWN, opt_west_decl_kinds ) != NULL;
+static inline bool c_ast_is_west_decl_kind( c_ast_t const *ast,
+                                            gib_state_t const *gib ) {
+  gib_chain_node_t const *const node = gib_chain_find( gib, ast );
+  return node != NULL ? node->is_west_decl_kind :
+    c_ast_find_kind_any( ast, C_VISIT_DOWN, opt_west_decl_kinds ) != NULL;
+}
+
+/**
+ * Gets the type of \a ast to print.
+ *
+ * @param ast The AST to get the type of.
+ * @param gib The gib_state to use.
+ * @return Returns said type.
+ */
+NODISCARD
+static inline c_type_t gib_ast_type( c_ast_t const *ast,
+                                     gib_state_t const *gib ) {
+  c_type_t type = ast->type;
+  if ( (gib->gib_flags & C_GIB_USING) != 0 ) {
+    //
+    // If we're printing a "using" declaration, don't print either "typedef" or
+    // attributes since they will have been printed in c_typedef_gibberish().
+    //
+    type.stids &= c_tid_compl( TS_typedef );
+    type.atids = TA_NONE;
+  }
+  return type;
+}
+
+/**
+ * Checks whether the return type of \a ast should be printed as a trailing
+ * return type.
+ *
+ * @param ast The AST to check.
+ * @return Returns `true` only if it should.
+ */
+NODISCARD
+static inline bool gib_is_trailing_ret( c_ast_t const *ast ) {
+  return (ast->kind & K_ANY_TRAILING_RETURN) != 0 &&
+    opt_trailing_ret && OPT_LANG_IS( TRAILING_RETURN_TYPES );
 }
 
 /**
@@ -143,7 +263,7 @@ static inline bool c_ast_is_west_decl_kind( c_ast_t const *ast ) {
  */
 static inline void gib_print_space_once( gib_state_t *gib ) {
   if ( false_set( &gib->printed_space ) )
-    FPUTC( ' ', gib->fout );
+    strbuf_putc( gib->sbuf, ' ' );
 }
 
 ////////// local functions ////////////////////////////////////////////////////
@@ -204,27 +324,31 @@ static char const* alt_token_c( char const *token ) {
  * Prints the alignment of \a ast in C/C++.
  *
  * @param ast The AST to print the alignment of.
- * @param fout The `FILE` to print to.
+ * @param sbuf The \ref strbuf to print to.
  */
-static void c_ast_alignas_gibberish( c_ast_t const *ast, FILE *fout ) {
+static void c_ast_alignas_gibberish( c_ast_t const *ast, strbuf_t *sbuf ) {
   assert( ast != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
-  switch ( ast->align.kind ) {
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL )
+    return;
+
+  switch ( align->kind ) {
     case C_ALIGNAS_NONE:
-      break;
+      unreachable();
     case C_ALIGNAS_BYTES:
-      FPRINTF( fout, "%s(%u) ", alignas_name(), ast->align.bytes );
+      strbuf_printf( sbuf, "%s(%u) ", alignas_name(), align->bytes );
       break;
     case C_ALIGNAS_SNAME:
-      FPRINTF( fout,
-        "%s(%s) ", alignas_name(), c_sname_gibberish( &ast->align.sname )
+      strbuf_printf( sbuf,
+        "%s(%s) ", alignas_name(), c_sname_gibberish( &align->sname )
       );
       break;
     case C_ALIGNAS_TYPE:
-      FPRINTF( fout, "%s(", alignas_name() );
-      c_ast_gibberish( ast->align.type_ast, C_GIB_PRINT_DECL, fout );
-      FPUTS( ") ", fout );
+      strbuf_printf( sbuf, "%s(", alignas_name() );
+      c_ast_gibberish_sbuf( align->type_ast, C_GIB_PRINT_DECL, sbuf );
+      strbuf_puts( sbuf, ") " );
       break;
   } // switch
 }
@@ -241,27 +365,31 @@ static void c_ast_array_size_gibberish( c_ast_t const *ast,
   assert( ast->kind == K_ARRAY );
   assert( gib != NULL );
 
-  FPUTS( other_token_c( "[" ), gib->fout );
+  strbuf_puts( gib->sbuf, other_token_c( "[" ) );
 
   bool const is_qual = c_tid_is_any( ast->type.stids, TS_ANY_ARRAY_QUALIFIER );
   if ( is_qual )
-    FPUTS( c_type_gibberish( &ast->type ), gib->fout );
+    strbuf_puts( gib->sbuf, c_type_gibberish( &ast->type ) );
 
   switch ( ast->array.kind ) {
     case C_ARRAY_SIZE_NONE:
       break;
     case C_ARRAY_SIZE_INT:
-      FPRINTF( gib->fout, "%s%u", is_qual ? " " : "", ast->array.size_int );
+      strbuf_printf(
+        gib->sbuf, "%s%u", is_qual ? " " : "", ast->array.size_int
+      );
       break;
     case C_ARRAY_SIZE_NAME:
-      FPRINTF( gib->fout, "%s%s", is_qual ? " " : "", ast->array.size_name );
+      strbuf_printf(
+        gib->sbuf, "%s%s", is_qual ? " " : "", ast->array.size_name
+      );
       break;
     case C_ARRAY_SIZE_VLA:
-      FPUTC( '*', gib->fout );
+      strbuf_putc( gib->sbuf, '*' );
       break;
   } // switch
 
-  FPUTS( other_token_c( "]" ), gib->fout );
+  strbuf_puts( gib->sbuf, other_token_c( "]" ) );
 }
 
 /**
@@ -277,47 +405,29 @@ static void c_ast_bit_width_gibberish( c_ast_t const *ast,
   assert( gib != NULL );
 
   if ( ast->bit_field.bit_width > 0 )
-    FPRINTF( gib->fout, " : %u", ast->bit_field.bit_width );
+    strbuf_printf( gib->sbuf, " : %u", ast->bit_field.bit_width );
 }
 
 /**
- * Prints \a ast as gibberish, aka, a C/C++ declaration.
+ * Prints the part of \a ast as gibberish that precedes that of its child, if
+ * any.
  *
  * @param ast The AST to print.
  * @param gib The gib_state to use.
+ * @return Returns the child of \a ast to print next or NULL if none.
+ *
+ * @sa c_ast_gibberish_impl()
+ * @sa c_ast_gibberish_up()
  */
-static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
+NODISCARD
+static c_ast_t const* c_ast_gibberish_down( c_ast_t const *ast,
+                                            gib_state_t *gib ) {
   assert( ast != NULL );
   assert( gib != NULL );
 
-  gib_state_t child_gib;
-  c_type_t type = ast->type;
-
-  if ( (gib->gib_flags & C_GIB_USING) != 0 ) {
-    //
-    // If we're printing a "using" declaration, don't print either "typedef" or
-    // attributes since they will have been printed in c_typedef_gibberish().
-    //
-    type.stids &= c_tid_compl( TS_typedef );
-    type.atids = TA_NONE;
-  }
-
-  c_tid_t cv_qual_stids   = TS_NONE;
-  bool    is_default      = false;
-  bool    is_delete       = false;
-  bool    is_final        = false;
-  bool    is_noexcept     = false;
-  bool    is_override     = false;
-  bool    is_pure_virtual = false;
-  bool    is_throw        = false;
-  bool    is_trailing_ret = false;
-  c_tid_t msc_call_atids  = TA_NONE;
-  c_tid_t ref_qual_stids  = TS_NONE;
+  c_type_t type = gib_ast_type( ast, gib );
+  gib_func_quals_t gfq;
 
-  //
-  // This isn't implemented using a visitor due to the complicated way the
-  // nodes need to be visited in order to print gibberish.
-  //
   switch ( ast->kind ) {
     case K_CONSTRUCTOR:
     case K_DESTRUCTOR:
@@ -336,123 +446,27 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
       // These things aren't printed as part of the type beforehand, so strip
       // them out of the type here, but print them after the parameters.
       //
-      cv_qual_stids   = (type.stids & TS_ANY_QUALIFIER);
-      is_default      = (type.stids & TS_default) != TS_NONE;
-      is_delete       = (type.stids & TS_delete) != TS_NONE;
-      is_final        = (type.stids & TS_final) != TS_NONE;
-      is_noexcept     = (type.stids & TS_noexcept) != TS_NONE;
-      is_pure_virtual = (type.stids & TS_PURE_virtual) != TS_NONE;
-      is_throw        = (type.stids & TS_throw) != TS_NONE;
-      ref_qual_stids  = (type.stids & TS_ANY_REFERENCE);
-
-      // In C++, "override" should be printed only if "final" isn't.
-      is_override     = !is_final && (type.stids & TS_override) != TS_NONE;
-
-      type.stids &= c_tid_compl(
-                       TS_ANY_QUALIFIER
-                     | TS_ANY_REFERENCE
-                     | TS_default
-                     | TS_delete
-                     | TS_final
-                     | TS_noexcept
-                     | TS_override
-                     | TS_PURE_virtual
-                     | TS_throw
-                     // In C++, if either "override" or "final" is printed,
-                     // "virtual" shouldn't be.
-                     | (is_override || is_final ? TS_virtual : TS_NONE)
-                   );
-
-      //
-      // Microsoft calling conventions are printed specially.
-      //
-      msc_call_atids = type.atids & TA_ANY_MSC_CALL;
-      type.atids &= c_tid_compl( TA_ANY_MSC_CALL );
-
-      //
-      // If noexcept is supported, change throw() to noexcept.
-      //
-      if ( OPT_LANG_IS( noexcept ) && true_clear( &is_throw ) )
-        is_noexcept = true;
+      gib_func_quals_take( &type, &gfq );
       FALLTHROUGH;
 
     case K_APPLE_BLOCK:
     case K_ARRAY:
       if ( ast->kind != K_ARRAY ||
            ( !c_tid_is_any( type.stids, TS_ANY_ARRAY_QUALIFIER ) ) ) {
-        fputs_sp( c_type_gibberish( &type ), gib->fout );
+        strbuf_puts_sp( gib->sbuf, c_type_gibberish( &type ) );
       }
       if ( ast->kind == K_USER_DEFINED_CONV ) {
         if ( !c_sname_empty( &ast->sname ) )
-          FPRINTF( gib->fout, "%s::", c_sname_gibberish( &ast->sname ) );
-        FPUTS( "operator ", gib->fout );
-      }
-      if ( ast->parent.of_ast != NULL ) {
-        is_trailing_ret = (ast->kind & K_ANY_TRAILING_RETURN) != 0 &&
-          opt_trailing_ret && OPT_LANG_IS( TRAILING_RETURN_TYPES );
-        if ( is_trailing_ret )
-          FPUTS( L_auto, gib->fout );
-        else
-          c_ast_gibberish_impl( ast->parent.of_ast, gib );
-      }
-      if ( msc_call_atids != TA_NONE &&
-           !c_ast_parent_is_kind_any( ast, K_POINTER ) ) {
-        //
-        // If ast is a function having a Microsoft calling convention, but not
-        // a pointer to such a function, print the calling convention.
-        // (Pointers to such functions are handled in
-        // c_ast_postfix_gibberish().)
-        //
-        FPRINTF( gib->fout, " %s", c_tid_gibberish( msc_call_atids ) );
-      }
-
-      if ( false_set( &gib->is_postfix ) ) {
-        if ( (gib->gib_flags & (C_GIB_PRINT_CAST | C_GIB_USING)) == 0 )
-          gib_print_space_once( gib );
-        c_ast_postfix_gibberish( ast, gib );
-      }
-
-      fputsp_s( c_tid_gibberish( cv_qual_stids ), gib->fout );
-
-      if ( ref_qual_stids != TS_NONE ) {
-        FPRINTF( gib->fout, " %s",
-          other_token_c(
-            c_tid_is_any( ref_qual_stids, TS_REFERENCE ) ? "&" : "&&"
-          )
-        );
+          strbuf_printf( gib->sbuf, "%s::", c_sname_gibberish( &ast->sname ) );
+        strbuf_puts( gib->sbuf, "operator " );
       }
-
-      if ( is_noexcept )
-        FPUTS( " noexcept", gib->fout );
-      else if ( is_throw )
-        FPUTS( " throw()", gib->fout );
-      if ( is_override )
-        FPUTS( " override", gib->fout );
-      else if ( is_final )
-        FPUTS( " final", gib->fout );
-
-      if ( is_trailing_ret ) {
-        FPUTS( " -> ", gib->fout );
-        //
-        // Temporarily orphan the return type's AST in order to print it as a
-        // stand-alone trailing type.
-        //
-        c_ast_t *const ret_ast = ast->func.ret_ast;
-        c_ast_t *const orig_ret_ast_parent_ast = ret_ast->parent_ast;
-        ret_ast->parent_ast = NULL;
-
-        gib_init( &child_gib, C_GIB_PRINT_DECL, gib->fout );
-        c_ast_gibberish_impl( ret_ast, &child_gib );
-        ret_ast->parent_ast = orig_ret_ast_parent_ast;
+      if ( ast->parent.of_ast == NULL )
+        return NULL;
+      if ( gib_is_trailing_ret( ast ) ) {
+        strbuf_puts( gib->sbuf, L_auto );
+        return NULL;
       }
-
-      if ( is_pure_virtual )
-        FPUTS( " = 0", gib->fout );
-      else if ( is_default )
-        FPUTS( " = default", gib->fout );
-      else if ( is_delete )
-        FPUTS( " = delete", gib->fout );
-      break;
+      return ast->parent.of_ast;
 
     case K_BUILTIN:
       c_builtin_ast_gibberish( ast, &type, gib );
@@ -496,12 +510,14 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
     case K_POINTER:
     case K_REFERENCE:
     case K_RVALUE_REFERENCE:
-      c_ptr_ref_ast_gibberish( ast, &type, gib );
-      break;
+      if ( (gib->gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 )
+        strbuf_puts_sp(
+          gib->sbuf, c_tid_gibberish( type.stids & TS_ANY_STORAGE )
+        );
+      FALLTHROUGH;
 
     case K_POINTER_TO_MEMBER:
-      c_ptr_mbr_ast_gibberish( ast, gib );
-      break;
+      return ast->ptr_ref.to_ast;
 
     case K_STRUCTURED_BINDING:
       c_struct_bind_ast_gibberish( ast, gib );
@@ -512,7 +528,191 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
       break;
 
     case K_VARIADIC:
-      FPUTS( L_ELLIPSIS, gib->fout );
+      strbuf_puts( gib->sbuf, L_ELLIPSIS );
+      break;
+
+    case K_PLACEHOLDER:
+      unreachable();
+  } // switch
+
+  return NULL;
+}
+
+/**
+ * Prints \a ast as gibberish, aka, a C/C++ declaration.
+ *
+ * @remarks Printing an AST generally requires printing part of it, then its
+ * child, then the rest of it, e.g., for a pointer, its child's type, then the
+ * `*`.  Rather than recursing down the chain of children (that can be
+ * arbitrarily long), this descends the chain printing the part of each AST
+ * that precedes its child, then ascends the chain printing the rest of each.
+ *
+ * @param ast The AST to print.
+ * @param gib The gib_state to use.
+ *
+ * @sa c_ast_gibberish_down()
+ * @sa c_ast_gibberish_up()
+ */
+static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
+  assert( ast != NULL );
+  assert( gib != NULL );
+
+  //
+  // This isn't implemented using a visitor due to the complicated way the
+  // nodes need to be visited in order to print gibberish.
+  //
+  c_ast_t const *const root_ast = ast;
+  size_t chain_len = 1;
+  for ( c_ast_t const *child_ast;
+        (child_ast = c_ast_gibberish_down( ast, gib )) != NULL;
+        ast = child_ast, ++chain_len ) {
+    assert( child_ast->parent_ast == ast );
+  } // for
+
+  gib_chain_node_t local_nodes[ GIB_CHAIN_LOCAL_LEN_MAX ];
+  gib_chain_t chain, *const orig_chain = gib->chain;
+  gib_chain_init(
+    &chain, ast, chain_len,
+    chain_len <= ARRAY_SIZE( local_nodes ) ?
+      local_nodes : MALLOC( gib_chain_node_t, chain_len )
+  );
+  gib->chain = &chain;
+
+  for ( size_t i = chain_len; i-- > 0; ast = ast->parent_ast ) {
+    chain.hint = i;
+    c_ast_gibberish_up( ast, gib );
+  } // for
+  assert( ast == root_ast->parent_ast );
+
+  gib->chain = orig_chain;
+  if ( chain.nodes != local_nodes )
+    FREE( chain.nodes );
+}
+
+/**
+ * Prints the part of \a ast as gibberish that follows that of its child, if
+ * any.
+ *
+ * @param ast The AST to print.
+ * @param gib The gib_state to use.
+ *
+ * @sa c_ast_gibberish_down()
+ * @sa c_ast_gibberish_impl()
+ */
+static void c_ast_gibberish_up( c_ast_t const *ast, gib_state_t *gib ) {
+  assert( ast != NULL );
+  assert( gib != NULL );
+
+  gib_func_quals_t gfq = {
+    .cv_qual_stids  = TS_NONE,
+    .msc_call_atids = TA_NONE,
+    .ref_qual_stids = TS_NONE
+  };
+  bool is_trailing_ret = false;
+
+  switch ( ast->kind ) {
+    case K_CONSTRUCTOR:
+    case K_DESTRUCTOR:
+    case K_FUNCTION:
+    case K_OPERATOR:
+    case K_USER_DEFINED_CONV:
+    case K_USER_DEFINED_LIT:;
+      c_type_t type = gib_ast_type( ast, gib );
+      gib_func_quals_take( &type, &gfq );
+      FALLTHROUGH;
+
+    case K_APPLE_BLOCK:
+    case K_ARRAY:
+      is_trailing_ret = ast->parent.of_ast != NULL && gib_is_trailing_ret( ast );
+      if ( gfq.msc_call_atids != TA_NONE &&
+           !c_ast_parent_is_kind_any( ast, K_POINTER ) ) {
+        //
+        // If ast is a function having a Microsoft calling convention, but not
+        // a pointer to such a function, print the calling convention.
+        // (Pointers to such functions are handled in
+        // c_ast_postfix_gibberish().)
+        //
+        strbuf_printf(
+          gib->sbuf, " %s", c_tid_gibberish( gfq.msc_call_atids )
+        );
+      }
+
+      if ( false_set( &gib->is_postfix ) ) {
+        if ( (gib->gib_flags & (C_GIB_PRINT_CAST | C_GIB_USING)) == 0 )
+          gib_print_space_once( gib );
+        c_ast_postfix_gibberish( ast, gib );
+      }
+
+      strbuf_putsp_s( gib->sbuf, c_tid_gibberish( gfq.cv_qual_stids ) );
+
+      if ( gfq.ref_qual_stids != TS_NONE ) {
+        strbuf_printf( gib->sbuf, " %s",
+          other_token_c(
+            c_tid_is_any( gfq.ref_qual_stids, TS_REFERENCE ) ? "&" : "&&"
+          )
+        );
+      }
+
+      if ( gfq.is_noexcept )
+        strbuf_puts( gib->sbuf, " noexcept" );
+      else if ( gfq.is_throw )
+        strbuf_puts( gib->sbuf, " throw()" );
+      if ( gfq.is_override )
+        strbuf_puts( gib->sbuf, " override" );
+      else if ( gfq.is_final )
+        strbuf_puts( gib->sbuf, " final" );
+
+      if ( is_trailing_ret ) {
+        strbuf_puts( gib->sbuf, " -> " );
+        //
+        // Temporarily orphan the return type's AST in order to print it as a
+        // stand-alone trailing type.
+        //
+        c_ast_t *const ret_ast = ast->func.ret_ast;
+        c_ast_t *const orig_ret_ast_parent_ast = ret_ast->parent_ast;
+        ret_ast->parent_ast = NULL;
+
+        gib_state_t child_gib;
+        gib_init( &child_gib, C_GIB_PRINT_DECL, gib->sbuf );
+        c_ast_gibberish_impl( ret_ast, &child_gib );
+        ret_ast->parent_ast = orig_ret_ast_parent_ast;
+      }
+
+      if ( gfq.is_pure_virtual )
+        strbuf_puts( gib->sbuf, " = 0" );
+      else if ( gfq.is_default )
+        strbuf_puts( gib->sbuf, " = default" );
+      else if ( gfq.is_delete )
+        strbuf_puts( gib->sbuf, " = delete" );
+      break;
+
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+      if ( c_ast_space_before_ptr_ref( ast, gib ) )
+        gib_print_space_once( gib );
+      if ( !gib->is_postfix )
+        c_ast_qual_name_gibberish( ast, gib );
+      break;
+
+    case K_POINTER_TO_MEMBER:
+      gib_print_space_once( gib );
+      if ( !gib->is_postfix )
+        c_ast_qual_name_gibberish( ast, gib );
+      break;
+
+    case K_BUILTIN:
+    case K_CAPTURE:
+    case K_CAST:
+    case K_CLASS_STRUCT_UNION:
+    case K_CONCEPT:
+    case K_ENUM:
+    case K_LAMBDA:
+    case K_NAME:
+    case K_STRUCTURED_BINDING:
+    case K_TYPEDEF:
+    case K_VARIADIC:
+      // printed entirely by c_ast_gibberish_down()
       break;
 
     case K_PLACEHOLDER:
@@ -536,13 +736,13 @@ static void c_ast_list_gibberish( c_ast_list_t const *ast_list,
   decl_flags_t const node_gib_flags =
     gib->gib_flags & ~TO_UNSIGNED_EXPR( C_GIB_OPT_OMIT_TYPE );
 
-  FOREACH_SLIST_NODE( ast_node, ast_list ) {
+  FOREACH_AST_LIST( ast_elt, ast_list ) {
     gib_state_t node_gib;
-    gib_init( &node_gib, node_gib_flags, gib->fout );
+    gib_init( &node_gib, node_gib_flags, gib->sbuf );
     node_gib.is_nested_scope = gib->is_nested_scope;
-    c_ast_gibberish_impl( ast_node->data, &node_gib );
-    if ( ast_node->next != NULL )
-      FPUTS( ", ", gib->fout );
+    c_ast_gibberish_impl( *ast_elt, &node_gib );
+    if ( ast_elt[1] != NULL )
+      strbuf_puts( gib->sbuf, ", " );
   } // for
 }
 
@@ -559,13 +759,12 @@ static void c_ast_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   assert( ast != NULL );
   assert( gib != NULL );
 
-  FPUTS(
+  strbuf_puts( gib->sbuf,
     //
     // If we're in a nested scope, just print the local name.
     //
     gib->is_nested_scope ?
-      c_sname_local_name( &ast->sname ) : c_sname_gibberish( &ast->sname ),
-    gib->fout
+      c_sname_local_name( &ast->sname ) : c_sname_gibberish( &ast->sname )
   );
 }
 
@@ -584,9 +783,31 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   assert( ast != NULL );
   assert( gib != NULL );
 
-  c_ast_t const *const parent_ast = ast->parent_ast;
+  //
+  // Ascend from ast printing the "prefix" things (parentheses and names for
+  // pointers and references) in leaf-to-root order until either the root of
+  // the AST is reached or there's no more need to ascend.
+  //
+  c_ast_t const *top_ast = ast;
+  for ( c_ast_t const *parent_ast; top_ast != NULL; top_ast = parent_ast ) {
+    parent_ast = top_ast->parent_ast;
+
+    if ( parent_ast == NULL ) {
+      //
+      // We've reached the root of the AST that has the name of the thing
+      // we're printing the gibberish for.
+      //
+      if ( top_ast->kind == K_APPLE_BLOCK ) {
+        strbuf_printf( gib->sbuf, "(%s", c_op_token_c( C_OP_CARET ) );
+        if ( opt_alt_tokens && !c_sname_empty( &top_ast->sname ) )
+          strbuf_putc( gib->sbuf, ' ' );
+      }
+      c_ast_space_name_gibberish( top_ast, gib );
+      if ( top_ast->kind == K_APPLE_BLOCK )
+        strbuf_putc( gib->sbuf, ')' );
+      break;
+    }
 
-  if ( parent_ast != NULL ) {
     switch ( parent_ast->kind ) {
       case K_ARRAY:
       case K_APPLE_BLOCK:
@@ -597,16 +818,15 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       case K_OPERATOR:
       case K_USER_DEFINED_CONV:
       case K_USER_DEFINED_LIT:
-        c_ast_postfix_gibberish( parent_ast, gib );
-        break;
+        continue;
 
       case K_POINTER:
       case K_POINTER_TO_MEMBER:
       case K_REFERENCE:
       case K_RVALUE_REFERENCE:
-        switch ( ast->kind ) {
+        switch ( top_ast->kind ) {
           case K_APPLE_BLOCK:
-            FPRINTF( gib->fout, "(%s", c_op_token_c( C_OP_CARET ) );
+            strbuf_printf( gib->sbuf, "(%s", c_op_token_c( C_OP_CARET ) );
             break;
 
           default:
@@ -619,17 +839,20 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
             //
             // so we need to add parentheses.
             //
-            FPUTC( '(', gib->fout );
+            strbuf_putc( gib->sbuf, '(' );
 
-            if ( c_tid_is_any( ast->type.atids, TA_ANY_MSC_CALL ) ) {
+            if ( c_tid_is_any( top_ast->type.atids, TA_ANY_MSC_CALL ) ) {
               //
               // A pointer to a function having a Microsoft calling convention
               // has the convention printed just inside the '(':
               //
               //      void (__stdcall *pf)(int, int)
               //
-              c_tid_t const msc_call_atids = ast->type.atids & TA_ANY_MSC_CALL;
-              FPRINTF( gib->fout, "%s ", c_tid_gibberish( msc_call_atids ) );
+              c_tid_t const msc_call_atids =
+                top_ast->type.atids & TA_ANY_MSC_CALL;
+              strbuf_printf(
+                gib->sbuf, "%s ", c_tid_gibberish( msc_call_atids )
+              );
             }
             break;
 
@@ -648,10 +871,7 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
 
         c_ast_qual_name_gibberish( parent_ast, gib );
         if ( c_ast_is_parent( parent_ast->parent_ast ) )
-          c_ast_postfix_gibberish( parent_ast, gib );
-
-        if ( (ast->kind & K_ANY_POINTER) == 0 )
-          FPUTC( ')', gib->fout );
+          continue;
         break;
 
       case K_CLASS_STRUCT_UNION:
@@ -672,60 +892,68 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       case K_PLACEHOLDER:
         unreachable();
     } // switch
-  } else {
-    //
-    // We've reached the root of the AST that has the name of the thing we're
-    // printing the gibberish for.
-    //
-    if ( ast->kind == K_APPLE_BLOCK ) {
-      FPRINTF( gib->fout, "(%s", c_op_token_c( C_OP_CARET ) );
-      if ( opt_alt_tokens && !c_sname_empty( &ast->sname ) )
-        FPUTC( ' ', gib->fout );
-    }
-    c_ast_space_name_gibberish( ast, gib );
-    if ( ast->kind == K_APPLE_BLOCK )
-      FPUTC( ')', gib->fout );
-  }
+
+    break;
+  } // for
 
   //
-  // We're now unwinding the recursion: print the "postfix" things (size for
-  // arrays, parameters for functions) in root-to-leaf order.
+  // Now descend from where we stopped back down to ast printing the "postfix"
+  // things (size for arrays, parameters for functions) in root-to-leaf order.
   //
-  switch ( ast->kind ) {
-    case K_ARRAY:
-      c_ast_array_size_gibberish( ast, gib );
-      break;
-    case K_APPLE_BLOCK:
-    case K_CONSTRUCTOR:
-    case K_DESTRUCTOR:
-    case K_FUNCTION:
-    case K_OPERATOR:
-    case K_USER_DEFINED_CONV:
-    case K_USER_DEFINED_LIT:
-      FPUTC( '(', gib->fout );
-      c_ast_list_gibberish( &ast->func.param_ast_list, gib );
-      FPUTC( ')', gib->fout );
-      break;
-    case K_BUILTIN:
-    case K_CAPTURE:
-    case K_CAST:
-    case K_CLASS_STRUCT_UNION:
-    case K_CONCEPT:
-    case K_ENUM:
-    case K_LAMBDA:                      // handled in c_ast_gibberish_impl()
-    case K_NAME:
-    case K_POINTER:
-    case K_POINTER_TO_MEMBER:
-    case K_REFERENCE:
-    case K_RVALUE_REFERENCE:
-    case K_STRUCTURED_BINDING:
-    case K_TYPEDEF:
-    case K_VARIADIC:
-      // nothing to do
+  for ( c_ast_t const *postfix_ast = top_ast;; ) {
+    c_ast_t const *const parent_ast = postfix_ast->parent_ast;
+    if ( parent_ast != NULL &&
+         (parent_ast->kind & K_ANY_POINTER_OR_REFERENCE) != 0 &&
+         (postfix_ast->kind & K_ANY_POINTER) == 0 ) {
+      strbuf_putc( gib->sbuf, ')' );
+    }
+
+    switch ( postfix_ast->kind ) {
+      case K_ARRAY:
+        c_ast_array_size_gibberish( postfix_ast, gib );
+        break;
+      case K_APPLE_BLOCK:
+      case K_CONSTRUCTOR:
+      case K_DESTRUCTOR:
+      case K_FUNCTION:
+      case K_OPERATOR:
+      case K_USER_DEFINED_CONV:
+      case K_USER_DEFINED_LIT:
+        strbuf_putc( gib->sbuf, '(' );
+        c_ast_list_gibberish( &postfix_ast->func.param_ast_list, gib );
+        strbuf_putc( gib->sbuf, ')' );
+        break;
+      case K_BUILTIN:
+      case K_CAPTURE:
+      case K_CAST:
+      case K_CLASS_STRUCT_UNION:
+      case K_CONCEPT:
+      case K_ENUM:
+      case K_LAMBDA:                    // handled in c_ast_gibberish_down()
+      case K_NAME:
+      case K_POINTER:
+      case K_POINTER_TO_MEMBER:
+      case K_REFERENCE:
+      case K_RVALUE_REFERENCE:
+      case K_STRUCTURED_BINDING:
+      case K_TYPEDEF:
+      case K_VARIADIC:
+        // nothing to do
+        break;
+      case K_PLACEHOLDER:
+        unreachable();
+    } // switch
+
+    if ( postfix_ast == ast )
       break;
-    case K_PLACEHOLDER:
-      unreachable();
-  } // switch
+    //
+    // Since we ascended from ast via parent_ast, every AST from top_ast down
+    // to ast is the of_ast of the one above it.
+    //
+    c_ast_t const *const child_ast = postfix_ast->parent.of_ast;
+    assert( child_ast != NULL && child_ast->parent_ast == postfix_ast );
+    postfix_ast = child_ast;
+  } // for
 }
 
 /**
@@ -743,7 +971,7 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   assert( gib != NULL );
 
   bool defer_space = false;
-  bool const is_west_decl_kind = c_ast_is_west_decl_kind( ast );
+  bool const is_west_decl_kind = c_ast_is_west_decl_kind( ast, gib );
   c_tid_t const qual_stids = ast->type.stids & TS_ANY_QUALIFIER;
 
   switch ( ast->kind ) {
@@ -751,7 +979,7 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       if ( ((gib->gib_flags & C_GIB_PRINT_CAST) == 0 &&
             qual_stids != TS_NONE &&
             !c_ast_is_ptr_to_kind_any( ast, K_FUNCTION )) ||
-           ast->is_param_pack ) {
+           c_ast_is_param_pack( ast ) ) {
         //
         // 1. If we're not printing a cast and there's a qualifier for the
         //    pointer, print a space before it.  For example:
@@ -780,16 +1008,16 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
         else
           gib_print_space_once( gib );
       }
-      FPUTC( '*', gib->fout );
+      strbuf_putc( gib->sbuf, '*' );
       if ( defer_space )
         gib_print_space_once( gib );
       break;
 
     case K_POINTER_TO_MEMBER:
-      FPRINTF( gib->fout,
+      strbuf_printf( gib->sbuf,
         "%s::*", c_sname_gibberish( &ast->ptr_mbr.class_sname )
       );
-      c_ast_t const *const func_ast = c_ast_find_parent_func( ast );
+      c_ast_t const *const func_ast = c_ast_find_parent_func( ast, gib );
       gib->printed_space =
         func_ast == NULL || (func_ast->kind & opt_west_decl_kinds) == 0;
       break;
@@ -797,20 +1025,20 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_REFERENCE:
       if ( opt_alt_tokens ) {
         gib_print_space_once( gib );
-        FPUTS( "bitand ", gib->fout );
+        strbuf_puts( gib->sbuf, "bitand " );
       } else {
-        if ( ast->is_param_pack )
+        if ( c_ast_is_param_pack( ast ) )
           gib_print_space_once( gib );
-        FPUTC( '&', gib->fout );
+        strbuf_putc( gib->sbuf, '&' );
       }
       break;
 
     case K_RVALUE_REFERENCE:
       if ( opt_alt_tokens ) {
         gib_print_space_once( gib );
-        FPUTS( "and ", gib->fout );
+        strbuf_puts( gib->sbuf, "and " );
       } else {
-        FPUTS( "&&", gib->fout );
+        strbuf_puts( gib->sbuf, "&&" );
       }
       break;
 
@@ -819,7 +1047,7 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   } // switch
 
   if ( qual_stids != TS_NONE ) {
-    FPUTS( c_tid_gibberish( qual_stids ), gib->fout );
+    strbuf_puts( gib->sbuf, c_tid_gibberish( qual_stids ) );
 
     if ( (gib->gib_flags & (C_GIB_PRINT_DECL | C_GIB_TYPEDEF)) != 0 ) {
       //
@@ -833,15 +1061,15 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       // However, similar to the above case, if the AST is one of
       // opt_west_decl_kinds, defer printing the space:
       //
-      if ( is_west_decl_kind && !ast->is_param_pack ) {
+      if ( is_west_decl_kind && !c_ast_is_param_pack( ast ) ) {
         defer_space = true;
       }
-      else if ( c_ast_find_name( ast, C_VISIT_UP ) != NULL ) {
+      else if ( c_ast_has_name_up( ast, gib ) ) {
         //
         // Don't use gib_print_space_once(): we must always print a space
         // between the qualifier and the name.
         //
-        FPUTC( ' ', gib->fout );
+        strbuf_putc( gib->sbuf, ' ' );
         gib->printed_space = true;
       }
     }
@@ -904,14 +1132,14 @@ static bool c_ast_space_before_ptr_ref( c_ast_t const *ast,
   if ( (gib->gib_flags & C_GIB_OPT_MULTI_DECL) != 0 )
     return true;
 
-  c_ast_t const *const func_ast = c_ast_find_parent_func( ast );
+  c_ast_t const *const func_ast = c_ast_find_parent_func( ast, gib );
   if ( func_ast != NULL )               // function returning pointer to ...
     return (func_ast->kind & opt_west_decl_kinds) == 0;
 
-  if ( c_ast_find_name( ast, C_VISIT_UP ) == NULL )
+  if ( !c_ast_has_name_up( ast, gib ) )
     return false;
 
-  if ( c_ast_is_west_decl_kind( ast ) )
+  if ( c_ast_is_west_decl_kind( ast, gib ) )
     return false;
 
   return true;
@@ -949,10 +1177,10 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_TYPEDEF:
       if ( (gib->gib_flags & C_GIB_USING) != 0 )
         break;
-      if ( !c_sname_empty( &ast->sname ) || ast->is_param_pack )
+      if ( !c_sname_empty( &ast->sname ) || c_ast_is_param_pack( ast ) )
         gib_print_space_once( gib );
-      if ( ast->is_param_pack )
-        FPUTS( L_ELLIPSIS, gib->fout );
+      if ( c_ast_is_param_pack( ast ) )
+        strbuf_puts( gib->sbuf, L_ELLIPSIS );
       if ( !c_sname_empty( &ast->sname ) )
         c_ast_name_gibberish( ast, gib );
       break;
@@ -965,25 +1193,27 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       break;
 
     case K_CONSTRUCTOR:
-      FPUTS( c_sname_gibberish( &ast->sname ), gib->fout );
+      strbuf_puts( gib->sbuf, c_sname_gibberish( &ast->sname ) );
       break;
 
     case K_DESTRUCTOR:
       if ( c_sname_count( &ast->sname ) > 1 )
-        FPRINTF( gib->fout, "%s::", c_sname_scope_gibberish( &ast->sname ) );
+        strbuf_printf(
+          gib->sbuf, "%s::", c_sname_scope_gibberish( &ast->sname )
+        );
       if ( opt_alt_tokens )
-        FPUTS( "compl ", gib->fout );
+        strbuf_puts( gib->sbuf, "compl " );
       else
-        FPUTC( '~', gib->fout );
-      FPUTS( c_sname_local_name( &ast->sname ), gib->fout );
+        strbuf_putc( gib->sbuf, '~' );
+      strbuf_puts( gib->sbuf, c_sname_local_name( &ast->sname ) );
       break;
 
     case K_OPERATOR:
       gib_print_space_once( gib );
       if ( !c_sname_empty( &ast->sname ) )
-        FPRINTF( gib->fout, "%s::", c_sname_gibberish( &ast->sname ) );
+        strbuf_printf( gib->sbuf, "%s::", c_sname_gibberish( &ast->sname ) );
       char const *const token = c_op_token_c( ast->oper.operator->op_id );
-      FPRINTF( gib->fout,
+      strbuf_printf( gib->sbuf,
         "operator%s%s", isalpha( token[0] ) ? " " : "", token
       );
       break;
@@ -991,8 +1221,10 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_USER_DEFINED_LIT:
       gib_print_space_once( gib );
       if ( c_sname_count( &ast->sname ) > 1 )
-        FPRINTF( gib->fout, "%s::", c_sname_scope_gibberish( &ast->sname ) );
-      FPRINTF( gib->fout,
+        strbuf_printf(
+          gib->sbuf, "%s::", c_sname_scope_gibberish( &ast->sname )
+        );
+      strbuf_printf( gib->sbuf,
         "operator\"\" %s", c_sname_local_name( &ast->sname )
       );
       break;
@@ -1021,9 +1253,9 @@ static void c_builtin_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
   assert( gib != NULL );
 
   if ( (gib->gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 ) {
-    FPUTS( c_type_gibberish( type ), gib->fout );
+    strbuf_puts( gib->sbuf, c_type_gibberish( type ) );
     if ( c_ast_is_tid_any( ast, TB__BitInt ) )
-      FPRINTF( gib->fout, "(%u)", ast->builtin.BitInt.width );
+      strbuf_printf( gib->sbuf, "(%u)", ast->builtin.BitInt.width );
   }
   c_ast_space_name_gibberish( ast, gib );
   c_ast_bit_width_gibberish( ast, gib );
@@ -1042,23 +1274,23 @@ static void c_capture_ast_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
 
   switch ( ast->capture.kind ) {
     case C_CAPTURE_COPY:
-      FPUTC( '=', gib->fout );
+      strbuf_putc( gib->sbuf, '=' );
       break;
     case C_CAPTURE_REFERENCE:
-      FPUTS( other_token_c( "&" ), gib->fout );
+      strbuf_puts( gib->sbuf, other_token_c( "&" ) );
       if ( c_sname_empty( &ast->sname ) )
         break;
       if ( opt_alt_tokens )
-        FPUTC( ' ', gib->fout );
+        strbuf_putc( gib->sbuf, ' ' );
       FALLTHROUGH;
     case C_CAPTURE_VARIABLE:
-      FPUTS( c_sname_local_name( &ast->sname ), gib->fout );
+      strbuf_puts( gib->sbuf, c_sname_local_name( &ast->sname ) );
       break;
     case C_CAPTURE_STAR_THIS:
-      FPUTC( '*', gib->fout );
+      strbuf_putc( gib->sbuf, '*' );
       FALLTHROUGH;
     case C_CAPTURE_THIS:
-      FPUTS( L_this, gib->fout );
+      strbuf_puts( gib->sbuf, L_this );
       break;
   } // switch
 }
@@ -1076,16 +1308,16 @@ static void c_cast_ast_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   assert( gib->gib_flags == C_GIB_PRINT_CAST );
 
   gib_state_t child_gib;
-  gib_init( &child_gib, C_GIB_PRINT_CAST, gib->fout );
+  gib_init( &child_gib, C_GIB_PRINT_CAST, gib->sbuf );
 
   if ( ast->cast.kind == C_CAST_C ) {
-    FPUTC( '(', gib->fout );
+    strbuf_putc( gib->sbuf, '(' );
     c_ast_gibberish_impl( ast->cast.to_ast, &child_gib );
-    FPRINTF( gib->fout, ")%s\n", c_sname_gibberish( &ast->sname ) );
+    strbuf_printf( gib->sbuf, ")%s\n", c_sname_gibberish( &ast->sname ) );
   } else {
-    FPRINTF( gib->fout, "%s<", c_cast_gibberish( ast->cast.kind ) );
+    strbuf_printf( gib->sbuf, "%s<", c_cast_gibberish( ast->cast.kind ) );
     c_ast_gibberish_impl( ast->cast.to_ast, &child_gib );
-    FPRINTF( gib->fout, ">(%s)\n", c_sname_gibberish( &ast->sname ) );
+    strbuf_printf( gib->sbuf, ">(%s)\n", c_sname_gibberish( &ast->sname ) );
   }
 }
 
@@ -1110,12 +1342,12 @@ static void c_concept_ast_gibberish( c_ast_t const *ast, c_type_t *type,
     type->stids &= c_tid_compl( TS_CONCEPT );
   }
 
-  fputs_sp( c_type_gibberish( type ), gib->fout );
-  FPRINTF( gib->fout,
+  strbuf_puts_sp( gib->sbuf, c_type_gibberish( type ) );
+  strbuf_printf( gib->sbuf,
     "%s %s",
     c_sname_gibberish( &ast->concept.concept_sname ), L_auto
   );
-  fputsp_s( c_tid_gibberish( cv_qual_stids ), gib->fout );
+  strbuf_putsp_s( gib->sbuf, c_tid_gibberish( cv_qual_stids ) );
   c_ast_space_name_gibberish( ast, gib );
 }
 
@@ -1150,7 +1382,7 @@ static void c_ecsu_ast_gibberish( c_ast_t const *ast, c_type_t *type,
     //
     !is_fixed_enum ? c_type_name_ecsu( type ) : c_type_gibberish( type );
 
-  FPUTS( type_name, gib->fout );
+  strbuf_puts( gib->sbuf, type_name );
 
   if ( (gib->gib_flags & C_GIB_TYPEDEF) == 0 || gib->printed_typedef ) {
     //
@@ -1169,7 +1401,7 @@ static void c_ecsu_ast_gibberish( c_ast_t const *ast, c_type_t *type,
     //
     //          typedef struct S T; // ast->sname ="T"; escu_name = "S"
     //
-    FPRINTF( gib->fout,
+    strbuf_printf( gib->sbuf,
       "%s%s",
       type_name[0] != '\0' ? " " : "",
       c_sname_gibberish( &ast->csu.csu_sname )
@@ -1196,11 +1428,11 @@ static void c_ecsu_ast_gibberish( c_ast_t const *ast, c_type_t *type,
       c_ast_space_name_gibberish( ast, gib );
       printed_name = true;
     }
-    FPUTS( " : ", gib->fout );
+    strbuf_puts( gib->sbuf, " : " );
     c_ast_gibberish_impl( ast->enum_.of_ast, gib );
   }
 
-  fputsp_s( c_tid_gibberish( cv_qual_stids ), gib->fout );
+  strbuf_putsp_s( gib->sbuf, c_tid_gibberish( cv_qual_stids ) );
 
   if ( !printed_name )
     c_ast_space_name_gibberish( ast, gib );
@@ -1223,22 +1455,22 @@ static void c_lambda_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
   assert( type != NULL );
   assert( gib != NULL );
 
-  FPUTS( other_token_c( "[" ), gib->fout );
+  strbuf_puts( gib->sbuf, other_token_c( "[" ) );
   c_ast_list_gibberish( &ast->lambda.capture_ast_list, gib );
-  FPUTS( other_token_c( "]" ), gib->fout );
+  strbuf_puts( gib->sbuf, other_token_c( "]" ) );
 
-  if ( !slist_empty( &ast->lambda.param_ast_list ) ) {
-    FPUTC( '(', gib->fout );
+  if ( !c_ast_list_empty( &ast->lambda.param_ast_list ) ) {
+    strbuf_putc( gib->sbuf, '(' );
     c_ast_list_gibberish( &ast->lambda.param_ast_list, gib );
-    FPUTC( ')', gib->fout );
+    strbuf_putc( gib->sbuf, ')' );
   }
 
-  fputsp_s( c_tid_gibberish( type->stids ), gib->fout );
-  fputsp_s( c_tid_gibberish( type->atids ), gib->fout );
+  strbuf_putsp_s( gib->sbuf, c_tid_gibberish( type->stids ) );
+  strbuf_putsp_s( gib->sbuf, c_tid_gibberish( type->atids ) );
 
   if ( ast->lambda.ret_ast != NULL &&
         !c_ast_is_builtin_any( ast->lambda.ret_ast, TB_auto | TB_void ) ) {
-    FPUTS( " -> ", gib->fout );
+    strbuf_puts( gib->sbuf, " -> " );
     c_ast_gibberish_impl( ast->lambda.ret_ast, gib );
   }
 }
@@ -1265,18 +1497,18 @@ static void c_name_ast_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       //      cdecl> declare f as function (x) returning char
       //      char f(int x)
       //
-      FPUTS( L_int, gib->fout );
+      strbuf_puts( gib->sbuf, L_int );
       printed_type = true;
     }
     else if ( ast->parent_ast == NULL ) {
-      FPUTS( c_sname_gibberish( &ast->name.sname ), gib->fout );
+      strbuf_puts( gib->sbuf, c_sname_gibberish( &ast->name.sname ) );
       printed_type = true;
     }
   }
 
   if ( (gib->gib_flags & C_GIB_PRINT_CAST) == 0 ) {
     if ( printed_type )
-      FPUTC( ' ', gib->fout );
+      strbuf_putc( gib->sbuf, ' ' );
     c_ast_name_gibberish( ast, gib );
   }
 }
@@ -1314,46 +1546,6 @@ static char const* c_sname_name_impl( strbuf_t *sbuf, c_sname_t const *sname,
   return empty_if_null( sbuf->str );
 }
 
-/**
- * Prints a #K_POINTER_TO_MEMBER AST as a C++ declaration.
- *
- * @param ast The AST to print.
- * @param gib The gib_state to use.
- */
-static void c_ptr_mbr_ast_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
-  assert( ast != NULL );
-  assert( ast->kind == K_POINTER_TO_MEMBER );
-  assert( gib != NULL );
-
-  c_ast_gibberish_impl( ast->ptr_mbr.to_ast, gib );
-  gib_print_space_once( gib );
-  if ( !gib->is_postfix )
-    c_ast_qual_name_gibberish( ast, gib );
-}
-
-/**
- * Prints a #K_POINTER or #K_ANY_REFERENCE AST as a C/C++ declaration.
- *
- * @param ast The AST to print.
- * @param type The \ref c_type to use instead of \ref c_ast::type.
- * @param gib The gib_state to use.
- */
-static void c_ptr_ref_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
-                                     gib_state_t *gib ) {
-  assert( ast != NULL );
-  assert( (ast->kind & (K_POINTER | K_ANY_REFERENCE)) != 0 );
-  assert( type != NULL );
-  assert( gib != NULL );
-
-  if ( (gib->gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 )
-    fputs_sp( c_tid_gibberish( type->stids & TS_ANY_STORAGE ), gib->fout );
-  c_ast_gibberish_impl( ast->ptr_ref.to_ast, gib );
-  if ( c_ast_space_before_ptr_ref( ast, gib ) )
-    gib_print_space_once( gib );
-  if ( !gib->is_postfix )
-    c_ast_qual_name_gibberish( ast, gib );
-}
-
 /**
  * Prints each name in \a sname_list as type \a ast in gibberish for a C++
  * structured binding.
@@ -1381,37 +1573,37 @@ static void c_struct_bind_ast_gibberish( c_ast_t const *ast,
     type.stids &= c_tid_compl( TS_CV );
   }
 
-  fputs_sp( c_type_gibberish( &type ), gib->fout );
+  strbuf_puts_sp( gib->sbuf, c_type_gibberish( &type ) );
   if ( !opt_east_const )
-    fputs_sp( c_tid_gibberish( cv_qual_stids ), gib->fout );
-  FPUTS( L_auto, gib->fout );
-  fputsp_s( c_tid_gibberish( cv_qual_stids ), gib->fout );
+    strbuf_puts_sp( gib->sbuf, c_tid_gibberish( cv_qual_stids ) );
+  strbuf_puts( gib->sbuf, L_auto );
+  strbuf_putsp_s( gib->sbuf, c_tid_gibberish( cv_qual_stids ) );
 
   if ( ref_qual_stid == TS_NONE ) {
-    FPUTC( ' ', gib->fout );
+    strbuf_putc( gib->sbuf, ' ' );
   }
   else if ( opt_alt_tokens ) {
-    FPRINTF( gib->fout,
+    strbuf_printf( gib->sbuf,
       " %s ", ref_qual_stid == TS_REFERENCE ? L_bitand : L_and
     );
   }
   else {
     if ( (opt_west_decl_kinds & K_STRUCTURED_BINDING) == 0 )
-      FPUTC( ' ', gib->fout );
-    FPUTS( ref_qual_stid == TS_REFERENCE ? "&" : "&&", gib->fout );
+      strbuf_putc( gib->sbuf, ' ' );
+    strbuf_puts( gib->sbuf, ref_qual_stid == TS_REFERENCE ? "&" : "&&" );
     if ( (opt_west_decl_kinds & K_STRUCTURED_BINDING) != 0 )
-      FPUTC( ' ', gib->fout );
+      strbuf_putc( gib->sbuf, ' ' );
   }
 
-  FPUTC( '[', gib->fout );
+  strbuf_putc( gib->sbuf, '[' );
 
   FOREACH_SLIST_NODE( sname_node, &ast->struct_bind.sname_list ) {
-    FPUTS( c_sname_local_name( sname_node->data ), gib->fout );
+    strbuf_puts( gib->sbuf, c_sname_local_name( sname_node->data ) );
     if ( sname_node->next != NULL )
-      FPUTS( ", ", gib->fout );
+      strbuf_puts( gib->sbuf, ", " );
   } // for
 
-  FPUTC( ']', gib->fout );
+  strbuf_putc( gib->sbuf, ']' );
 }
 
 /**
@@ -1436,7 +1628,7 @@ static void c_typedef_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
     bool const is_more_than_plain_typedef = type->stids != TS_NONE;
 
     if ( is_more_than_plain_typedef && !opt_east_const )
-      FPUTS( c_type_gibberish( type ), gib->fout );
+      strbuf_puts( gib->sbuf, c_type_gibberish( type ) );
 
     //
     // Special case: C++23 adds an _Atomic(T) macro for compatibility with C11,
@@ -1454,9 +1646,9 @@ static void c_typedef_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
       c_tid_is_any( type->stids, TS__Atomic );
 
     if ( print_parens_for_Atomic )
-      FPUTC( '(', gib->fout );
+      strbuf_putc( gib->sbuf, '(' );
     else if ( is_more_than_plain_typedef && !opt_east_const )
-      FPUTC( ' ', gib->fout );
+      strbuf_putc( gib->sbuf, ' ' );
 
     //
     // Temporarily turn off C_GIB_USING to force printing of the type's name.
@@ -1472,30 +1664,166 @@ static void c_typedef_ast_gibberish( c_ast_t const *ast, c_type_t const *type,
     c_ast_name_gibberish( ast->tdef.for_ast, gib );
     gib->gib_flags = orig_flags;
     if ( print_parens_for_Atomic )
-      FPUTC( ')', gib->fout );
+      strbuf_putc( gib->sbuf, ')' );
     if ( is_more_than_plain_typedef && opt_east_const )
-      FPRINTF( gib->fout, " %s", c_type_gibberish( type ) );
+      strbuf_printf( gib->sbuf, " %s", c_type_gibberish( type ) );
   }
 
   c_ast_space_name_gibberish( ast, gib );
   c_ast_bit_width_gibberish( ast, gib );
 }
 
+/**
+ * Finds the node for \a ast in the chain being printed, if any.
+ *
+ * @remarks Since the ASTs searched for are either the one being printed or
+ * ancestors of it in leaf-to-root order, searching starts at \ref
+ * gib_chain::hint and proceeds towards the root.
+ *
+ * @param gib The gib_state to use.
+ * @param ast The AST to find.
+ * @return Returns said node or NULL if either there is no chain or \a ast
+ * isn't in it.
+ */
+NODISCARD
+static gib_chain_node_t const* gib_chain_find( gib_state_t const *gib,
+                                               c_ast_t const *ast ) {
+  assert( gib != NULL );
+  assert( ast != NULL );
+
+  gib_chain_t *const chain = gib->chain;
+  if ( chain == NULL )
+    return NULL;
+  for ( size_t i = chain->hint + 1; i-- > 0; ) {
+    if ( chain->nodes[i].ast == ast ) {
+      chain->hint = i;
+      return &chain->nodes[i];
+    }
+  } // for
+  return NULL;
+}
+
+/**
+ * Initializes \a chain.
+ *
+ * @param chain The \ref gib_chain to initialize.
+ * @param leaf_ast The last AST of the chain.
+ * @param len The length of the chain.
+ * @param nodes The array of at least \a len nodes to use.
+ */
+static void gib_chain_init( gib_chain_t *chain, c_ast_t const *leaf_ast,
+                            size_t len, gib_chain_node_t *nodes ) {
+  assert( chain != NULL );
+  assert( leaf_ast != NULL );
+  assert( len > 0 );
+  assert( nodes != NULL );
+
+  *chain = (gib_chain_t){
+    .nodes = nodes,
+    .hint = len - 1
+  };
+
+  c_ast_t const *ast = leaf_ast;
+  for ( size_t i = len; i-- > 0; ast = ast->parent_ast )
+    chain->nodes[i].ast = ast;
+
+  //
+  // Only the searches from the ends of the chain need actually be done; the
+  // results for the rest follow from those of their neighbors.
+  //
+  gib_chain_node_t *node = chain->nodes;
+  c_ast_t const *const parent_ast = node->ast->parent_ast;
+  node->func_ast = parent_ast == NULL ? NULL :
+    c_ast_find_kind_any( parent_ast, C_VISIT_UP, K_ANY_FUNCTION_LIKE );
+  node->has_name_up = c_ast_find_name( node->ast, C_VISIT_UP ) != NULL;
+  for ( ++node; node < chain->nodes + len; ++node ) {
+    c_ast_t const *const prev_ast = node[-1].ast;
+    node->func_ast = (prev_ast->kind & K_ANY_FUNCTION_LIKE) != 0 ?
+      prev_ast : node[-1].func_ast;
+    node->has_name_up =
+      node[-1].has_name_up || !c_sname_empty( &node->ast->sname );
+  } // for
+
+  node = chain->nodes + len - 1;
+  node->is_west_decl_kind =
+    c_ast_find_kind_any( node->ast, C_VISIT_DOWN, opt_west_decl_kinds ) != NULL;
+  for ( ; node > chain->nodes; --node ) {
+    node[-1].is_west_decl_kind = node->is_west_decl_kind ||
+      (node[-1].ast->kind & opt_west_decl_kinds) != 0;
+  } // for
+}
+
+/**
+ * Takes the parts of \a type of a function-like AST that are printed after
+ * its parameters rather than before its name out of \a type and puts them
+ * into \a gfq.
+ *
+ * @param type The type to take the parts out of.
+ * @param gfq The gib_func_quals to put the parts into.
+ */
+static void gib_func_quals_take( c_type_t *type, gib_func_quals_t *gfq ) {
+  assert( type != NULL );
+  assert( gfq != NULL );
+
+  *gfq = (gib_func_quals_t){
+    .cv_qual_stids    = (type->stids & TS_ANY_QUALIFIER),
+    .is_default       = (type->stids & TS_default) != TS_NONE,
+    .is_delete        = (type->stids & TS_delete) != TS_NONE,
+    .is_final         = (type->stids & TS_final) != TS_NONE,
+    .is_noexcept      = (type->stids & TS_noexcept) != TS_NONE,
+    .is_pure_virtual  = (type->stids & TS_PURE_virtual) != TS_NONE,
+    .is_throw         = (type->stids & TS_throw) != TS_NONE,
+    .ref_qual_stids   = (type->stids & TS_ANY_REFERENCE)
+  };
+
+  // In C++, "override" should be printed only if "final" isn't.
+  gfq->is_override =
+    !gfq->is_final && (type->stids & TS_override) != TS_NONE;
+
+  type->stids &= c_tid_compl(
+                   TS_ANY_QUALIFIER
+                 | TS_ANY_REFERENCE
+                 | TS_default
+                 | TS_delete
+                 | TS_final
+                 | TS_noexcept
+                 | TS_override
+                 | TS_PURE_virtual
+                 | TS_throw
+                 // In C++, if either "override" or "final" is printed,
+                 // "virtual" shouldn't be.
+                 | (gfq->is_override || gfq->is_final ? TS_virtual : TS_NONE)
+               );
+
+  //
+  // Microsoft calling conventions are printed specially.
+  //
+  gfq->msc_call_atids = type->atids & TA_ANY_MSC_CALL;
+  type->atids &= c_tid_compl( TA_ANY_MSC_CALL );
+
+  //
+  // If noexcept is supported, change throw() to noexcept.
+  //
+  if ( OPT_LANG_IS( noexcept ) && true_clear( &gfq->is_throw ) )
+    gfq->is_noexcept = true;
+}
+
 /**
  * Initializes a gib_state.
  *
  * @param gib The gib_state to initialize.
  * @param gib_flags The gibberish flags to use.
- * @param fout The `FILE` to print to.
+ * @param sbuf The \ref strbuf to print to.
  */
-static void gib_init( gib_state_t *gib, decl_flags_t gib_flags, FILE *fout ) {
+static void gib_init( gib_state_t *gib, decl_flags_t gib_flags,
+                      strbuf_t *sbuf ) {
   assert( gib != NULL );
   assert( is_1n_bit_only_in_set( gib_flags, C_GIB_ANY ) );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   *gib = (gib_state_t){
     .gib_flags = gib_flags,
-    .fout = fout,
+    .sbuf = sbuf,
     .printed_space = (gib_flags & C_GIB_OPT_OMIT_TYPE) != 0
   };
 }
@@ -1618,6 +1946,16 @@ static char const* graph_token_c( char const *token ) {
 ////////// extern functions ///////////////////////////////////////////////////
 
 void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_ast_gibberish_sbuf( ast, gib_flags, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_ast_gibberish_sbuf( c_ast_t const *ast, decl_flags_t gib_flags,
+                           strbuf_t *sbuf ) {
   assert( ast != NULL );
   assert( is_1n_bit_only_in_set( gib_flags, C_GIB_ANY ) );
   assert(
@@ -1625,7 +1963,7 @@ void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout ) {
       gib_flags, C_GIB_DECL_ANY | C_GIB_PRINT_DECL | C_GIB_PRINT_CAST
     )
   );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   if ( c_ast_print_as_using( ast ) ) {
     //
@@ -1635,10 +1973,10 @@ void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout ) {
     //      using pint = int*;
     //
     // It's simpler just to create a temporary c_typedef_t and call
-    // c_typedef_gibberish().
+    // c_typedef_gibberish_sbuf().
     //
     c_typedef_t const tdef = C_TYPEDEF_LIT( ast, C_GIB_USING );
-    c_typedef_gibberish( &tdef, C_GIB_USING, fout );
+    c_typedef_gibberish_sbuf( &tdef, C_GIB_USING, sbuf );
   }
   else {
     if ( (gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 ) {
@@ -1651,23 +1989,34 @@ void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout ) {
       //
       // print the alignment (and "int") only for "i" and not again for "j".
       //
-      c_ast_alignas_gibberish( ast, fout );
+      c_ast_alignas_gibberish( ast, sbuf );
     }
 
     gib_state_t gib;
-    gib_init( &gib, gib_flags, fout );
+    gib_init( &gib, gib_flags, sbuf );
     c_ast_gibberish_impl( ast, &gib );
   }
 
   if ( (gib_flags & C_GIB_OPT_SEMICOLON) != 0 )
-    FPUTC( ';', fout );
+    strbuf_putc( sbuf, ';' );
 }
 
 void c_ast_sname_list_gibberish( c_ast_t *ast, slist_t const *sname_list,
                                  FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_ast_sname_list_gibberish_sbuf( ast, sname_list, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_ast_sname_list_gibberish_sbuf( c_ast_t *ast,
+                                      slist_t const *sname_list,
+                                      strbuf_t *sbuf ) {
   assert( ast != NULL );
   assert( sname_list != NULL );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   decl_flags_t decl_flags = C_GIB_PRINT_DECL;
   if ( slist_len( sname_list ) > 1 )
@@ -1692,7 +2041,7 @@ void c_ast_sname_list_gibberish( c_ast_t *ast, slist_t const *sname_list,
     bool const is_last_sname = sname_node->next == NULL;
     if ( is_last_sname && opt_semicolon )
       decl_flags |= C_GIB_OPT_SEMICOLON;
-    c_ast_gibberish( ast, decl_flags, fout );
+    c_ast_gibberish_sbuf( ast, decl_flags, sbuf );
     if ( is_last_sname )
       continue;
     if ( print_as_using ) {
@@ -1701,7 +2050,7 @@ void c_ast_sname_list_gibberish( c_ast_t *ast, slist_t const *sname_list,
       // declarations, they need to be separated by newlines.  (The final
       // newine is handled below.)
       //
-      FPUTC( '\n', fout );
+      strbuf_putc( sbuf, '\n' );
     }
     else {
       //
@@ -1716,7 +2065,7 @@ void c_ast_sname_list_gibberish( c_ast_t *ast, slist_t const *sname_list,
       // the gibberish for `y` must not print the `int` again.
       //
       decl_flags |= C_GIB_OPT_OMIT_TYPE;
-      FPUTS( ", ", fout );
+      strbuf_puts( sbuf, ", " );
     }
   } // for
 }
@@ -1746,12 +2095,22 @@ char const* c_sname_scope_gibberish( c_sname_t const *sname ) {
 
 void c_typedef_gibberish( c_typedef_t const *tdef, decl_flags_t gib_flags,
                           FILE *fout ) {
+  assert( fout != NULL );
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  c_typedef_gibberish_sbuf( tdef, gib_flags, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void c_typedef_gibberish_sbuf( c_typedef_t const *tdef, decl_flags_t gib_flags,
+                               strbuf_t *sbuf ) {
   assert( tdef != NULL );
   assert( is_1_bit_in_set( gib_flags, C_GIB_DECL_ANY ) );
   assert(
     is_1n_bit_only_in_set( gib_flags, C_GIB_DECL_ANY | C_GIB_OPT_SEMICOLON )
   );
-  assert( fout != NULL );
+  assert( sbuf != NULL );
 
   size_t scope_close_braces_to_print = 0;
   c_type_t scope_type = T_NONE;
@@ -1830,7 +2189,7 @@ void c_typedef_gibberish( c_typedef_t const *tdef, decl_flags_t gib_flags,
         scope_type.stids &= c_tid_compl( TS_inline );
       }
 
-      FPRINTF( fout,
+      strbuf_printf( sbuf,
         "%s %s %s ",
         c_type_gibberish( &scope_type ), c_sname_scope_gibberish( sname ),
         other_token_c( "{" )
@@ -1845,7 +2204,7 @@ void c_typedef_gibberish( c_typedef_t const *tdef, decl_flags_t gib_flags,
       //
       FOREACH_SNAME_SCOPE_UNTIL( scope, sname, sname->tail ) {
         scope_type = c_scope_data( scope )->type;
-        FPRINTF( fout,
+        strbuf_printf( sbuf,
           "%s %s %s ",
           c_type_gibberish( &scope_type ), c_scope_data( scope )->name,
           other_token_c( "{" )
@@ -1889,32 +2248,32 @@ void c_typedef_gibberish( c_typedef_t const *tdef, decl_flags_t gib_flags,
   bool const print_using = (gib_flags & C_GIB_USING) != 0 && !is_ecsu;
 
   if ( print_typedef ) {
-    FPUTS( "typedef ", fout );
+    strbuf_puts( sbuf, "typedef " );
   }
   else if ( print_using ) {
-    FPRINTF( fout, "using %s ", c_sname_local_name( sname ) );
+    strbuf_printf( sbuf, "using %s ", c_sname_local_name( sname ) );
     if ( tdef->ast->type.atids != TA_NONE )
-      FPRINTF( fout, "%s ", c_tid_gibberish( tdef->ast->type.atids ) );
-    FPUTS( "= ", fout );
+      strbuf_printf( sbuf, "%s ", c_tid_gibberish( tdef->ast->type.atids ) );
+    strbuf_puts( sbuf, "= " );
   }
 
   c_sname_cleanup( &temp_sname );
 
   gib_state_t gib;
-  gib_init( &gib, print_using ? C_GIB_USING : C_GIB_TYPEDEF, fout );
+  gib_init( &gib, print_using ? C_GIB_USING : C_GIB_TYPEDEF, sbuf );
   gib.printed_typedef = print_typedef;
   gib.is_nested_scope = scope_close_braces_to_print > 0;
   c_ast_gibberish_impl( tdef->ast, &gib );
 
   if ( scope_close_braces_to_print > 0 ) {
-    FPUTC( ';', fout );
+    strbuf_putc( sbuf, ';' );
     while ( scope_close_braces_to_print-- > 0 )
-      FPRINTF( fout, " %s", other_token_c( "}" ) );
+      strbuf_printf( sbuf, " %s", other_token_c( "}" ) );
   }
 
   if ( (gib_flags & C_GIB_OPT_SEMICOLON) != 0 &&
        scope_type.btids != TB_namespace ) {
-    FPUTC( ';', fout );
+    strbuf_putc( sbuf, ';' );
   }
 }
 
@@ -29,6 +29,7 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "slist.h"
+#include "strbuf.h"
 #include "types.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -55,6 +56,7 @@
  * @param fout The `FILE` to print to.
  *
  * @sa c_ast_english()
+ * @sa c_ast_gibberish_sbuf()
  * @sa c_ast_sname_list_gibberish()
  * @sa c_typedef_gibberish()
  * @sa print_ast_type_aka()
@@ -63,6 +65,21 @@
  */
 void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout );
 
+/**
+ * Prints \a ast as gibberish, aka, a C/C++ declaration or cast, into \a
+ * sbuf.
+ *
+ * @param ast The AST to print.
+ * @param gib_flags The gibberish flags to use; _must_ include one of
+ * #C_GIB_PRINT_CAST, #C_GIB_PRINT_DECL, or #C_GIB_USING.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa c_ast_english_sbuf()
+ * @sa c_ast_gibberish()
+ */
+void c_ast_gibberish_sbuf( c_ast_t const *ast, decl_flags_t gib_flags,
+                           strbuf_t *sbuf );
+
 /**
  * Prints the names in \a sname_list as gibberish, aka, C/C++ declarations.
  * For example, if \a sname_list is [ `"x"`, `"y"` ] and \a ast is:
@@ -91,10 +108,25 @@ void c_ast_gibberish( c_ast_t const *ast, decl_flags_t gib_flags, FILE *fout );
  * @param fout The `FILE` to print to.
  *
  * @sa c_ast_gibberish()
+ * @sa c_ast_sname_list_gibberish_sbuf()
  */
 void c_ast_sname_list_gibberish( c_ast_t *ast, slist_t const *sname_list,
                                  FILE *fout );
 
+/**
+ * Prints the names in \a sname_list as gibberish, aka, C/C++ declarations,
+ * into \a sbuf.
+ *
+ * @param ast The AST that is the type to print.
+ * @param sname_list The names to print as \a ast.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa c_ast_sname_list_gibberish()
+ */
+void c_ast_sname_list_gibberish_sbuf( c_ast_t *ast,
+                                      slist_t const *sname_list,
+                                      strbuf_t *sbuf );
+
 /**
  * Given \a kind, gets the associated C++ literal.
  *
@@ -156,12 +188,27 @@ char const* c_sname_scope_gibberish( c_sname_t const *sname );
  *
  * @sa c_ast_gibberish()
  * @sa c_typedef_english()
+ * @sa c_typedef_gibberish_sbuf()
  * @sa print_type_decl()
  * @sa show_type()
  */
 void c_typedef_gibberish( c_typedef_t const *tdef, decl_flags_t gib_flags,
                           FILE *fout );
 
+/**
+ * Prints \a tdef as a C/C++ type declaration into \a sbuf.
+ *
+ * @param tdef The type to print.
+ * @param gib_flags The gibberish flags to use; _must_ include either
+ * #C_GIB_TYPEDEF or #C_GIB_USING.
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa c_typedef_english_sbuf()
+ * @sa c_typedef_gibberish()
+ */
+void c_typedef_gibberish_sbuf( c_typedef_t const *tdef, decl_flags_t gib_flags,
+                               strbuf_t *sbuf );
+
 /**
  * Gets either the altertative or "graph" token, if any, of \a token.
  *
@@ -376,6 +376,7 @@ static void print_help_command( cdecl_command_t const *command ) {
       print_h( "|using" );
     print_h( "}]\n" );
     print_h( "  show {<name>|[all] [predefined|user] macros}\n" );
+    print_h( "  show cache\n" );
   }
 
   if ( command_is( command, L_typedef ) )
@@ -693,6 +694,7 @@ static void print_help_set_options( void ) {
   print_h( "  [no]%s\n", L_OPT_flex_debug );
 #endif /* ENABLE_FLEX_DEBUG */
   print_h( "  {di|tri|no}graphs\n" );
+  print_h( "  [no]%s\n", L_OPT_include_once );
   print_h( "  [no]%s\n", L_OPT_infer_command );
   print_h( "  %s=<lang>\n", L_OPT_language );
   print_h( "  <lang>\n" );
@@ -0,0 +1,239 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/intern.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for interning strings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "intern.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <string.h>
+
+/// @endcond
+
+/**
+ * @addtogroup intern-group
+ * @{
+ */
+
+/**
+ * The minimum capacity of \ref intern_set; must be a power of 2.
+ */
+#define INTERN_SET_CAP_MIN        1024u
+
+/**
+ * The size of a \ref intern_chunk.
+ */
+#define INTERN_CHUNK_SIZE         8192u
+
+/**
+ * A chunk of memory that interned strings are stored in.
+ */
+struct intern_chunk {
+  struct intern_chunk  *prev;           ///< Previous chunk, if any.
+  char                  buf[];          ///< Interned strings.
+};
+typedef struct intern_chunk intern_chunk_t;
+
+/**
+ * An entry in \ref intern_set.
+ */
+struct intern_entry {
+  size_t      hash;                     ///< Hash code of \ref s.
+  char const *s;                        ///< The interned string, if any.
+};
+typedef struct intern_entry intern_entry_t;
+
+////////// local variables ////////////////////////////////////////////////////
+
+static intern_chunk_t  *intern_chunk;   ///< Current chunk, if any.
+static size_t           intern_chunk_len; ///< Bytes used in \ref intern_chunk.
+static intern_entry_t  *intern_set;     ///< Hash set of interned strings.
+static size_t           intern_set_cap; ///< Capacity of \ref intern_set.
+static size_t           intern_set_len; ///< Entries used in \ref intern_set.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Allocates memory for a string of \a s_len characters plus a terminating
+ * null from \ref intern_chunk.
+ *
+ * @param s_len The length of the string.
+ * @return Returns a pointer to the memory.
+ */
+NODISCARD
+static char* intern_alloc( size_t s_len ) {
+  size_t const size = s_len + 1;
+  if ( size > INTERN_CHUNK_SIZE / 4 ) {
+    // A long string gets its own chunk so as not to waste the current one.
+    intern_chunk_t *const chunk =
+      MALLOC( char, sizeof( intern_chunk_t ) + size );
+    if ( intern_chunk == NULL ) {
+      chunk->prev = NULL;
+      intern_chunk = chunk;
+      intern_chunk_len = INTERN_CHUNK_SIZE;
+    } else {
+      chunk->prev = intern_chunk->prev;
+      intern_chunk->prev = chunk;
+    }
+    return chunk->buf;
+  }
+
+  if ( intern_chunk == NULL || intern_chunk_len + size > INTERN_CHUNK_SIZE ) {
+    intern_chunk_t *const chunk =
+      MALLOC( char, sizeof( intern_chunk_t ) + INTERN_CHUNK_SIZE );
+    chunk->prev = intern_chunk;
+    intern_chunk = chunk;
+    intern_chunk_len = 0;
+  }
+
+  char *const s = intern_chunk->buf + intern_chunk_len;
+  intern_chunk_len += size;
+  return s;
+}
+
+/**
+ * Cleans-up all interned strings at program termination.
+ *
+ * @note This function is called only via **atexit**(3).
+ */
+static void intern_cleanup( void ) {
+  while ( intern_chunk != NULL ) {
+    intern_chunk_t *const prev = intern_chunk->prev;
+    FREE( intern_chunk );
+    intern_chunk = prev;
+  } // while
+  FREE( intern_set );
+}
+
+/**
+ * Gets a hash code for the first \a s_len characters of \a s.
+ *
+ * @param s The string to hash.
+ * @param s_len The number of characters of \a s to hash.
+ * @return Returns said hash code.
+ */
+NODISCARD
+static size_t intern_hash( char const *s, size_t s_len ) {
+  return STATIC_CAST( size_t, fnv1a( FNV1A_INIT, s, s_len ) );
+}
+
+/**
+ * Finds the entry in \ref intern_set for the first \a s_len characters of \a
+ * s.
+ *
+ * @param s The string to find.
+ * @param s_len The number of characters of \a s to find.
+ * @param hash The hash code of \a s as returned by intern_hash().
+ * @return Returns said entry or the empty entry where it would be inserted.
+ */
+NODISCARD
+static intern_entry_t* intern_set_find( char const *s, size_t s_len,
+                                        size_t hash ) {
+  size_t i = hash & (intern_set_cap - 1);
+  for ( ; intern_set[i].s != NULL; i = (i + 1) & (intern_set_cap - 1) ) {
+    intern_entry_t *const entry = &intern_set[i];
+    if ( entry->hash == hash && strncmp( entry->s, s, s_len ) == 0 &&
+         entry->s[ s_len ] == '\0' ) {
+      return entry;
+    }
+  } // for
+  return &intern_set[i];
+}
+
+/**
+ * Grows \ref intern_set to \a cap entries.
+ *
+ * @param cap The new capacity; must be a power of 2.
+ */
+static void intern_set_grow( size_t cap ) {
+  intern_entry_t *const old_set = intern_set;
+  size_t const old_cap = intern_set_cap;
+
+  intern_set = MALLOC( intern_entry_t, cap );
+  memset( intern_set, 0, cap * sizeof intern_set[0] );
+  intern_set_cap = cap;
+
+  for ( size_t i = 0; i < old_cap; ++i ) {
+    intern_entry_t const *const old_entry = &old_set[i];
+    if ( old_entry->s == NULL )
+      continue;
+    size_t j = old_entry->hash & (cap - 1);
+    while ( intern_set[j].s != NULL )
+      j = (j + 1) & (cap - 1);
+    intern_set[j] = *old_entry;
+  } // for
+
+  FREE( old_set );
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+char const* intern_str( char const *s ) {
+  assert( s != NULL );
+  return intern_strn( s, strlen( s ) );
+}
+
+char const* intern_str_find( char const *s ) {
+  assert( s != NULL );
+  if ( intern_set == NULL )
+    return NULL;
+  size_t const s_len = strlen( s );
+  return intern_set_find( s, s_len, intern_hash( s, s_len ) )->s;
+}
+
+char const* intern_strn( char const *s, size_t s_len ) {
+  assert( s != NULL );
+
+  if ( intern_set == NULL ) {
+    intern_set_grow( INTERN_SET_CAP_MIN );
+    ATEXIT( &intern_cleanup );
+  }
+  else if ( (intern_set_len + 1) * 2 > intern_set_cap ) {
+    // Keep the load factor at most 1/2 so probe sequences remain short.
+    intern_set_grow( intern_set_cap * 2 );
+  }
+
+  size_t const hash = intern_hash( s, s_len );
+  intern_entry_t *const entry = intern_set_find( s, s_len, hash );
+  if ( entry->s != NULL )
+    return entry->s;
+
+  char *const interned = intern_alloc( s_len );
+  memcpy( interned, s, s_len );
+  interned[ s_len ] = '\0';
+  *entry = (intern_entry_t){ .hash = hash, .s = interned };
+  ++intern_set_len;
+  return interned;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
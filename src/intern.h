@@ -0,0 +1,90 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/intern.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_intern_H
+#define cdecl_intern_H
+
+/**
+ * @file
+ * Declares functions for interning strings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+// standard
+#include <stddef.h>                     /* for size_t */
+
+/**
+ * @defgroup intern-group String Interning
+ * Functions for interning strings, that is storing only one copy of each
+ * distinct string.
+ *
+ * @remarks Since each distinct string is stored only once, two interned
+ * strings are equal only if their pointers are equal.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Interns \a s.
+ *
+ * @param s The null-terminated string to intern.
+ * @return Returns the one copy of a string equal to \a s.  It remains valid
+ * until program termination.
+ *
+ * @sa intern_str_find()
+ * @sa intern_strn()
+ */
+NODISCARD
+char const* intern_str( char const *s );
+
+/**
+ * Finds the interned copy of \a s, if any, without interning it.
+ *
+ * @param s The null-terminated string to find.
+ * @return Returns the one copy of a string equal to \a s or NULL if no such
+ * string has been interned.
+ *
+ * @sa intern_str()
+ */
+NODISCARD
+char const* intern_str_find( char const *s );
+
+/**
+ * Interns the first \a s_len characters of \a s.
+ *
+ * @param s The string to intern.  It need not be null-terminated.
+ * @param s_len The number of characters of \a s to intern.
+ * @return Returns the one copy of a null-terminated string equal to the first
+ * \a s_len characters of \a s.  It remains valid until program termination.
+ *
+ * @sa intern_str()
+ */
+NODISCARD
+char const* intern_strn( char const *s, size_t s_len );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_intern_H */
+/* vim:set et sw=2 ts=2: */
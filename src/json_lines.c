@@ -0,0 +1,575 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/json_lines.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines a function for reading **cdecl** requests and writing responses as
+ * [JSON Lines](https://jsonlines.org).
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "json_lines.h"
+#include "c_lang.h"
+#include "capture.h"
+#include "cdecl.h"
+#include "lexer.h"
+#include "literals.h"
+#include "options.h"
+#include "parse.h"
+#include "print.h"
+#include "slist.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @endcond
+
+/**
+ * @addtogroup json-lines-group
+ * @{
+ */
+
+/**
+ * A JSON Lines request.
+ */
+struct json_request {
+  strbuf_t    command;                  ///< The **cdecl** command.
+  bool        has_command;              ///< Was `command` given?
+  char const *id;                       ///< Raw JSON of `id`, if any.
+  size_t      id_len;                   ///< Length of \ref id.
+};
+typedef struct json_request json_request_t;
+
+////////// local functions ////////////////////////////////////////////////////
+
+NODISCARD
+static bool json_parse_string( char const**, strbuf_t* );
+
+static void json_put_utf8( strbuf_t*, unsigned long );
+static void json_puts_quoted( strbuf_t*, char const*, size_t );
+
+/**
+ * Parses a JSON `true` or `false`.
+ *
+ * @param ps A pointer to the pointer to the value.  On success, it is advanced
+ * past the value.
+ * @param pb A pointer to receive the value.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool json_parse_bool( char const **ps, bool *pb ) {
+  assert( ps != NULL );
+  assert( pb != NULL );
+
+  if ( strncmp( *ps, "true", 4 ) == 0 ) {
+    *ps += 4;
+    *pb = true;
+    return true;
+  }
+  if ( strncmp( *ps, "false", 5 ) == 0 ) {
+    *ps += 5;
+    *pb = false;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Parses 4 hexadecimal digits of a JSON `\u` escape sequence.
+ *
+ * @param ps A pointer to the pointer to the first digit.  On success, it is
+ * advanced past the last digit.
+ * @param pcp A pointer to receive the code-point.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool json_parse_hex4( char const **ps, unsigned long *pcp ) {
+  assert( ps != NULL );
+  assert( pcp != NULL );
+
+  unsigned long cp = 0;
+  for ( unsigned i = 0; i < 4; ++i ) {
+    unsigned char const c = STATIC_CAST( unsigned char, (*ps)[i] );
+    if ( !isxdigit( c ) )
+      return false;
+    cp = (cp << 4) | STATIC_CAST( unsigned long,
+      isdigit( c ) ? c - '0' : tolower( c ) - 'a' + 10
+    );
+  } // for
+  *ps += 4;
+  *pcp = cp;
+  return true;
+}
+
+/**
+ * Parses (but discards) a JSON scalar, i.e., a string, number, `true`,
+ * `false`, or `null`.
+ *
+ * @param ps A pointer to the pointer to the value.  On success, it is advanced
+ * past the value.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool json_parse_scalar( char const **ps ) {
+  assert( ps != NULL );
+
+  char const *s = *ps;
+  if ( *s == '"' ) {
+    strbuf_t sbuf;
+    strbuf_init( &sbuf );
+    bool const ok = json_parse_string( ps, &sbuf );
+    strbuf_cleanup( &sbuf );
+    return ok;
+  }
+  if ( strncmp( s, "null", 4 ) == 0 ) {
+    *ps += 4;
+    return true;
+  }
+  bool b;
+  if ( json_parse_bool( ps, &b ) )
+    return true;
+
+  if ( *s == '-' )
+    ++s;
+  if ( !isdigit( STATIC_CAST( unsigned char, *s ) ) )
+    return false;
+  while ( isdigit( STATIC_CAST( unsigned char, *s ) ) ||
+          *s == '.' || *s == 'e' || *s == 'E' || *s == '+' || *s == '-' ) {
+    ++s;
+  } // while
+  *ps = s;
+  return true;
+}
+
+/**
+ * Parses a JSON string.
+ *
+ * @param ps A pointer to the pointer to the opening `"`.  On success, it is
+ * advanced past the closing `"`.
+ * @param sbuf The \ref strbuf to append the unescaped string onto.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool json_parse_string( char const **ps, strbuf_t *sbuf ) {
+  assert( ps != NULL );
+  assert( sbuf != NULL );
+
+  char const *s = *ps;
+  if ( *s++ != '"' )
+    return false;
+
+  for (;;) {
+    char c = *s++;
+    switch ( c ) {
+      case '\0':
+        return false;
+      case '"':
+        *ps = s;
+        return true;
+      case '\\':
+        break;
+      default:
+        if ( STATIC_CAST( unsigned char, c ) < 0x20 )
+          return false;
+        strbuf_putc( sbuf, c );
+        continue;
+    } // switch
+
+    switch ( c = *s++ ) {
+      case '"':
+      case '/':
+      case '\\':
+        break;
+      case 'b': c = '\b'; break;
+      case 'f': c = '\f'; break;
+      case 'n': c = '\n'; break;
+      case 'r': c = '\r'; break;
+      case 't': c = '\t'; break;
+      case 'u':;
+        unsigned long cp;
+        if ( !json_parse_hex4( &s, &cp ) || cp == 0 )
+          return false;
+        if ( cp >= 0xD800 && cp <= 0xDBFF ) {
+          unsigned long low_cp;
+          if ( s[0] != '\\' || s[1] != 'u' )
+            return false;
+          s += 2;
+          if ( !json_parse_hex4( &s, &low_cp ) ||
+               low_cp < 0xDC00 || low_cp > 0xDFFF ) {
+            return false;
+          }
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low_cp - 0xDC00);
+        }
+        json_put_utf8( sbuf, cp );
+        continue;
+      default:
+        return false;
+    } // switch
+    strbuf_putc( sbuf, c );
+  } // for
+}
+
+/**
+ * Appends the UTF-8 encoding of \a cp onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param cp The Unicode code-point to append.
+ */
+static void json_put_utf8( strbuf_t *sbuf, unsigned long cp ) {
+  assert( sbuf != NULL );
+
+  if ( cp < 0x80 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, cp ) );
+  }
+  else if ( cp < 0x800 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xC0 | (cp >> 6) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+  else if ( cp < 0x10000 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xE0 | (cp >> 12) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | ((cp >> 6) & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+  else {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xF0 | (cp >> 18) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | ((cp >> 12) & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | ((cp >> 6) & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+}
+
+/**
+ * Appends \a s as a quoted JSON string onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param s The string to append.
+ * @param s_len The length of \a s.
+ */
+static void json_puts_quoted( strbuf_t *sbuf, char const *s, size_t s_len ) {
+  assert( sbuf != NULL );
+  assert( s != NULL || s_len == 0 );
+
+  strbuf_putc( sbuf, '"' );
+  for ( char const *const end = s + s_len; s < end; ++s ) {
+    switch ( *s ) {
+      case '"' : strbuf_putsn( sbuf, "\\\"", 2 ); continue;
+      case '\\': strbuf_putsn( sbuf, "\\\\", 2 ); continue;
+      case '\b': strbuf_putsn( sbuf, "\\b" , 2 ); continue;
+      case '\f': strbuf_putsn( sbuf, "\\f" , 2 ); continue;
+      case '\n': strbuf_putsn( sbuf, "\\n" , 2 ); continue;
+      case '\r': strbuf_putsn( sbuf, "\\r" , 2 ); continue;
+      case '\t': strbuf_putsn( sbuf, "\\t" , 2 ); continue;
+    } // switch
+    if ( STATIC_CAST( unsigned char, *s ) < 0x20 )
+      strbuf_printf( sbuf, "\\u%04X", STATIC_CAST( unsigned, *s ) );
+    else
+      strbuf_putc( sbuf, *s );
+  } // for
+  strbuf_putc( sbuf, '"' );
+}
+
+/**
+ * Parses a JSON Lines request, applying any options given in it.
+ *
+ * @note Errors are printed via print_error().
+ *
+ * @param s The request to parse.
+ * @param req The \ref json_request to parse into.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool json_request_parse( char const *s, json_request_t *req ) {
+  assert( s != NULL );
+  assert( req != NULL );
+
+  strbuf_t key_sbuf, value_sbuf;
+  strbuf_init( &key_sbuf );
+  strbuf_init( &value_sbuf );
+  bool ok = false;
+
+  SKIP_WS( s );
+  if ( *s++ != '{' )
+    goto invalid_json;
+  SKIP_WS( s );
+  if ( *s == '}' ) {
+    ++s;
+    goto end_object;
+  }
+
+  for (;;) {
+    strbuf_reset( &key_sbuf );
+    if ( !json_parse_string( &s, &key_sbuf ) )
+      goto invalid_json;
+    SKIP_WS( s );
+    if ( *s++ != ':' )
+      goto invalid_json;
+    SKIP_WS( s );
+
+    char const *const key = empty_if_null( key_sbuf.str );
+    if ( strcmp( key, "command" ) == 0 ) {
+      strbuf_reset( &req->command );
+      if ( !json_parse_string( &s, &req->command ) )
+        goto invalid_json;
+      req->has_command = true;
+    }
+    else if ( strcmp( key, "id" ) == 0 ) {
+      req->id = s;
+      if ( !json_parse_scalar( &s ) ) {
+        req->id = NULL;
+        goto invalid_json;
+      }
+      req->id_len = STATIC_CAST( size_t, s - req->id );
+    }
+    else if ( strcmp( key, L_OPT_east_const ) == 0 ) {
+      if ( !json_parse_bool( &s, &opt_east_const ) )
+        goto invalid_value;
+    }
+    else if ( strcmp( key, L_OPT_explicit_int ) == 0 ) {
+      strbuf_reset( &value_sbuf );
+      if ( !json_parse_string( &s, &value_sbuf ) ||
+           !parse_explicit_int( empty_if_null( value_sbuf.str ) ) ) {
+        goto invalid_value;
+      }
+    }
+    else if ( strcmp( key, L_OPT_language ) == 0 ) {
+      strbuf_reset( &value_sbuf );
+      if ( !json_parse_string( &s, &value_sbuf ) )
+        goto invalid_value;
+      c_lang_id_t const lang_id =
+        c_lang_find( empty_if_null( value_sbuf.str ) );
+      if ( lang_id == LANG_NONE )
+        goto invalid_value;
+      lang_set( lang_id );
+    }
+    else {
+      print_error( /*loc=*/NULL, "\"%s\": unknown request key\n", key );
+      goto done;
+    }
+
+    SKIP_WS( s );
+    if ( *s == '}' ) {
+      ++s;
+      break;
+    }
+    if ( *s++ != ',' )
+      goto invalid_json;
+    SKIP_WS( s );
+  } // for
+
+end_object:
+  SKIP_WS( s );
+  if ( *s != '\0' )
+    goto invalid_json;
+  if ( !req->has_command ) {
+    print_error( /*loc=*/NULL, "request requires \"command\"\n" );
+    goto done;
+  }
+  ok = true;
+  goto done;
+
+invalid_json:
+  print_error( /*loc=*/NULL, "invalid JSON request\n" );
+  goto done;
+
+invalid_value:
+  print_error( /*loc=*/NULL,
+    "invalid value for request key \"%s\"\n", empty_if_null( key_sbuf.str )
+  );
+
+done:
+  strbuf_cleanup( &key_sbuf );
+  strbuf_cleanup( &value_sbuf );
+  return ok;
+}
+
+/**
+ * Writes a JSON Lines response.
+ *
+ * @param req The \ref json_request the response is for.
+ * @param status The exit status of the request.
+ * @param out_sbuf The standard output of the request.
+ * @param diag_list The list of \ref print_diag of the request.
+ * @param time_us The number of microseconds the request took.
+ * @param fout The `FILE` to write to.
+ */
+static void json_respond( json_request_t const *req, int status,
+                          strbuf_t const *out_sbuf, slist_t const *diag_list,
+                          unsigned long long time_us, FILE *fout ) {
+  assert( req != NULL );
+  assert( out_sbuf != NULL );
+  assert( diag_list != NULL );
+  assert( fout != NULL );
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+
+  strbuf_puts( &sbuf, "{\"id\":" );
+  if ( req->id != NULL )
+    strbuf_putsn( &sbuf, req->id, req->id_len );
+  else
+    strbuf_puts( &sbuf, "null" );
+  strbuf_printf( &sbuf, ",\"status\":%d,\"output\":", status );
+  json_puts_quoted( &sbuf, out_sbuf->str, out_sbuf->len );
+
+  strbuf_puts( &sbuf, ",\"diagnostics\":[" );
+  bool comma = false;
+  FOREACH_SLIST_NODE( diag_node, diag_list ) {
+    print_diag_t const *const diag = diag_node->data;
+    if ( true_or_set( &comma ) )
+      strbuf_putc( &sbuf, ',' );
+    strbuf_puts( &sbuf, "{\"severity\":" );
+    json_puts_quoted( &sbuf, diag->severity, strlen( diag->severity ) );
+    if ( diag->line > 0 )
+      strbuf_printf( &sbuf, ",\"line\":%u", diag->line );
+    if ( diag->column > 0 )
+      strbuf_printf( &sbuf, ",\"column\":%zu", diag->column );
+    strbuf_puts( &sbuf, ",\"message\":" );
+    json_puts_quoted( &sbuf, diag->msg, diag->msg_len );
+    strbuf_puts( &sbuf, ",\"suggestions\":[" );
+    bool hint_comma = false;
+    FOREACH_SLIST_NODE( hint_node, &diag->hint_list ) {
+      char const *const hint = hint_node->data;
+      if ( true_or_set( &hint_comma ) )
+        strbuf_putc( &sbuf, ',' );
+      json_puts_quoted( &sbuf, hint, strlen( hint ) );
+    } // for
+    strbuf_puts( &sbuf, "]}" );
+  } // for
+
+  strbuf_printf( &sbuf, "],\"time_us\":%llu}\n", time_us );
+
+  PERROR_EXIT_IF( fwrite( sbuf.str, 1, sbuf.len, fout ) < sbuf.len, EX_IOERR );
+  FFLUSH( fout );                       // so a pipeline gets it immediately
+  strbuf_cleanup( &sbuf );
+}
+
+/**
+ * Gets the number of microseconds between \a begin and \a end.
+ *
+ * @param begin The beginning time.
+ * @param end The ending time.
+ * @return Returns said number of microseconds.
+ */
+NODISCARD
+static unsigned long long timespec_us( struct timespec const *begin,
+                                       struct timespec const *end ) {
+  assert( begin != NULL );
+  assert( end != NULL );
+  long long const ns =
+    (end->tv_sec - begin->tv_sec) * 1000000000LL +
+    (end->tv_nsec - begin->tv_nsec);
+  return STATIC_CAST( unsigned long long, ns / 1000 );
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_json_lines( FILE *fin ) {
+  assert( fin != NULL );
+
+  // Responses go to the real standard output; everything else printed while
+  // parsing a command is captured.  Errors and warnings are recorded in
+  // diag_list instead.
+  int const fout_fd = dup( STDOUT_FILENO );
+  PERROR_EXIT_IF( fout_fd == -1, EX_OSERR );
+  FILE *const fout = fdopen( fout_fd, "w" );
+  PERROR_EXIT_IF( fout == NULL, EX_OSERR );
+  capture_init();
+
+  slist_t diag_list;
+  slist_init( &diag_list );
+  print_params.diag_list = &diag_list;
+
+  strbuf_t out_sbuf;
+  strbuf_init( &out_sbuf );
+
+  char   *line = NULL;
+  size_t  line_cap = 0;
+  ssize_t line_len;
+  int     line_no = 0;
+  int     status = EX_OK;
+
+  while ( (line_len = getline( &line, &line_cap, fin )) != -1 ) {
+    ++line_no;
+    char const *s = line;
+    SKIP_WS( s );
+    if ( *s == '\0' )
+      continue;                         // blank lines are allowed
+
+    options_snapshot_t orig_opts;
+    options_save( &orig_opts );
+
+    json_request_t req = { 0 };
+    strbuf_init( &req.command );
+    struct timespec begin = { 0 }, end = { 0 };
+
+    capture_begin();
+    if ( json_request_parse( s, &req ) ) {
+      // Line numbers in diagnostics are those of requests.
+      yylineno = line_no;
+      PJL_DISCARD_RV( clock_gettime( CLOCK_MONOTONIC, &begin ) );
+      status = cdecl_parse_string(
+        empty_if_null( req.command.str ), req.command.len
+      );
+      PJL_DISCARD_RV( clock_gettime( CLOCK_MONOTONIC, &end ) );
+    }
+    else {
+      status = EX_DATAERR;
+    }
+    print_diag_end();
+    capture_end( &out_sbuf, /*err_sbuf=*/NULL );
+    options_restore( &orig_opts );
+
+    unsigned long long const time_us =
+      (cdecl_test & CDECL_TEST_NO_TIMING) != 0 ?
+        0 : timespec_us( &begin, &end );
+    json_respond( &req, status, &out_sbuf, &diag_list, time_us, fout );
+
+    slist_cleanup(
+      &diag_list, POINTER_CAST( slist_free_fn_t, &print_diag_free )
+    );
+    strbuf_cleanup( &req.command );
+    strbuf_reset( &out_sbuf );
+  } // while
+
+  print_params.diag_list = NULL;
+  free( line );
+  strbuf_cleanup( &out_sbuf );
+  PJL_DISCARD_RV( fclose( fout ) );
+  return status;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
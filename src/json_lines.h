@@ -0,0 +1,89 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/json_lines.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_json_lines_H
+#define cdecl_json_lines_H
+
+/**
+ * @file
+ * Declares a function for reading **cdecl** requests and writing responses
+ * as [JSON Lines](https://jsonlines.org).
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+// standard
+#include <stdio.h>                      /* for FILE */
+
+/**
+ * @defgroup json-lines-group JSON Lines
+ * A function for reading **cdecl** requests and writing responses as [JSON
+ * Lines](https://jsonlines.org).
+ *
+ * @remarks
+ * @parblock
+ * Each request is a JSON object on a line by itself:
+ *
+ *      {"id":1,"command":"explain int *p","language":"C11"}
+ *
+ * where:
+ *
+ * Key            | Value
+ * ---------------|-----------------------------------------------------------
+ * `command`      | The **cdecl** command (required).
+ * `id`           | Any JSON scalar that is echoed in the response (optional).
+ * `language`     | The language for only this request (optional).
+ * `east-const`   | `true` or `false` for only this request (optional).
+ * `explicit-int` | As for `set explicit-int` for only this request (optional).
+ *
+ * Each response is a JSON object on a line by itself:
+ *
+ *      {"id":1,"status":0,"output":"declare p as pointer to integer\n",
+ *       "diagnostics":[],"time_us":42}
+ *
+ * (shown wrapped) where each element of `diagnostics` is an object having the
+ * keys `severity` (either `error` or `warning`), `line` and `column` (if
+ * known), `message`, and `suggestions` (an array of "did you mean"
+ * suggestions).
+ * @endparblock
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Reads JSON Lines requests from \a fin until EOF, parses the **cdecl**
+ * command of each, and writes a JSON Lines response for each to standard
+ * output.
+ *
+ * @param fin The `FILE` to read from.
+ * @return Returns `EX_OK` upon success of the last request or another value
+ * upon failure.
+ */
+NODISCARD
+int cdecl_json_lines( FILE *fin );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_json_lines_H */
+/* vim:set et sw=2 ts=2: */
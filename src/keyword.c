@@ -0,0 +1,241 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/keyword.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for looking up both C/C++ and **cdecl** keywords at once.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "keyword.h"
+#include "c_keyword.h"
+#include "cdecl_keyword.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>                     /* for uint32_t, uint64_t */
+#include <stdlib.h>
+#include <string.h>
+
+/// @endcond
+
+/**
+ * @addtogroup keywords-group
+ * @{
+ */
+
+////////// local variables ////////////////////////////////////////////////////
+
+static keyword_t   *keyword_table;      ///< Keywords indexed by hash.
+static size_t       keyword_table_cap;  ///< Capacity of \ref keyword_table.
+static uint32_t    *keyword_disp;       ///< Displacements indexed by bucket.
+static size_t       keyword_disp_len;   ///< Length of \ref keyword_disp.
+static uint64_t     keyword_seed;       ///< Seed of keyword_hash().
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Cleans-up all memory used by keyword data.
+ *
+ * @note This function is called only via **atexit**(3).
+ *
+ * @sa keywords_init()
+ */
+static void keywords_cleanup( void ) {
+  FREE( keyword_disp );
+  FREE( keyword_table );
+}
+
+/**
+ * Hashes \a literal.
+ *
+ * @remarks This is fnv1a() additionally seeded by \ref keyword_seed.  The
+ * low-order bits select a bucket; the high-order 32 bits select a slot.
+ *
+ * @param literal The literal to hash.
+ * @return Returns said hash code.
+ */
+NODISCARD
+static uint64_t keyword_hash( char const *literal ) {
+  assert( literal != NULL );
+  return fnv1a( FNV1A_INIT ^ keyword_seed, literal, strlen( literal ) );
+}
+
+/**
+ * Gets the slot in \ref keyword_table for \a hash given \a disp.
+ *
+ * @param hash The hash code of a literal.
+ * @param disp The displacement of the literal's bucket.
+ * @return Returns said slot.
+ */
+NODISCARD
+static inline size_t keyword_slot( uint64_t hash, uint32_t disp ) {
+  return STATIC_CAST( size_t, (hash >> 32) ^ disp ) & (keyword_table_cap - 1);
+}
+
+/**
+ * Attempts to construct a perfect hash function for \a keywords using the
+ * current value of \ref keyword_seed.
+ *
+ * @param keywords The array of keywords.
+ * @param keywords_len The length of \a keywords.
+ * @param hashes An array of \a keywords_len elements to use.
+ * @param buckets An array of \a keywords_len elements to use.
+ * @param bucket_lens An array of \ref keyword_disp_len elements to use.
+ * @return Returns `true` only if the construction succeeded.
+ */
+NODISCARD
+static bool keywords_place( keyword_t const *keywords, size_t keywords_len,
+                            uint64_t *hashes, size_t *buckets,
+                            size_t *bucket_lens ) {
+  memset( keyword_table, 0, keyword_table_cap * sizeof keyword_table[0] );
+  memset( bucket_lens, 0, keyword_disp_len * sizeof bucket_lens[0] );
+
+  size_t max_bucket_len = 0;
+  for ( size_t i = 0; i < keywords_len; ++i ) {
+    hashes[i] = keyword_hash( keywords[i].literal );
+    size_t const b = hashes[i] & (keyword_disp_len - 1);
+    if ( ++bucket_lens[b] > max_bucket_len )
+      max_bucket_len = bucket_lens[b];
+  } // for
+
+  //
+  // Place the buckets having the most keywords first since they're the
+  // hardest to place.
+  //
+  for ( size_t len = max_bucket_len; len > 0; --len ) {
+    for ( size_t b = 0; b < keyword_disp_len; ++b ) {
+      if ( bucket_lens[b] != len )
+        continue;
+
+      size_t n = 0;
+      for ( size_t i = 0; i < keywords_len; ++i ) {
+        if ( (hashes[i] & (keyword_disp_len - 1)) == b )
+          buckets[ n++ ] = i;
+      } // for
+
+      uint32_t disp = 0;
+      for ( ; disp < keyword_table_cap; ++disp ) {
+        size_t i = 0;
+        for ( ; i < n; ++i ) {
+          size_t const slot = keyword_slot( hashes[ buckets[i] ], disp );
+          if ( keyword_table[ slot ].literal != NULL )
+            break;
+          keyword_table[ slot ] = keywords[ buckets[i] ];
+        } // for
+        if ( i == n )
+          break;
+        while ( i-- > 0 ) {             // undo partial placement
+          size_t const slot = keyword_slot( hashes[ buckets[i] ], disp );
+          keyword_table[ slot ] = (keyword_t){ 0 };
+        } // while
+      } // for
+      if ( disp == keyword_table_cap )
+        return false;
+      keyword_disp[b] = disp;
+    } // for
+  } // for
+
+  return true;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+keyword_t const* keyword_find( char const *literal ) {
+  assert( literal != NULL );
+  uint64_t const hash = keyword_hash( literal );
+  keyword_t const *const kw = &keyword_table[
+    keyword_slot( hash, keyword_disp[ hash & (keyword_disp_len - 1) ] )
+  ];
+  return kw->literal != NULL && strcmp( literal, kw->literal ) == 0 ?
+    kw : NULL;
+}
+
+void keywords_init( void ) {
+  ASSERT_RUN_ONCE();
+
+  size_t keywords_len = 0;
+  FOREACH_C_KEYWORD( ck )
+    ++keywords_len;
+  FOREACH_CDECL_KEYWORD( cdk )
+    ++keywords_len;
+
+  keyword_t *const keywords = MALLOC( keyword_t, keywords_len );
+  keywords_len = 0;
+
+  //
+  // Both C_KEYWORDS and CDECL_KEYWORDS are sorted, so merge them such that
+  // there's only one keyword_t per distinct literal.
+  //
+  c_keyword_t const *ck = c_keyword_next( NULL );
+  cdecl_keyword_t const *cdk = cdecl_keyword_next( NULL );
+  while ( ck != NULL || cdk != NULL ) {
+    int const cmp = ck == NULL ? 1 : cdk == NULL ? -1 :
+      strcmp( ck->literal, cdk->literal );
+    keyword_t *const kw = &keywords[ keywords_len++ ];
+    *kw = (keyword_t){ .literal = cmp <= 0 ? ck->literal : cdk->literal };
+    if ( cmp <= 0 ) {
+      kw->c_keywords = ck;
+      do {
+        ++kw->c_keywords_len;
+        ck = c_keyword_next( ck );
+      } while ( ck != NULL && strcmp( ck->literal, kw->literal ) == 0 );
+    }
+    if ( cmp >= 0 ) {
+      kw->cdecl_keyword = cdk;
+      cdk = cdecl_keyword_next( cdk );
+    }
+  } // while
+
+  // Load factor of at most 1/2 and an average of 2 keywords per bucket.
+  keyword_table_cap = 1;
+  while ( keyword_table_cap < keywords_len * 2 )
+    keyword_table_cap <<= 1;
+  keyword_disp_len = keyword_table_cap / 4;
+
+  keyword_table = MALLOC( keyword_t, keyword_table_cap );
+  keyword_disp = MALLOC( uint32_t, keyword_disp_len );
+  ATEXIT( &keywords_cleanup );
+
+  uint64_t *const hashes = MALLOC( uint64_t, keywords_len );
+  size_t *const buckets = MALLOC( size_t, keywords_len );
+  size_t *const bucket_lens = MALLOC( size_t, keyword_disp_len );
+
+  while ( !keywords_place( keywords, keywords_len, hashes, buckets,
+                           bucket_lens ) ) {
+    ++keyword_seed;
+  } // while
+
+  FREE( bucket_lens );
+  FREE( buckets );
+  FREE( hashes );
+  FREE( keywords );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
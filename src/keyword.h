@@ -0,0 +1,122 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/keyword.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_keyword_H
+#define cdecl_keyword_H
+
+/**
+ * @file
+ * Declares a type and functions for looking up both C/C++ and **cdecl**
+ * keywords at once.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_keyword.h"
+#include "cdecl_keyword.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+
+/// @endcond
+
+/**
+ * @defgroup keywords-group Keywords
+ * A type and functions for looking up both C/C++ and **cdecl** keywords at
+ * once.
+ *
+ * @remarks
+ * @parblock
+ * Every distinct keyword literal is stored in a table indexed by a _perfect_
+ * hash function, that is one having no collisions, so looking up any literal
+ * takes exactly one hash computation and at most one string comparison.  The
+ * hash function is constructed once at initialization using the "hash and
+ * displace" algorithm:
+ *
+ *  1. Every literal is hashed into one of a number of buckets.
+ *
+ *  2. Buckets are placed in descending order of size: for each, a
+ *     displacement value is found such that, when combined with each of its
+ *     literals' hash codes, every literal maps to a distinct empty slot.
+ *
+ *  3. If any bucket can't be placed, the hash function is re-seeded and it
+ *     starts over.
+ * @endparblock
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * All the C/C++ and **cdecl** keywords for a literal.
+ */
+struct keyword {
+  char const             *literal;      ///< C string literal of the keyword.
+
+  /**
+   * Pointer to the first of \ref c_keywords_len consecutive \ref c_keyword
+   * elements for \ref literal, if any; otherwise NULL.
+   *
+   * @remarks There can be more than one since the same literal can have
+   * different meanings in different languages or contexts.
+   */
+  c_keyword_t const      *c_keywords;
+
+  size_t                  c_keywords_len; ///< Length of \ref c_keywords.
+
+  /**
+   * The \ref cdecl_keyword for \ref literal, if any; otherwise NULL.
+   */
+  cdecl_keyword_t const  *cdecl_keyword;
+};
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Given a literal, gets the keyword information for all C/C++ keywords and
+ * the **cdecl** keyword, if any, for it regardless of language.
+ *
+ * @param literal The literal to find.
+ * @return Returns a pointer to the corresponding keyword or NULL if \a
+ * literal is neither a C/C++ nor a **cdecl** keyword.
+ *
+ * @sa c_keyword_find()
+ * @sa cdecl_keyword_find()
+ */
+NODISCARD
+keyword_t const* keyword_find( char const *literal );
+
+/**
+ * Initializes \ref keyword data.
+ *
+ * @note This function must be called exactly once and after both
+ * c_keywords_init() and cdecl_keywords_init() are called.
+ */
+void keywords_init( void );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_keyword_H */
+/* vim:set et sw=2 ts=2: */
@@ -38,6 +38,7 @@
 // standard
 #include <stdbool.h>
 #include <stdio.h>                      /* for FILE */
+#include <sys/stat.h>                   /* for struct stat */
 
 /// @endcond
 
@@ -85,6 +86,18 @@ enum lexer_find_kind {
 };
 typedef enum lexer_find_kind lexer_find_kind_t;
 
+/**
+ * The signature for a function called whenever a file is included.
+ *
+ * @param path The path of the file as given by the `include` command.
+ * @param real_path The resolved path of the file.
+ * @param st The status of the file.
+ *
+ * @sa lexer_include_fn
+ */
+typedef void (*lexer_include_fn_t)( char const *path, char const *real_path,
+                                    struct stat const *st );
+
 ////////// extern variables ///////////////////////////////////////////////////
 
 /**
@@ -104,6 +117,11 @@ typedef enum lexer_find_kind lexer_find_kind_t;
  */
 extern lexer_find_kind_t  lexer_find;
 
+/**
+ * If not NULL, called whenever a file is included.
+ */
+extern lexer_include_fn_t lexer_include_fn;
+
 /**
  * Set to `true` only when were currently "in" a C-style comment, that is we
  * encountered <code>/\*</code> but not its closing
@@ -229,6 +247,19 @@ void lexer_pop_string( void );
  */
 void lexer_reset( bool hard_reset );
 
+/**
+ * Restarts the lexer such that subsequent tokens lex'd via yylex() will be
+ * from \a s.
+ *
+ * @remarks Unlike lexer_push_string(), \a s is read directly rather than via
+ * a `FILE` and is also what lexer_input_line() returns, so it's never copied
+ * other than into Flex's own buffer.
+ *
+ * @param s The string to lex.  It must remain valid until lexing it is done.
+ * @param s_len The length of \a s.
+ */
+void lexer_restart_string( char const *s, size_t s_len );
+
 /**
  * Gets a printable version of \ref yytext.
  *
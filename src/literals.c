@@ -42,6 +42,7 @@ char const L_boolean[]                  = "boolean";
 char const L_Boolean[]                  = "Boolean";
 char const L_by[]                       = "by";
 char const L_bytes[]                    = "bytes";
+char const L_cache[]                    = "cache";
 char const L_cast[]                     = "cast";
 char const L_command[]                  = "command";
 char const L_commands[]                 = "commands";
@@ -102,6 +103,8 @@ char const L_OPT_alt_tokens[]           = "alt-tokens";
 #ifdef ENABLE_BISON_DEBUG
 char const L_OPT_bison_debug[]          = "bison-debug";
 #endif /* ENABLE_BISON_DEBUG */
+char const L_OPT_cache_dir[]            = "cache-dir";
+char const L_OPT_client[]               = "client";
 char const L_OPT_color[]                = "color";
 char const L_OPT_commands[]             = "commands";
 char const L_OPT_config[]               = "config";
@@ -117,14 +120,20 @@ char const L_OPT_file[]                 = "file";
 char const L_OPT_flex_debug[]           = "flex-debug";
 #endif /* ENABLE_FLEX_DEBUG */
 char const L_OPT_help[]                 = "help";
+char const L_OPT_include_once[]         = "include-once";
 char const L_OPT_infer_command[]        = "infer-command";
+char const L_OPT_jobs[]                 = "jobs";
+char const L_OPT_json_lines[]           = "json-lines";
 char const L_OPT_language[]             = "language";
+char const L_OPT_lazy_typedefs[]        = "lazy-typedefs";
 char const L_OPT_lineno[]               = "lineno";
 char const L_OPT_options[]              = "options";
 char const L_OPT_output[]               = "output";
 char const L_OPT_permissive_types[]     = "permissive-types";
 char const L_OPT_prompt[]               = "prompt";
 char const L_OPT_semicolon[]            = "semicolon";
+char const L_OPT_server[]               = "server";
+char const L_OPT_stats[]                = "stats";
 char const L_OPT_trailing_return[]      = "trailing-return";
 char const L_OPT_trigraphs[]            = "trigraphs";
 char const L_OPT_using[]                = "using";
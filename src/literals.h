@@ -63,6 +63,7 @@ extern char const L_boolean[];
 extern char const L_Boolean[];
 extern char const L_by[];
 extern char const L_bytes[];
+extern char const L_cache[];
 extern char const L_cast[];
 extern char const L_command[];            // synonym for "commands"
 extern char const L_commands[];
@@ -123,6 +124,8 @@ extern char const L_OPT_alt_tokens[];
 #ifdef ENABLE_BISON_DEBUG
 extern char const L_OPT_bison_debug[];
 #endif /* ENABLE_BISON_DEBUG */
+extern char const L_OPT_cache_dir[];
+extern char const L_OPT_client[];
 extern char const L_OPT_color[];
 extern char const L_OPT_commands[];
 extern char const L_OPT_config[];
@@ -138,14 +141,20 @@ extern char const L_OPT_file[];
 extern char const L_OPT_flex_debug[];
 #endif /* ENABLE_FLEX_DEBUG */
 extern char const L_OPT_help[];
+extern char const L_OPT_include_once[];
 extern char const L_OPT_infer_command[];
+extern char const L_OPT_jobs[];
+extern char const L_OPT_json_lines[];
 extern char const L_OPT_language[];
+extern char const L_OPT_lazy_typedefs[];
 extern char const L_OPT_lineno[];
 extern char const L_OPT_options[];
 extern char const L_OPT_output[];
 extern char const L_OPT_permissive_types[];
 extern char const L_OPT_prompt[];
 extern char const L_OPT_semicolon[];
+extern char const L_OPT_server[];
+extern char const L_OPT_stats[];
 extern char const L_OPT_trailing_return[];
 extern char const L_OPT_trigraphs[];
 extern char const L_OPT_using[];
@@ -0,0 +1,119 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/mapped_file.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for reading files via memory-mapping.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "mapped_file.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>                     /* for SIZE_MAX */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/// @endcond
+
+/**
+ * @addtogroup mapped-file-group
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void mapped_file_close( mapped_file_t *mf ) {
+  assert( mf != NULL );
+  if ( mf->buf == NULL )
+    return;
+  munmap( CONST_CAST( char*, mf->buf ), mf->size );
+  free( mf->line_offs );
+  *mf = (mapped_file_t){ 0 };
+}
+
+char const* mapped_file_line( mapped_file_t const *mf, size_t line_no,
+                              size_t *rv_len ) {
+  assert( mf != NULL );
+  assert( line_no > 0 );
+  assert( line_no <= mf->lines_len );
+  assert( rv_len != NULL );
+
+  size_t const line_off = mf->line_offs[ line_no - 1 ];
+  size_t const next_off = line_no < mf->lines_len ?
+    mf->line_offs[ line_no ] : mf->size;
+  *rv_len = next_off - line_off;
+  return mf->buf + line_off;
+}
+
+bool mapped_file_open( mapped_file_t *mf, int fd ) {
+  assert( mf != NULL );
+  assert( fd >= 0 );
+
+  *mf = (mapped_file_t){ 0 };
+
+  struct stat st;
+  if ( fstat( fd, &st ) < 0 || !S_ISREG( st.st_mode ) || st.st_size <= 0 ||
+       STATIC_CAST( uintmax_t, st.st_size ) > SIZE_MAX ) {
+    return false;
+  }
+
+  size_t const size = STATIC_CAST( size_t, st.st_size );
+  void *const buf = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+  if ( buf == MAP_FAILED )
+    return false;                       // LCOV_EXCL_LINE
+
+  mf->buf = buf;
+  mf->size = size;
+
+  //
+  // Count the lines first so the index can be allocated exactly once.
+  //
+  char const *const end = mf->buf + size;
+  for ( char const *s = mf->buf; s < end; ++mf->lines_len ) {
+    char const *const nl = memchr( s, '\n', STATIC_CAST( size_t, end - s ) );
+    s = nl != NULL ? nl + 1 : end;
+  } // for
+
+  mf->line_offs = MALLOC( size_t, mf->lines_len );
+  size_t i = 0;
+  for ( char const *s = mf->buf; s < end; ) {
+    mf->line_offs[ i++ ] = STATIC_CAST( size_t, s - mf->buf );
+    char const *const nl = memchr( s, '\n', STATIC_CAST( size_t, end - s ) );
+    s = nl != NULL ? nl + 1 : end;
+  } // for
+  assert( i == mf->lines_len );
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,109 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/mapped_file.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_mapped_file_H
+#define cdecl_mapped_file_H
+
+/**
+ * @file
+ * Declares a type and functions for reading files via memory-mapping.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
+
+/// @endcond
+
+/**
+ * @defgroup mapped-file-group Memory-Mapped Files
+ * A type and functions for reading files via memory-mapping.
+ *
+ * @remarks A file is mapped read-only in its entirety once and an index of the
+ * offset of the start of every line is built so any line can be gotten in
+ * constant time without copying it.
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A memory-mapped file.
+ */
+struct mapped_file {
+  char const *buf;                      ///< File contents; not null-terminated.
+  size_t      size;                     ///< Size of \ref buf in bytes.
+  size_t     *line_offs;                ///< Offset in \ref buf of each line.
+  size_t      lines_len;                ///< Length of \ref line_offs.
+};
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Unmaps \a mf and frees its line index.
+ *
+ * @param mf The \ref mapped_file to close.  If `mf->buf` is NULL, does
+ * nothing.
+ *
+ * @sa mapped_file_open()
+ */
+void mapped_file_close( mapped_file_t *mf );
+
+/**
+ * Gets a line of \a mf.
+ *
+ * @param mf The \ref mapped_file to get the line of.
+ * @param line_no The 1-based line number of the line to get.  It must be
+ * &le; \ref mapped_file::lines_len "lines_len".
+ * @param rv_len A pointer to receive the length of the line including its
+ * terminating newline, if any.
+ * @return Returns a pointer to the start of the line.  Note that it is _not_
+ * null-terminated.
+ */
+NODISCARD
+char const* mapped_file_line( mapped_file_t const *mf, size_t line_no,
+                              size_t *rv_len );
+
+/**
+ * Maps the entire file referred to by \a fd into memory.
+ *
+ * @param mf The \ref mapped_file to initialize.
+ * @param fd The file descriptor of the file to map.
+ * @return Returns `true` only if the file was mapped.  It's not mapped if it's
+ * not a plain file, is empty, or can not be mapped for any reason, in which
+ * case the caller should simply read from it normally.
+ *
+ * @sa mapped_file_close()
+ */
+NODISCARD
+bool mapped_file_open( mapped_file_t *mf, int fd );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_mapped_file_H */
+/* vim:set et sw=2 ts=2: */
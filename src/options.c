@@ -62,7 +62,9 @@
 ////////// extern variables ///////////////////////////////////////////////////
 
 bool                opt_alt_tokens;
+char const         *opt_cache_dir;
 cdecl_debug_t       opt_cdecl_debug;
+char const         *opt_client_path;
 color_when_t        opt_color_when = COLOR_NOT_FILE;
 char const         *opt_config_path;
 bool                opt_east_const;
@@ -71,21 +73,27 @@ bool                opt_english_types = true;
 c_tid_t             opt_explicit_ecsu_btids = TB_struct | TB_union;
 char const         *opt_file = "-";
 c_graph_t           opt_graph;
+bool                opt_include_once;
 bool                opt_infer_command;
+unsigned            opt_jobs = 1;
+bool                opt_json_lines;
 c_lang_id_t         opt_lang_id;
+bool                opt_lazy_typedefs;
 unsigned            opt_lineno;
 bool                opt_permissive_types;
 predef_types_t      opt_predef_types = PREDEF_TYPES_ALL;
 bool                opt_prompt = true;
 bool                opt_read_config = true;
 bool                opt_semicolon = true;
+char const         *opt_server_path;
+bool                opt_stats;
 bool                opt_trailing_ret;
 bool                opt_using = true;
 c_ast_kind_t        opt_west_decl_kinds = K_ANY_FUNCTION_RETURN;
 
 ////////// extern constants ///////////////////////////////////////////////////
 
-char const          CDECL_TEST_ALL[]      = "cChm";
+char const          CDECL_TEST_ALL[]      = "cChmt";
 char const          OPT_CDECL_DEBUG_ALL[] = "u";
 char const          OPT_ECSU_ALL[]        = "ecsu";
 char const          OPT_WEST_DECL_ALL[]   = "bflost";
@@ -110,6 +118,8 @@ char const          OPT_WEST_DECL_ALL[]   = "bflost";
  * variable is `static` and accessible only via `*_explicit_int()` functions.
  *
  * @sa is_explicit_int()
+ * @sa options_restore()
+ * @sa options_save()
  * @sa parse_explicit_int()
  */
 static c_tid_t      opt_explicit_int_btids[] = { TB_NONE, TB_NONE };
@@ -237,6 +247,27 @@ void lang_set( c_lang_id_t lang_id ) {
   cdecl_prompt_init();                  // change prompt based on new language
 }
 
+void options_restore( options_snapshot_t const *snapshot ) {
+  assert( snapshot != NULL );
+  opt_east_const = snapshot->east_const;
+  opt_explicit_int_btids[0] = snapshot->explicit_int_btids[0];
+  opt_explicit_int_btids[1] = snapshot->explicit_int_btids[1];
+  if ( snapshot->lang_id != opt_lang_id )
+    lang_set( snapshot->lang_id );
+}
+
+void options_save( options_snapshot_t *snapshot ) {
+  assert( snapshot != NULL );
+  *snapshot = (options_snapshot_t){
+    .east_const = opt_east_const,
+    .explicit_int_btids = {
+      opt_explicit_int_btids[0],
+      opt_explicit_int_btids[1]
+    },
+    .lang_id = opt_lang_id
+  };
+}
+
 bool parse_cdecl_debug( char const *debug_format ) {
   if ( debug_format == NULL ) {
     opt_cdecl_debug = CDECL_DEBUG_NO;
@@ -284,9 +315,12 @@ cdecl_test_t parse_cdecl_test( char const *test_format ) {
       case 'm':
         t |= CDECL_TEST_NO_DYNAMIC_MACROS;
         break;
+      case 't':
+        t |= CDECL_TEST_NO_TIMING;
+        break;
       default:
         fatal_error( EX_USAGE,
-          "\"%s\": invalid value for CDECL_TEST; must be [cChm]+|*|-\n",
+          "\"%s\": invalid value for CDECL_TEST; must be [cChmt]+|*|-\n",
           test_format
         );
     } // switch
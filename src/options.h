@@ -54,6 +54,20 @@
  * @{
  */
 
+/**
+ * A snapshot of the options that may be overridden temporarily, e.g., for a
+ * single JSON Lines request.
+ *
+ * @sa options_restore()
+ * @sa options_save()
+ */
+struct options_snapshot {
+  bool        east_const;               ///< \ref opt_east_const.
+  c_tid_t     explicit_int_btids[2];    ///< Explicit `int` types.
+  c_lang_id_t lang_id;                  ///< \ref opt_lang_id.
+};
+typedef struct options_snapshot options_snapshot_t;
+
 // extern option variables
 extern bool         opt_alt_tokens;     ///< Print alternative tokens?
 
@@ -65,8 +79,13 @@ extern bool         opt_alt_tokens;     ///< Print alternative tokens?
 #define             opt_bison_debug     yydebug
 #endif /* ENABLE_BISON_DEBUG */
 
+/// Directory to cache results in across invocations, if any.  If it's the
+/// empty string, use the default directory.
+extern char const  *opt_cache_dir;
+
 extern cdecl_debug_t opt_cdecl_debug;   ///< Print JSON5 debug output?
 
+extern char const  *opt_client_path;    ///< Server socket path for client.
 extern color_when_t opt_color_when;     ///< When to print color.
 extern char const  *opt_config_path;    ///< Configuration file path.
 extern bool         opt_east_const;     ///< Print in "east const" form?
@@ -87,8 +106,12 @@ extern char const  *opt_file;           ///< Read from this file.
 #endif /* ENABLE_FLEX_DEBUG */
 
 extern c_graph_t    opt_graph;          ///< Di/Trigraph mode.
+extern bool         opt_include_once;   ///< Include each file at most once?
 extern bool         opt_infer_command;  ///< Infer command if none given?
+extern unsigned     opt_jobs;           ///< Parallel jobs for batch parsing.
+extern bool         opt_json_lines;     ///< Read & write JSON Lines?
 extern c_lang_id_t  opt_lang_id;        ///< Current language.
+extern bool         opt_lazy_typedefs;  ///< Define predefined types lazily?
 extern unsigned     opt_lineno;         ///< Add to all line numbers.
 
 /// Allow unknown names and keywords in other languages to be types?
@@ -97,7 +120,9 @@ extern bool         opt_permissive_types;
 extern predef_types_t opt_predef_types; ///< Which types to predefine.
 extern bool           opt_prompt;       ///< Print the prompt?
 extern bool           opt_read_config;  ///< Read configuration file?
+extern char const    *opt_server_path;  ///< Server socket path.
 extern bool           opt_semicolon;    ///< Print `;` at end of gibberish?
+extern bool           opt_stats;        ///< Print AST statistics at exit?
 extern bool           opt_trailing_ret; ///< Print trailing return type?
 extern bool           opt_using;        ///< Print `using` in C++11 and later?
 
@@ -189,6 +214,24 @@ bool is_explicit_int( c_tid_t btids );
  */
 void lang_set( c_lang_id_t lang_id );
 
+/**
+ * Restores options previously saved.
+ *
+ * @param snapshot The \ref options_snapshot to restore from.
+ *
+ * @sa options_save()
+ */
+void options_restore( options_snapshot_t const *snapshot );
+
+/**
+ * Saves the current options that may be overridden temporarily.
+ *
+ * @param snapshot The \ref options_snapshot to save into.
+ *
+ * @sa options_restore()
+ */
+void options_save( options_snapshot_t *snapshot );
+
 /**
  * Parses the **cdecl** debug option.
  *
@@ -225,6 +268,7 @@ bool parse_cdecl_debug( char const *debug_format );
  * `C`    | Ignore actual terminal columns and `COLUMNS`; always use 80.
  * `h`    | Do not read any file under the user's home directory by default.
  * `m`    | Return constant values for dynamic macros.
+ * `t`    | Report all timings as zero.
  *
  * Multiple formats may be given, one immediately after the other, e.g., `su`
  * means `struct` and `union`.  Alternatively, `*` may be given to mean "all"
@@ -26,6 +26,7 @@
 #include "color.h"
 #include "dump.h"
 #include "gibberish.h"
+#include "intern.h"
 #include "literals.h"
 #include "options.h"
 #include "p_kind.h"
@@ -411,6 +412,7 @@ static char const ARROW[] = "=>";       ///< Separates macro name from tokens.
 ////////// local variables ////////////////////////////////////////////////////
 
 static rb_tree_t  macro_set;            ///< Global set of macros.
+static unsigned   macro_set_gen;        ///< Changes to \ref macro_set.
 
 ////////// inline functions ///////////////////////////////////////////////////
 
@@ -2232,7 +2234,7 @@ static void mex_pre_filter___VA_OPT__( mex_state_t *mex ) {
       );
     }
     token->kind = P_IDENTIFIER;
-    token->ident.name = check_strdup( L_PRE___VA_OPT__ );
+    token->ident.name = intern_str( L_PRE___VA_OPT__ );
     token->ident.ineligible = true;
   } // for
 }
@@ -2662,6 +2664,8 @@ NODISCARD
 static int p_macro_cmp( p_macro_t const *i_macro, p_macro_t const *j_macro ) {
   assert( i_macro != NULL );
   assert( j_macro != NULL );
+  if ( i_macro->name == j_macro->name ) // interned names
+    return 0;
   return strcmp( i_macro->name, j_macro->name );
 }
 
@@ -2705,7 +2709,6 @@ static void p_macro_cleanup( p_macro_t *macro ) {
     free( macro->param_list );
     p_token_list_cleanup( &macro->replace_list );
   }
-  FREE( macro->name );
 }
 
 /**
@@ -2738,6 +2741,7 @@ static bool p_macro_check_params( p_macro_t const *macro ) {
   if ( last_param == NULL || last_param->name[0] != '.' )
     return true;
 
+  print_stderr_begin();
   show_macro( macro, stderr );
   print_error( &last_param->loc,
     "variadic macros not supported%s\n",
@@ -2944,13 +2948,17 @@ p_macro_t* p_macro_define( char *name, c_loc_t const *name_loc,
   assert( name != NULL );
   assert( name_loc != NULL );
 
-  if ( !macro_name_check( name, name_loc ) )
+  // Macro names are interned, so the given copy is no longer needed.
+  char const *const iname = intern_str( name );
+  free( name );
+
+  if ( !macro_name_check( iname, name_loc ) )
     goto error;
   if ( param_list != NULL && !macro_params_check( param_list ) )
     goto error;
 
   p_macro_t new_macro = {
-    .name = name,
+    .name = iname,
     .replace_list = slist_move( replace_list )
   };
   if ( param_list != NULL ) {
@@ -2987,13 +2995,13 @@ p_macro_t* p_macro_define( char *name, c_loc_t const *name_loc,
     assert( !old_macro->is_dynamic );
     p_macro_cleanup( old_macro );
     memcpy( rv_rbi.node->data, &new_macro, sizeof new_macro );
-    print_warning( name_loc, "\"%s\" already exists; redefined\n", name );
+    print_warning( name_loc, "\"%s\" already exists; redefined\n", iname );
   }
 
+  ++macro_set_gen;
   return RB_DINT( rv_rbi.node );
 
 error:
-  free( name );
   return NULL;
 }
 
@@ -3131,6 +3139,7 @@ bool p_macro_undef( char const *name, c_loc_t const *name_loc ) {
 
   p_macro_cleanup( macro );
   rb_tree_delete( &macro_set, found_rb );
+  ++macro_set_gen;
   return true;
 
 predef_macro:
@@ -3140,6 +3149,10 @@ predef_macro:
   return false;
 }
 
+unsigned p_macros_gen( void ) {
+  return macro_set_gen;
+}
+
 void p_macros_init( void ) {
   ASSERT_RUN_ONCE();
 
@@ -77,7 +77,7 @@ struct p_param {
  * C preprocessor macro.
  */
 struct p_macro {
-  char const         *name;             ///< Macro name.
+  char const         *name;             ///< Macro name (interned).
 
   /**
    * Is value dynamically generated?
@@ -135,8 +135,8 @@ void p_arg_list_cleanup( p_arg_list_t *arg_list );
 /**
  * Defines a new \ref p_macro.
  *
- * @param name The name of the macro to define.  Ownership is taken only if the
- * macro is defined successfully.
+ * @param name The name of the macro to define.  Ownership is taken.  It's
+ * interned, then freed.
  * @param name_loc The source location of \a name.
  * @param param_list The parameter list, if any.  Parameters are moved out of
  * the list only if the macro is defined successfully.
@@ -223,6 +223,17 @@ inline p_macro_t const* p_macro_iterator_next( p_macro_iterator_t *iter ) {
 NODISCARD
 bool p_macro_undef( char const *name, c_loc_t const *name_loc );
 
+/**
+ * Gets the generation of the set of all macros, i.e., a number that changes
+ * whenever any macro is either defined or undefined.
+ *
+ * @return Returns said generation.
+ *
+ * @sa c_typedefs_gen()
+ */
+NODISCARD
+unsigned p_macros_gen( void );
+
 /**
  * Initializes all C preprocessor macro data.
  *
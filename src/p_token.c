@@ -25,6 +25,7 @@
 #include "cdecl_parser.h"
 #include "color.h"
 #include "gibberish.h"
+#include "intern.h"
 #include "lexer.h"
 #include "literals.h"
 #include "p_kind.h"
@@ -298,7 +299,7 @@ p_token_t* p_token_dup( p_token_t const *token ) {
       break;
     case P_IDENTIFIER:
       dup_token->ident.ineligible = token->ident.ineligible;
-      dup_token->ident.name = check_strdup( token->ident.name );
+      dup_token->ident.name = token->ident.name;
       break;
     case P_OTHER:
       dup_token->other.value = token->other.value;
@@ -328,8 +329,6 @@ void p_token_free( p_token_t *token ) {
       FREE( token->lit.value );
       break;
     case P_IDENTIFIER:
-      FREE( token->ident.name );
-      break;
     case P_CONCAT:
     case P_OTHER:
     case P_PLACEMARKER:
@@ -680,7 +679,8 @@ p_token_t* p_token_new_loc( p_token_kind_t kind, c_loc_t const *loc,
       break;
     case P_IDENTIFIER:
       assert( literal != NULL );
-      token->ident.name = literal;
+      token->ident.name = intern_str( literal );
+      FREE( literal );
       break;
     case P_OTHER:
       assert( literal != NULL );
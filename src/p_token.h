@@ -66,7 +66,7 @@ struct p_token {
      * #P_IDENTIFIER members.
      */
     struct {
-      char const *name;                 ///< Identifier name.
+      char const *name;                 ///< Identifier name (interned).
 
       /**
        * Ineligible for expansion?
@@ -271,6 +271,7 @@ void p_token_list_trim( p_token_list_t *token_list );
  * The literal for the token, if any.  If \a kind is:
  *  + #P_CHAR_LIT, #P_IDENTIFIER, #P_NUM_LIT, or #P_STR_LIT, ownership of \a
  *    literal is taken (so it might need to be duplicated first);
+ *  + #P_IDENTIFIER, \a literal is interned, then freed;
  *
  * Otherwise, ownership of \a literal is _not_ taken; however, if \a kind is:
  *  + #P_OTHER, only \a literal<code>[0]</code> is copied;
@@ -467,6 +468,7 @@ p_token_list_t* p_token_list_new_placemarker( void );
  * The literal for the token, if any.  If \a kind is:
  *  + #P_CHAR_LIT, #P_IDENTIFIER, #P_NUM_LIT, or #P_STR_LIT, ownership of \a
  *    literal is taken (so it might need to be duplicated first);
+ *  + #P_IDENTIFIER, \a literal is interned, then freed;
  *
  * Otherwise, ownership of \a literal is _not_ taken; however, if \a kind is:
  *  + #P_OTHER, only \a literal<code>[0]</code> is copied;
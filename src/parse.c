@@ -26,17 +26,21 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "parse.h"
+#include "batch.h"
+#include "c_typedef.h"
 #include "cdecl.h"
 #include "cdecl_command.h"
 #include "cdecl_dym.h"
 #include "cdecl_parser.h"
 #include "help.h"
 #include "lexer.h"
+#include "mapped_file.h"
 #include "options.h"
 #include "p_macro.h"
 #include "print.h"
 #include "prompt.h"
 #include "read_line.h"
+#include "result_cache.h"
 #include "strbuf.h"
 #include "types.h"
 #include "util.h"
@@ -146,6 +150,30 @@ static bool no_infer_command( char const *s ) {
   } // switch
 }
 
+/**
+ * Concatenates \a command, if any, and the arguments into a single command
+ * string.
+ *
+ * @param command The **cdecl** command, but only if its \ref
+ * cdecl_command::kind "kind" is #CDECL_COMMAND_PROG_NAME; NULL otherwise.
+ * @param cli_count The size of \a cli_value.
+ * @param cli_value The argument values, if any.
+ * @param sbuf The \ref strbuf to append onto.
+ */
+static void cdecl_cli_command( char const *command, size_t cli_count,
+                               char const *const cli_value[cli_count],
+                               strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+  bool space;
+
+  // If command wasn't cdecl or c++decl, start the command string with it.
+  if ( (space = command != NULL) )
+    strbuf_puts( sbuf, command );       // LCOV_EXCL_LINE
+  // Concatenate arguments, if any, into a single string.
+  for ( size_t i = 0; i < cli_count; ++i )
+    strbuf_sepc_puts( sbuf, ' ', &space, cli_value[i] );
+}
+
 /**
  * Parses a **cdecl** command.
  *
@@ -167,15 +195,8 @@ static int cdecl_parse_command( char const *command, size_t cli_count,
     return cdecl_parse_stdin();         // invoked as just cdecl, no arguments
 
   strbuf_t sbuf;
-  bool space;
-
   strbuf_init( &sbuf );
-  // If command wasn't cdecl or c++decl, start the command string with it.
-  if ( (space = command != NULL) )
-    strbuf_puts( &sbuf, command );      // LCOV_EXCL_LINE
-  // Concatenate arguments, if any, into a single string.
-  for ( size_t i = 0; i < cli_count; ++i )
-    strbuf_sepc_puts( &sbuf, ' ', &space, cli_value[i] );
+  cdecl_cli_command( command, cli_count, cli_value, &sbuf );
 
   //
   // At this point, we know we're not running interactively.
@@ -193,9 +214,64 @@ static int cdecl_parse_command( char const *command, size_t cli_count,
   return rv_parse;
 }
 
+/**
+ * Parses **cdecl** commands from \a mf.
+ *
+ * @remarks Each line is gotten directly from \a mf rather than read via
+ * **getline**(3), but is otherwise treated exactly as strbuf_read_line()
+ * would: trailing whitespace is trimmed and continued lines are joined.
+ *
+ * @param mf The \ref mapped_file to parse.
+ * @param return_on_error If `true`, return immediately upon encountering an
+ * error; if `false`, return only upon encountering EOF.
+ * @return Returns `EX_OK` upon success of the last line read or another value
+ * upon failure.
+ */
+NODISCARD
+static int cdecl_parse_mapped_file( mapped_file_t const *mf,
+                                    bool return_on_error ) {
+  assert( mf != NULL );
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+  bool is_cont_line = false;
+  int rv_parse = EX_OK;
+
+  for ( size_t line_no = 1; line_no <= mf->lines_len; ++line_no ) {
+    size_t line_len;
+    char const *const line = mapped_file_line( mf, line_no, &line_len );
+    strn_rtrim( line, &line_len );
+    is_cont_line = cdecl_is_cont_line( line, &line_len );
+    strbuf_putsn( &sbuf, line, line_len );
+    if ( is_cont_line ) {
+      if ( line_no < mf->lines_len )
+        ++yylineno;
+      continue;
+    }
+    strbuf_putc( &sbuf, '\n' );
+    rv_parse = cdecl_parse_string( sbuf.str, sbuf.len );
+    if ( rv_parse != EX_OK && return_on_error )
+      break;
+    strbuf_reset( &sbuf );
+  } // for
+
+  if ( is_cont_line ) {
+    // The last line was continued, but there are no more lines: parse what
+    // there is of it anyway.
+    strbuf_putc( &sbuf, '\n' );
+    rv_parse = cdecl_parse_string( sbuf.str, sbuf.len );
+  }
+
+  strbuf_cleanup( &sbuf );
+  return rv_parse;
+}
+
 /**
  * Parses **cdecl** commands from \a fin.
  *
+ * @remarks If \a fin is a plain file that hasn't been read from yet, it's
+ * memory-mapped and parsed via cdecl_parse_mapped_file().
+ *
  * @param fin The `FILE` to read from.
  * @param return_on_error If `true`, return immediately upon encountering an
  * error; if `false`, return only upon encountering EOF.
@@ -206,11 +282,22 @@ NODISCARD
 static int cdecl_parse_file_impl( FILE *fin, bool return_on_error ) {
   assert( fin != NULL );
 
+  yylineno = 1;                         // reset before reading any file
+
+  int rv_parse;
+  mapped_file_t mf;
+
+  if ( ftello( fin ) == 0 && mapped_file_open( &mf, fileno( fin ) ) ) {
+    rv_parse = cdecl_parse_mapped_file( &mf, return_on_error );
+    mapped_file_close( &mf );
+    // Leave fin at EOF as if it had been read normally.
+    PJL_DISCARD_RV( fseeko( fin, 0, SEEK_END ) );
+    return rv_parse;
+  }
+
   strbuf_t sbuf;
   strbuf_init( &sbuf );
-  int rv_parse = EX_OK;
-
-  yylineno = 1;                         // reset before reading any file
+  rv_parse = EX_OK;
 
   while ( strbuf_read_line( &sbuf, fin, &cdecl_prompt, &cdecl_is_cont_line,
                             &yylineno ) ) {
@@ -261,6 +348,8 @@ static int cdecl_parse_stdin( void ) {
   cdecl_is_interactive = isatty( STDIN_FILENO );
   if ( cdecl_is_interactive && opt_prompt )
     PUTS( "Type \"help\" or \"?\" for help\n" );  // LCOV_EXCL_LINE
+  if ( !cdecl_is_interactive && opt_jobs > 1 )
+    return cdecl_parse_batch( stdin, &cdecl_is_cont_line );
   return cdecl_parse_file_impl( stdin, /*return_on_error=*/false );
 }
 
@@ -306,6 +395,7 @@ int cdecl_parse_cli( size_t cli_count,
   return cdecl_parse_command( command_literal, cli_count, cli_value );
 
 invalid_command:
+  print_stderr_begin();
   EPRINTF(
     "%s: \"%s\": invalid command (as %s)",
     prog_name, find_what, invalid_as
@@ -317,6 +407,56 @@ invalid_command:
   return EX_USAGE;
 }
 
+bool cdecl_parse_cli_cached( size_t cli_count,
+                             char const *const cli_value[cli_count] ) {
+  char const *command_literal = NULL;
+
+  if ( is_cdecl() || is_cppdecl() ) {
+    if ( cli_count == 0 )
+      return false;
+  }
+  else {
+    cdecl_command_t const *const command = cdecl_command_find( prog_name );
+    if ( command == NULL || command->kind != CDECL_COMMAND_PROG_NAME )
+      return false;
+    command_literal = prog_name;
+  }
+
+  strbuf_t sbuf, result_sbuf;
+  strbuf_init( &sbuf );
+  strbuf_init( &result_sbuf );
+  cdecl_cli_command( command_literal, cli_count, cli_value, &sbuf );
+
+  //
+  // Echoing the command needs the prompt after initialization, so if it isn't
+  // in the cache directory, the command can't be answered from it either.
+  //
+  strbuf_t prompt_sbuf;
+  strbuf_init( &prompt_sbuf );
+  bool const found =
+    (!opt_echo_commands || result_cache_dir_find_prompt( &prompt_sbuf )) &&
+    result_cache_dir_find( sbuf.str, sbuf.len, &result_sbuf );
+  if ( found ) {
+    if ( opt_echo_commands ) {
+      // Echo the command exactly as cdecl_parse_string() would.
+      size_t echo_len = sbuf.len;
+      strn_rtrim( sbuf.str, &echo_len );
+      PRINTF(
+        "%s%.*s\n",
+        empty_if_null( prompt_sbuf.str ),
+        STATIC_CAST( int, echo_len ), sbuf.str
+      );
+    }
+    if ( result_sbuf.len > 0 )
+      FPUTS( result_sbuf.str, stdout );
+  }
+
+  strbuf_cleanup( &sbuf );
+  strbuf_cleanup( &prompt_sbuf );
+  strbuf_cleanup( &result_sbuf );
+  return found;
+}
+
 int cdecl_parse_file( FILE *fin ) {
   return cdecl_parse_file_impl( fin, /*return_on_error=*/true );
 }
@@ -324,6 +464,9 @@ int cdecl_parse_file( FILE *fin ) {
 int cdecl_parse_string( char const *s, size_t s_len ) {
   assert( s != NULL );
 
+  // This must be done first since it itself calls cdecl_parse_string().
+  c_typedefs_define_lazy( s, s_len );
+
   // The code in print.c relies on command_line being set, so set it.
   print_params.command_line = s;
   print_params.command_line_len = s_len;
@@ -377,8 +520,41 @@ int cdecl_parse_string( char const *s, size_t s_len ) {
     FFLUSH( stdout );
   }
 
-  bool const ok = yyparse_sn( s, s_len );
+  result_cache_query_t rcq;
+  bool const is_cacheable = result_cache_query_init( &rcq, s, s_len );
+  char const *const cached_result =
+    is_cacheable ? result_cache_find( &rcq ) : NULL;
+
+  bool ok = true;
+  if ( cached_result != NULL ) {
+    FPUTS( cached_result, stdout );
+    print_stdout_flush();
+    //
+    // The lexer would have counted the newline(s), so do the same.
+    //
+    for ( char const *nl = s;
+          (nl = memchr( nl, '\n', STATIC_CAST( size_t, s + s_len - nl ) ));
+          ++nl ) {
+      ++yylineno;
+    } // for
+  }
+  else if ( is_cacheable ) {
+    strbuf_t result_sbuf;
+    strbuf_init( &result_sbuf );
+    print_result_capture_begin( &result_sbuf );
+    ok = yyparse_sn( s, s_len );
+    if ( print_result_capture_end() && ok )
+      result_cache_add( &rcq, &result_sbuf );
+    strbuf_cleanup( &result_sbuf );
+    print_stdout_flush();
+  }
+  else {
+    ok = yyparse_sn( s, s_len );
+    print_stdout_flush();
+  }
 
+  if ( is_cacheable )
+    result_cache_query_cleanup( &rcq );
   if ( infer_command ) {
     strbuf_cleanup( &sbuf );
     print_params.inserted_len = 0;
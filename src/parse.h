@@ -45,6 +45,26 @@
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+/**
+ * Prints the result of the command given on the command-line, if any, from the
+ * cache directory.
+ *
+ * @remarks This may be called before **cdecl** is otherwise initialized, but
+ * only after result_cache_dir_init().  If \ref opt_echo_commands is set, the
+ * command is echoed first exactly as cdecl_parse_cli() would.
+ *
+ * @param cli_count The size of \a cli_value.
+ * @param cli_value The command-line argument values, if any.  Note that,
+ * unlike `main()`'s `argv`, this contains _only_ the command-line arguments
+ * _after_ the program name.
+ * @return Returns `true` only if the result was printed.
+ *
+ * @sa cdecl_parse_cli()
+ */
+NODISCARD
+bool cdecl_parse_cli_cached( size_t cli_count,
+                             char const *const cli_value[cli_count] );
+
 /**
  * Parses the command-line.
  *
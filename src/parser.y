@@ -66,6 +66,7 @@
 #include "set_options.h"
 #include "show.h"
 #include "slist.h"
+#include "strbuf.h"
 #include "types.h"
 #include "util.h"
 
@@ -97,6 +98,16 @@
 
 /// @endcond
 
+/**
+ * The maximum depth of Bison's parser stack.
+ *
+ * @remarks Each level of nesting of a declaration uses a few entries of the
+ * stack, so Bison's default of 10,000 would limit declarations to being nested
+ * only a few thousand levels deep.  Since ASTs are traversed iteratively, this
+ * is the only limit on nesting.  The stack grows only as needed.
+ */
+#define YYMAXDEPTH                200000
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -591,14 +602,13 @@ PJL_DISCARD
 static bool print_error_token( char const* );
 
 // local variables
-static c_ast_list_t   gc_ast_list;      ///< c_ast nodes freed after parse.
+static c_ast_arena_t  ast_arena;        ///< c_ast nodes freed after parse.
 static in_attr_t      in_attr;          ///< Inherited attributes.
-static c_ast_list_t   typedef_ast_list; ///< List of ASTs for `typedef`s.
 
 ////////// inline functions ///////////////////////////////////////////////////
 
 /**
- * Duplicates \a ast and adds it to \ref gc_ast_list.
+ * Duplicates \a ast allocating it from \ref ast_arena.
  *
  * @param ast The AST to duplicate.
  * @return Returns the duplicated AST.
@@ -606,24 +616,11 @@ static c_ast_list_t   typedef_ast_list; ///< List of ASTs for `typedef`s.
  * @sa c_ast_new_gc()
  */
 static inline c_ast_t* c_ast_dup_gc( c_ast_t const *ast ) {
-  return c_ast_dup( ast, &gc_ast_list );
+  return c_ast_dup( ast, &ast_arena );
 }
 
 /**
- * Garbage-collects the AST nodes on \a ast_list but does _not_ free \a
- * ast_list itself.
- *
- * @param ast_list The AST list to free the nodes of.
- *
- * @sa c_ast_dup_gc()
- * @sa c_ast_new_gc()
- */
-static inline void c_ast_list_cleanup_gc( c_ast_list_t *ast_list ) {
-  slist_cleanup( ast_list, POINTER_CAST( slist_free_fn_t, &c_ast_free ) );
-}
-
-/**
- * Creates a new AST and adds it to \ref gc_ast_list.
+ * Creates a new AST allocating it from \ref ast_arena.
  *
  * @param kind The kind of AST to create.
  * @param loc A pointer to the token location data.
@@ -633,7 +630,7 @@ static inline void c_ast_list_cleanup_gc( c_ast_list_t *ast_list ) {
  */
 NODISCARD
 static inline c_ast_t* c_ast_new_gc( c_ast_kind_t kind, c_loc_t const *loc ) {
-  return c_ast_new( kind, in_attr.ast_depth, loc, &gc_ast_list );
+  return c_ast_new( kind, in_attr.ast_depth, loc, &ast_arena );
 }
 
 /**
@@ -657,7 +654,7 @@ static inline void gibberish_to_english( void ) {
  */
 NODISCARD
 static inline c_ast_t* ia_type_ast_peek( void ) {
-  return slist_front( &in_attr.type_ast_stack );
+  return c_ast_list_back( &in_attr.type_ast_stack );
 }
 
 /**
@@ -671,7 +668,7 @@ static inline c_ast_t* ia_type_ast_peek( void ) {
  */
 PJL_DISCARD
 static inline c_ast_t* ia_type_ast_pop( void ) {
-  c_ast_t *const ast = slist_pop_front( &in_attr.type_ast_stack );
+  c_ast_t *const ast = c_ast_list_pop_back( &in_attr.type_ast_stack );
   assert( ast != NULL );
   return ast;
 }
@@ -718,37 +715,6 @@ static void attr_syntax_not_supported( char const *keyword,
     EPUTC( '\n' );
 }
 
-/**
- * A predicate function for slist_free_if() that checks whether \a ast is one
- * that can be garbage collected: if so, c_ast_free()s it.
- *
- * @param ast_node The \ref slist_node pointing to the AST to check.
- * @param data Contains the AST of the type being declared.
- * @return Returns `true` only if \a ast should be removed from the list.
- */
-NODISCARD
-static bool c_ast_free_if_garbage( slist_node_t *ast_node, void *data ) {
-  assert( ast_node != NULL );
-  c_ast_t *const ast = ast_node->data;
-  assert( ast != NULL );
-  c_ast_t const *const type_ast = data;
-  assert( type_ast != NULL );
-
-  if ( ast == type_ast || !c_ast_is_orphan( ast ) ) {
-    assert( ast->kind != K_PLACEHOLDER );
-    return false;
-  }
-
-  // We also need to ensure the AST isn't in the type_ast_stack.
-  FOREACH_SLIST_NODE( type_node, &in_attr.type_ast_stack ) {
-    if ( ast == type_node->data )
-      return false;
-  } // for
-
-  c_ast_free( ast );
-  return true;
-}
-
 /**
  * Checks whether `typename` is OK since the type's name is a qualified name.
  *
@@ -785,7 +751,7 @@ static bool c_ast_set_bit_field_width( c_ast_t *ast, unsigned bit_width ) {
   if ( bit_width > 0 ) {
     if ( !c_ast_is_integral( ast ) ) {
       print_error( &ast->loc, "invalid bit-field type " );
-      print_ast_type_aka( ast, stderr );
+      print_ast_type_aka( ast, EFILE );
       EPRINTF( "; must be an integral %stype\n",
         OPT_LANG_IS( enum_BITFIELDS ) ? "or enumeration " : ""
       );
@@ -819,20 +785,11 @@ static bool define_type( c_ast_t const *type_ast, decl_flags_t decl_flags ) {
 
   if ( tdef->ast == type_ast ) {
     //
-    // Type was added: we have to move the AST from the gc_ast_list so it won't
-    // be garbage collected at the end of the parse to a separate
-    // typedef_ast_list that's freed only at program termination.
+    // Type was added: we have to keep all AST nodes allocated so far from the
+    // ast_arena so they won't be garbage collected at the end of the parse,
+    // but instead freed only at program termination.
     //
-    // But first, garbage collect all orphaned AST nodes.  (For a non-type-
-    // defining parse, this step isn't necessary since all nodes are freed at
-    // the end of the parse anyway.)
-    //
-    slist_free_if(
-      &gc_ast_list,
-      &c_ast_free_if_garbage,
-      CONST_CAST( void*, type_ast )
-    );
-    slist_push_list_back( &typedef_ast_list, &gc_ast_list );
+    c_ast_arena_keep( &ast_arena );
     return true;
   }
 
@@ -862,9 +819,9 @@ static bool define_type( c_ast_t const *type_ast, decl_flags_t decl_flags ) {
     );
   } else {
     print_error( &type_ast->loc, "type " );
-    print_ast_type_aka( type_ast, stderr );
+    print_ast_type_aka( type_ast, EFILE );
     EPUTS( " redefinition incompatible with original type \"" );
-    print_type_ast( tdef, stderr );
+    print_type_ast( tdef, EFILE );
     EPUTS( "\"\n" );
   }
 
@@ -876,9 +833,9 @@ static bool define_type( c_ast_t const *type_ast, decl_flags_t decl_flags ) {
  */
 static void ia_cleanup( void ) {
   c_sname_cleanup( &in_attr.scope_sname );
-  // Do _not_ pass &c_ast_free for the 2nd argument! All AST nodes were already
-  // free'd from the gc_ast_list in parse_cleanup(). Just free the slist nodes.
-  slist_cleanup( &in_attr.type_ast_stack, /*free_fn=*/NULL );
+  // All AST nodes were already free'd by resetting the ast_arena in
+  // parse_cleanup(). This just frees the stack itself.
+  c_ast_list_cleanup( &in_attr.type_ast_stack );
   in_attr = (in_attr_t){ 0 };
 }
 
@@ -897,7 +854,7 @@ static void ia_cleanup( void ) {
  */
 static void ia_type_ast_push( c_ast_t *ast ) {
   assert( ast != NULL );
-  slist_push_front( &in_attr.type_ast_stack, ast );
+  c_ast_list_push_back( &in_attr.type_ast_stack, ast );
   if ( in_attr.type_spec_ast != NULL )
     return;
   if ( (ast->kind & K_ANY_TYPE_SPECIFIER) != 0 )
@@ -964,9 +921,9 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
     //
     if ( !c_ast_equal( type_ast, raw_decl_ast ) ) {
       print_error( &decl_ast->loc, "type " );
-      print_ast_type_aka( type_ast, stderr );
+      print_ast_type_aka( type_ast, EFILE );
       EPUTS( " redefinition incompatible with original type " );
-      print_ast_type_aka( decl_ast, stderr );
+      print_ast_type_aka( decl_ast, EFILE );
       EPUTC( '\n' );
       return NULL;
     }
@@ -986,14 +943,14 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
   c_type_or_eq( &ast->type, &type );
 
   if ( in_attr.align.kind != C_ALIGNAS_NONE ) {
-    ast->align = in_attr.align;
+    c_ast_set_align( ast, &in_attr.align );
     if ( c_tid_is_any( type.stids, TS_typedef ) ) {
       //
       // We check for illegal aligned typedef here rather than in c_ast_check.c
       // because the "typedef-ness" needed to be removed previously before the
       // eventual call to c_ast_check().
       //
-      print_error( &ast->align.loc, "typedef can not be aligned\n" );
+      print_error( &in_attr.align.loc, "typedef can not be aligned\n" );
       return NULL;
     }
   }
@@ -1075,7 +1032,7 @@ static bool l_c_sname_is_type( int line, c_sname_t const *sname,
       "\"%s\": previously declared as type \"",
       c_sname_gibberish( sname )
     );
-    print_type_ast( tdef, stderr );
+    print_type_ast( tdef, EFILE );
     EPUTS( "\"\n" );
   }
 
@@ -1236,8 +1193,9 @@ static void parse_cleanup( bool is_fatal_error ) {
     ++yylineno;
   }
 
-  c_ast_list_cleanup_gc( &gc_ast_list );
+  c_ast_arena_reset( &ast_arena );
   ia_cleanup();
+  print_result_flush();
 }
 
 /**
@@ -1279,9 +1237,9 @@ static void yyerror( char const *msg ) {
   c_loc_t const loc = lexer_loc();
   print_loc( &loc );
 
-  color_start( stderr, sgr_error );
+  color_start( EFILE, sgr_error );
   EPUTS( msg );                         // no newline
-  color_end( stderr, sgr_error );
+  color_end( EFILE, sgr_error );
 
   //
   // A syntax error has occurred, but syntax errors aren't fatal since Bison
@@ -1368,6 +1326,7 @@ static void yyerror( char const *msg ) {
 %token              Y_bits
 %token              Y_by
 %token              Y_bytes
+%token              Y_cache
 %token              Y_capturing
 %token              Y_commands
 %token              Y_constructor
@@ -1962,9 +1921,9 @@ static void yyerror( char const *msg ) {
 //
 // Bison %destructors.
 //
-// Clean-up of AST nodes is done via garbage collection using gc_ast_list.
+// Clean-up of AST nodes is done via garbage collection using ast_arena.
 //
-%destructor { DTRACE; slist_cleanup( &$$, /*free_fn=*/NULL ); } <ast_list>
+%destructor { DTRACE; c_ast_list_cleanup( &$$ );              } <ast_list>
 %destructor { DTRACE; FREE( $$ );                             } <name>
 %destructor { DTRACE; p_arg_list_cleanup( $$ );   FREE( $$ ); } <p_arg_list>
 %destructor { DTRACE; p_param_free( $$ );                     } <p_param>
@@ -2040,7 +1999,7 @@ cast_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, stdout );
+      c_ast_gibberish_sbuf( cast_ast, C_GIB_PRINT_CAST, print_result_sbuf() );
     }
 
     /*
@@ -2065,7 +2024,7 @@ cast_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, stdout );
+      c_ast_gibberish_sbuf( cast_ast, C_GIB_PRINT_CAST, print_result_sbuf() );
     }
   ;
 
@@ -2177,16 +2136,18 @@ declare_command
           decl_flags_t decl_flags = C_GIB_PRINT_DECL;
           if ( opt_semicolon )
             decl_flags |= C_GIB_OPT_SEMICOLON;
-          c_ast_gibberish( $decl_ast, decl_flags, stdout );
+          c_ast_gibberish_sbuf( $decl_ast, decl_flags, print_result_sbuf() );
         }
         else {
-          c_ast_sname_list_gibberish( $decl_ast, &$sname_list, stdout );
+          c_ast_sname_list_gibberish_sbuf(
+            $decl_ast, &$sname_list, print_result_sbuf()
+          );
         }
       }
 
       c_sname_list_cleanup( &$sname_list );
       PARSE_ASSERT( ok );
-      PUTC( '\n' );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
     /*
@@ -2241,7 +2202,7 @@ declare_command
       );
       oper_ast->oper.operator = operator;
       c_ast_list_set_param_of( &$param_ast_list, oper_ast );
-      oper_ast->oper.param_ast_list = slist_move( &$param_ast_list );
+      oper_ast->oper.param_ast_list = c_ast_list_move( &$param_ast_list );
       oper_ast->oper.member = $member;
       c_ast_set_parent( $ret_ast, oper_ast );
 
@@ -2249,8 +2210,8 @@ declare_command
       decl_flags_t decl_flags = C_GIB_PRINT_DECL;
       if ( opt_semicolon )
         decl_flags |= C_GIB_OPT_SEMICOLON;
-      c_ast_gibberish( oper_ast, decl_flags, stdout );
-      PUTC( '\n' );
+      c_ast_gibberish_sbuf( oper_ast, decl_flags, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
   /*
@@ -2275,17 +2236,17 @@ declare_command
       c_ast_t *const lambda_ast = c_ast_new_gc( K_LAMBDA, &@Y_lambda );
       lambda_ast->type = $store_type;
       c_ast_list_set_param_of( &$capture_ast_list, lambda_ast );
-      lambda_ast->lambda.capture_ast_list = slist_move( &$capture_ast_list );
+      lambda_ast->lambda.capture_ast_list = c_ast_list_move( &$capture_ast_list );
       c_ast_list_set_param_of( &$param_ast_list, lambda_ast );
-      lambda_ast->lambda.param_ast_list = slist_move( &$param_ast_list );
+      lambda_ast->lambda.param_ast_list = c_ast_list_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, lambda_ast );
 
       DUMP_AST( "$$_ast", lambda_ast );
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( lambda_ast ) );
-      c_ast_gibberish( lambda_ast, C_GIB_PRINT_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_gibberish_sbuf( lambda_ast, C_GIB_PRINT_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
     /*
@@ -2319,8 +2280,8 @@ declare_command
       decl_flags_t decl_flags = C_GIB_PRINT_DECL;
       if ( opt_semicolon )
         decl_flags |= C_GIB_OPT_SEMICOLON;
-      c_ast_gibberish( udc_ast, decl_flags, stdout );
-      PUTC( '\n' );
+      c_ast_gibberish_sbuf( udc_ast, decl_flags, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
   | Y_declare error
@@ -2343,7 +2304,7 @@ alignas_or_width_decl_english_ast
       DUMP_ALIGN( "alignas_specifier_english", $align );
 
       $$ = $decl_ast;
-      $$->align = $align;
+      c_ast_set_align( $$, &$align );
       $$->loc = @$;
 
       DUMP_AST( "$$_ast", $$ );
@@ -2363,7 +2324,7 @@ alignas_or_width_decl_english_ast
       //
       if ( !c_ast_is_integral( $decl_ast ) ) {
         print_error( &@bit_width, "invalid bit-field type " );
-        print_ast_type_aka( $decl_ast, stderr );
+        print_ast_type_aka( $decl_ast, EFILE );
         EPRINTF( "; must be an integral %stype\n",
           OPT_LANG_IS( enum_BITFIELDS ) ? "or enumeration " : ""
         );
@@ -2425,7 +2386,7 @@ aligned_english
   ;
 
 capturing_paren_capture_decl_list_english_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | Y_capturing paren_capture_decl_list_english[capture_decl_ast_list]
     {
       $$ = $capture_decl_ast_list;
@@ -2447,13 +2408,13 @@ paren_capture_decl_list_english
     }
   | error
     {
-      slist_init( &$$ );
+      c_ast_list_init( &$$ );
       elaborate_error( "'[' or '(' expected\n" );
     }
   ;
 
 capture_decl_list_english_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | capture_decl_list_english
   ;
 
@@ -2467,7 +2428,7 @@ capture_decl_list_english
       DUMP_AST( "capture_decl_english_ast", $capture_decl_ast );
 
       $$ = $capture_decl_ast_list;
-      slist_push_back( &$$, $capture_decl_ast );
+      c_ast_list_push_back( &$$, $capture_decl_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -2479,8 +2440,8 @@ capture_decl_list_english
                   "capture_decl_english_ast" );
       DUMP_AST( "capture_decl_english_ast", $capture_decl_ast );
 
-      slist_init( &$$ );
-      slist_push_back( &$$, $capture_decl_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $capture_decl_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -3129,7 +3090,7 @@ explain_command
   | explain pc99_pointer_decl_list_c[decl_ast_list]
     {
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english_sbuf( &$decl_ast_list, print_result_sbuf() );
     }
 
     /*
@@ -3180,8 +3141,8 @@ explain_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( $decl_ast ) );
-      c_ast_english( $decl_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( $decl_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
     /*
@@ -3341,7 +3302,7 @@ p_define
             "\"%s\" previously defined as type (\"",
             $name
           );
-          print_type_decl( tdef, tdef->decl_flags, stderr );
+          print_type_decl( tdef, tdef->decl_flags, EFILE );
           EPUTS( "\")\n" );
         }
       }
@@ -3587,6 +3548,11 @@ show_command
       PARSE_ASSERT( ok );
     }
 
+  | Y_show Y_cache
+    {
+      show_cache( stdout );
+    }
+
   | Y_show show_which_opt[show] Y_macros
     {
       show_macros( $show, stdout );
@@ -3728,8 +3694,8 @@ c_style_cast_expr_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_english( cast_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( cast_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
     /*
@@ -3744,7 +3710,7 @@ c_style_cast_expr_c
   | '(' pc99_pointer_decl_list_c[decl_ast_list] rparen_exp
     {
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english_sbuf( &$decl_ast_list, print_result_sbuf() );
     }
   ;
 
@@ -3777,8 +3743,8 @@ new_style_cast_expr_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_english( cast_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( cast_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -4229,22 +4195,22 @@ lambda_declaration_c
       c_ast_t *const lambda_ast = c_ast_new_gc( K_LAMBDA, &@$ );
       lambda_ast->type = $type;
       c_ast_list_set_param_of( &$capture_ast_list, lambda_ast );
-      lambda_ast->lambda.capture_ast_list = slist_move( &$capture_ast_list );
+      lambda_ast->lambda.capture_ast_list = c_ast_list_move( &$capture_ast_list );
       c_ast_list_set_param_of( &$param_ast_list, lambda_ast );
-      lambda_ast->lambda.param_ast_list = slist_move( &$param_ast_list );
+      lambda_ast->lambda.param_ast_list = c_ast_list_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, lambda_ast );
 
       DUMP_AST( "$$_ast", lambda_ast );
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( lambda_ast ) );
-      c_ast_english( lambda_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( lambda_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
 capture_decl_list_c_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | capture_decl_list_c
   ;
 
@@ -4259,7 +4225,7 @@ capture_decl_list_c
       DUMP_AST( "capture_decl_c_ast", $capture_ast );
 
       $$ = $capture_ast_list;
-      slist_push_back( &$$, $capture_ast );
+      c_ast_list_push_back( &$$, $capture_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -4271,8 +4237,8 @@ capture_decl_list_c
                   "capture_decl_c_ast" );
       DUMP_AST( "capture_decl_c_ast", $capture_decl_ast );
 
-      slist_init( &$$ );
-      slist_push_back( &$$, $capture_decl_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $capture_decl_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -4463,8 +4429,8 @@ user_defined_conversion_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( $decl_astp.ast ) );
-      c_ast_english( $decl_astp.ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( $decl_astp.ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -4625,10 +4591,12 @@ decl_list_c_opt
 
       PARSE_ASSERT( c_ast_check( type_ast ) );
       if ( is_structured_binding )
-        c_ast_english( type_ast, C_ENG_DECL, stdout );
+        c_ast_english_sbuf( type_ast, C_ENG_DECL, print_result_sbuf() );
       else
-        c_typedef_english( &C_TYPEDEF_LIT( type_ast, C_ENG_DECL ), stdout );
-      PUTC( '\n' );
+        c_typedef_english_sbuf(
+          &C_TYPEDEF_LIT( type_ast, C_ENG_DECL ), print_result_sbuf()
+        );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
 
   | decl_list_c[decl_ast_list]
@@ -4638,7 +4606,7 @@ decl_list_c_opt
       DUMP_END();
 
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english_sbuf( &$decl_ast_list, print_result_sbuf() );
     }
   ;
 
@@ -4646,12 +4614,12 @@ decl_list_c
   : decl_list_c[decl_ast_list] ',' decl_c_exp[decl_ast]
     {
       $$ = $decl_ast_list;
-      slist_push_back( &$$, $decl_ast );
+      c_ast_list_push_back( &$$, $decl_ast );
     }
   | decl_c[decl_ast]
     {
-      slist_init( &$$ );
-      slist_push_back( &$$, $decl_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $decl_ast );
     }
   ;
 
@@ -4889,7 +4857,7 @@ block_decl_c_astp                       // Apple extension
         c_type_add_tid( &block_ast->type, $qual_stids, &@qual_stids )
       );
       c_ast_list_set_param_of( &$param_ast_list, block_ast );
-      block_ast->block.param_ast_list = slist_move( &$param_ast_list );
+      block_ast->block.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       c_ast_t *const ret_ast = ia_type_spec_ast( type_ast );
       if ( $decl_astp.target_ast != NULL ) {
@@ -4943,8 +4911,8 @@ destructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( dtor_ast ) );
-      c_ast_english( dtor_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( dtor_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -5017,14 +4985,14 @@ file_scope_constructor_declaration_c
         C_TPID_STORE
       );
       c_ast_list_set_param_of( &$param_ast_list, ctor_ast );
-      ctor_ast->ctor.param_ast_list = slist_move( &$param_ast_list );
+      ctor_ast->ctor.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       DUMP_AST( "$$_ast", ctor_ast );
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( ctor_ast ) );
-      c_ast_english( ctor_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( ctor_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -5057,8 +5025,8 @@ file_scope_destructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( dtor_ast ) );
-      c_ast_english( dtor_ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( dtor_ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -5109,7 +5077,7 @@ func_decl_c_astp
         c_ast_new_gc( assume_constructor ? K_CONSTRUCTOR : K_FUNCTION, &@$ );
       func_ast->type.stids = func_stids;
       c_ast_list_set_param_of( &$param_ast_list, func_ast );
-      func_ast->func.param_ast_list = slist_move( &$param_ast_list );
+      func_ast->func.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       c_ast_t *const decl_ast = $decl_astp.ast;
 
@@ -5304,14 +5272,14 @@ pc99_func_or_constructor_declaration_c
         C_TPID_STORE
       );
       c_ast_list_set_param_of( &$param_ast_list, ast );
-      ast->func.param_ast_list = slist_move( &$param_ast_list );
+      ast->func.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       DUMP_AST( "$$_ast", ast );
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( ast ) );
-      c_ast_english( ast, C_ENG_DECL, stdout );
-      PUTC( '\n' );
+      c_ast_english_sbuf( ast, C_ENG_DECL, print_result_sbuf() );
+      strbuf_putc( print_result_sbuf(), '\n' );
     }
   ;
 
@@ -5378,7 +5346,7 @@ noexcept_c_stid_opt
     }
   | Y_throw lparen_exp param_c_ast_list[ast_list] ')'
     {
-      slist_cleanup( &$ast_list, /*free_fn=*/NULL );
+      c_ast_list_cleanup( &$ast_list );
 
       if ( OPT_LANG_IS( throw ) )
         UNSUPPORTED( &@ast_list, "dynamic exception specifications" );
@@ -5510,13 +5478,13 @@ param_c_ast_list_exp
   : param_c_ast_list
   | error
     {
-      slist_init( &$$ );
+      c_ast_list_init( &$$ );
       elaborate_error( "parameter list expected" );
     }
   ;
 
 param_c_ast_list_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | param_c_ast_list
   ;
 
@@ -5528,7 +5496,7 @@ param_c_ast_list
       DUMP_AST( "param_c_ast", $ast );
 
       $$ = $ast_list;
-      slist_push_back( &$$, $ast );
+      c_ast_list_push_back( &$$, $ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -5539,8 +5507,8 @@ param_c_ast_list
       DUMP_START( "param_c_ast_list", "param_c_ast" );
       DUMP_AST( "param_c_ast", $param_ast );
 
-      slist_init( &$$ );
-      slist_push_back( &$$, $param_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $param_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -5574,7 +5542,7 @@ param_c_ast
         //    converted to an expression that has type "pointer to function
         //    returning type."
         //
-        $$ = c_ast_pointer( $$, &gc_ast_list );
+        $$ = c_ast_pointer( $$, &ast_arena );
       }
 
       PARSE_ASSERT( c_type_add_tid( &$$->type, $this_stid, &@this_stid ) );
@@ -5611,7 +5579,7 @@ param_c_ast_exp
   ;
 
 paren_param_c_ast_list_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | param_list_c_lparen param_c_ast_list_opt param_list_rparen
     {
       $$ = $2;
@@ -5691,7 +5659,7 @@ oper_decl_c_astp
       oper_ast->sname = c_sname_move( &$sname );
       oper_ast->type.stids = oper_stids;
       c_ast_list_set_param_of( &$param_ast_list, oper_ast );
-      oper_ast->oper.param_ast_list = slist_move( &$param_ast_list );
+      oper_ast->oper.param_ast_list = c_ast_list_move( &$param_ast_list );
       oper_ast->oper.operator = operator;
 
       c_ast_t *const ret_ast =
@@ -5753,12 +5721,12 @@ pc99_pointer_decl_list_c
   : pc99_pointer_decl_c[decl_ast] ',' decl_list_c[decl_ast_list]
     {
       $$ = $decl_ast_list;
-      slist_push_front( &$$, $decl_ast );
+      c_ast_list_push_front( &$$, $decl_ast );
     }
   | pc99_pointer_decl_c[decl_ast]
     {
-      slist_init( &$$ );
-      slist_push_back( &$$, $decl_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $decl_ast );
     }
   ;
 
@@ -5812,7 +5780,7 @@ pc99_pointer_type_c_ast
         ia_type_ast_push( type_ast );
       }
 
-      $$ = c_ast_pointer( ia_type_spec_ast( type_ast ), &gc_ast_list );
+      $$ = c_ast_pointer( ia_type_spec_ast( type_ast ), &ast_arena );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -6100,7 +6068,7 @@ user_defined_literal_decl_c_astp
       c_ast_t *const udl_ast = c_ast_new_gc( K_USER_DEFINED_LIT, &@$ );
       udl_ast->type.stids = c_tid_check( $noexcept_stid, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, udl_ast );
-      udl_ast->udef_lit.param_ast_list = slist_move( &$param_ast_list );
+      udl_ast->udef_lit.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       $$ = (c_ast_pair_t){
         c_ast_add_func(
@@ -6240,7 +6208,7 @@ block_cast_c_astp                       // Apple extension
         c_type_add_tid( &block_ast->type, $qual_stids, &@qual_stids )
       );
       c_ast_list_set_param_of( &$param_ast_list, block_ast );
-      block_ast->block.param_ast_list = slist_move( &$param_ast_list );
+      block_ast->block.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       c_ast_t *const ret_ast = ia_type_spec_ast( type_ast );
       if ( $cast_astp.target_ast != NULL ) {
@@ -6288,7 +6256,7 @@ func_cast_c_astp
       func_ast->type.stids =
         c_tid_check( $ref_qual_stids | $noexcept_stid, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, func_ast );
-      func_ast->func.param_ast_list = slist_move( &$param_ast_list );
+      func_ast->func.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       c_ast_t *const cast_ast = $cast_astp.ast;
       //
@@ -7689,7 +7657,7 @@ block_decl_english_ast                  // Apple extension
 
       $$ = c_ast_new_gc( K_APPLE_BLOCK, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
-      $$->block.param_ast_list = slist_move( &$param_ast_list );
+      $$->block.param_ast_list = c_ast_list_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, $$ );
 
       DUMP_AST( "$$_ast", $$ );
@@ -7708,7 +7676,7 @@ constructor_decl_english_ast
 
       $$ = c_ast_new_gc( K_CONSTRUCTOR, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
-      $$->ctor.param_ast_list = slist_move( &$param_ast_list );
+      $$->ctor.param_ast_list = c_ast_list_move( &$param_ast_list );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -7755,7 +7723,7 @@ func_decl_english_ast
       $$ = c_ast_new_gc( K_FUNCTION, &@$ );
       $$->type = $qual_type;
       c_ast_list_set_param_of( &$param_ast_list, $$ );
-      $$->func.param_ast_list = slist_move( &$param_ast_list );
+      $$->func.param_ast_list = c_ast_list_move( &$param_ast_list );
       $$->func.member = $member;
       c_ast_set_parent( $ret_ast, $$ );
 
@@ -7787,7 +7755,7 @@ msc_calling_convention_atid
 /// English C/C++ parameter list declaration //////////////////////////////////
 
 paren_param_decl_list_english_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | paren_param_decl_list_english
   ;
 
@@ -7806,7 +7774,7 @@ paren_param_decl_list_english
   ;
 
 param_decl_list_english_opt
-  : /* empty */                   { slist_init( &$$ ); }
+  : /* empty */                   { c_ast_list_init( &$$ ); }
   | param_decl_list_english
   ;
 
@@ -7820,7 +7788,7 @@ param_decl_list_english
       DUMP_AST( "decl_english_ast", $decl_ast );
 
       $$ = $param_ast_list;
-      slist_push_back( &$$, $decl_ast );
+      c_ast_list_push_back( &$$, $decl_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -7832,10 +7800,10 @@ param_decl_list_english
       DUMP_AST( "decl_english_ast", $decl_ast );
 
       if ( $decl_ast->kind == K_FUNCTION ) // see the comment in param_c_ast
-        $decl_ast = c_ast_pointer( $decl_ast, &gc_ast_list );
+        $decl_ast = c_ast_pointer( $decl_ast, &ast_arena );
 
-      slist_init( &$$ );
-      slist_push_back( &$$, $decl_ast );
+      c_ast_list_init( &$$ );
+      c_ast_list_push_back( &$$, $decl_ast );
 
       DUMP_AST_LIST( "$$_ast_list", $$ );
       DUMP_END();
@@ -8204,7 +8172,7 @@ user_defined_literal_decl_english_ast
 
       $$ = c_ast_new_gc( K_USER_DEFINED_LIT, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
-      $$->udef_lit.param_ast_list = slist_move( &$param_ast_list );
+      $$->udef_lit.param_ast_list = c_ast_list_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, $$ );
 
       DUMP_AST( "$$_ast", $$ );
@@ -8452,7 +8420,7 @@ concept_type_english_ast
       c_sname_set_all_types( &$sname );
 
       $$ = c_ast_new_gc( K_CONCEPT, &@$ );
-      $$->is_param_pack = true;
+      c_ast_set_parameter_pack( $$ );
       $$->concept.concept_sname = c_sname_move( &$sname );
 
       DUMP_AST( "$$_ast", $$ );
@@ -8464,7 +8432,7 @@ parameter_pack_english_ast
   : Y_parameter pack_exp
     {
       $$ = c_ast_new_gc( K_BUILTIN, &@$ );
-      $$->is_param_pack = true;
+      c_ast_set_parameter_pack( $$ );
       $$->type.btids = TB_auto;         // for consistency with C++ case
     }
   ;
@@ -9657,7 +9625,7 @@ static void l_elaborate_error( int line, dym_kind_t dym_kinds,
 
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  vfprintf( EFILE, format, args );
   va_end( args );
 
   if ( error_token != NULL ) {
@@ -9676,7 +9644,7 @@ static void l_elaborate_error( int line, dym_kind_t dym_kinds,
  * @sa parser_init()
  */
 static void parser_cleanup( void ) {
-  c_ast_list_cleanup_gc( &typedef_ast_list );
+  c_ast_arena_cleanup( &ast_arena );
 }
 
 /**
@@ -9727,12 +9695,9 @@ void parser_init( void ) {
 bool yyparse_sn( char const *s, size_t s_len ) {
   assert( s != NULL );
 
-  FILE *const s_file = fmemopen( CONST_CAST( void*, s ), s_len, "r" );
-  PERROR_EXIT_IF( s_file == NULL, EX_IOERR );
-  yyrestart( s_file );
+  lexer_restart_string( s, s_len );
 
   int const rv_bison = yyparse();
-  fclose( s_file );
   if ( unlikely( rv_bison == 2 ) ) {
     //
     // Bison has already printed "memory exhausted" via yyerror() that doesn't
@@ -62,6 +62,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <sysexits.h>
 
 /// @endcond
 
@@ -88,13 +89,38 @@ print_params_t            print_params;
 
 /// @endcond
 
+////////// local variables ////////////////////////////////////////////////////
+
+/// Buffer for standard output when written once per command.
+static char               stdout_buf[ 64 * 1024 ];
+
+/// Is standard output written once per command?
+static bool               stdout_per_command;
+
+/// Results of the current command not yet written to standard output.
+static strbuf_t           result_sbuf;
+
+/// If not NULL, results written to standard output are also appended here.
+static strbuf_t          *result_capture_sbuf;
+
+/// Was anything printed to standard error since print_result_capture_begin()?
+static bool               result_capture_stderr;
+
+/// Changes whenever a result or anything to standard error is printed.
+static unsigned           output_gen;
+
 ////////// local functions ////////////////////////////////////////////////////
 
+static void               print_diag_add( c_loc_t const*, char const* );
+static void               print_diag_add_hint( char* );
 static void               print_input_line( size_t*, size_t );
 
 NODISCARD
 static size_t             token_len( char const*, size_t, size_t );
 
+NODISCARD
+static char*              vprintf_dup( char const*, va_list );
+
 ////////// local functions ////////////////////////////////////////////////////
 
 /**
@@ -119,18 +145,23 @@ static void fl_print_impl( char const *file, int line, c_loc_t const *loc,
   assert( format != NULL );
   assert( what != NULL );
 
-  if ( loc != NULL )
-    print_loc( loc );
-  color_start( stderr, what_color );
-  EPUTS( what );
-  color_end( stderr, what_color );
-  EPUTS( ": " );
-
-  print_debug_file_line( file, line );
+  print_stderr_begin();
+  if ( print_params.diag_list != NULL ) {
+    print_diag_add( loc, what );
+  }
+  else {
+    if ( loc != NULL )
+      print_loc( loc );
+    color_start( stderr, what_color );
+    EPUTS( what );
+    color_end( stderr, what_color );
+    EPUTS( ": " );
+    print_debug_file_line( file, line );
+  }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wformat-nonliteral"
-  vfprintf( stderr, format, args );
+  vfprintf( EFILE, format, args );
 #pragma GCC diagnostic pop
 }
 
@@ -271,6 +302,52 @@ static size_t print_caret( size_t error_column ) {
   return error_column;
 }
 
+/**
+ * Appends a new \ref print_diag onto \ref print_params::diag_list and
+ * redirects #EFILE to its \ref print_diag::msg "msg" until either the next
+ * diagnostic is added or print_diag_end() is called.
+ *
+ * @param loc The location of the diagnostic; may be NULL.
+ * @param severity Either `error` or `warning`.
+ */
+static void print_diag_add( c_loc_t const *loc, char const *severity ) {
+  assert( severity != NULL );
+  print_diag_end();
+
+  print_diag_t *const diag = MALLOC( print_diag_t, 1 );
+  *diag = (print_diag_t){ .severity = severity };
+
+  if ( loc != NULL ) {
+    diag->line = opt_lineno + STATIC_CAST( unsigned, loc->first_line );
+    diag->column = STATIC_CAST( size_t, loc->first_column );
+    if ( !print_params.opt_no_print_input_line &&
+         diag->column >= print_params.inserted_len ) {
+      diag->column -= print_params.inserted_len;
+    }
+    ++diag->column;                     // 1-based, like print_loc()
+  }
+
+  slist_push_back( print_params.diag_list, diag );
+  efile_override = open_memstream( &diag->msg, &diag->msg_len );
+  PERROR_EXIT_IF( efile_override == NULL, EX_OSERR );
+}
+
+/**
+ * Appends \a hint onto the \ref print_diag::hint_list "hint_list" of the most
+ * recent \ref print_diag, if any.
+ *
+ * @param hint The hint to append.  Ownership is taken.
+ */
+static void print_diag_add_hint( char *hint ) {
+  if ( print_params.diag_list == NULL ||
+       slist_empty( print_params.diag_list ) ) {
+    FREE( hint );
+    return;
+  }
+  print_diag_t *const diag = slist_back( print_params.diag_list );
+  slist_push_back( &diag->hint_list, hint );
+}
+
 /**
  * Prints the input line, "scrolled" to the left with `...` printed if
  * necessary, so that \a error_column is always within \a term_columns.
@@ -410,6 +487,31 @@ static size_t token_len( char const *s, size_t s_len, size_t token_offset ) {
   return STATIC_CAST( size_t, s - s0 );
 }
 
+/**
+ * Formats \a format and \a args into a newly allocated string.
+ *
+ * @param format The `printf()` style format string.
+ * @param args The `printf()` arguments.  They are consumed.
+ * @return Returns said string.  The caller is responsible for freeing it.
+ */
+NODISCARD
+static char* vprintf_dup( char const *format, va_list args ) {
+  assert( format != NULL );
+
+  va_list args_copy;
+  va_copy( args_copy, args );
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+  int const raw_len = vsnprintf( NULL, 0, format, args_copy );
+  va_end( args_copy );
+  PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
+  size_t const buf_size = STATIC_CAST( size_t, raw_len ) + 1/*'\0'*/;
+  char *const buf = MALLOC( char, buf_size );
+  PJL_DISCARD_RV( vsnprintf( buf, buf_size, format, args ) );
+#pragma GCC diagnostic pop
+  return buf;
+}
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 void fl_print_error( char const *file, int line, c_loc_t const *loc,
@@ -504,6 +606,28 @@ void print_ast_type_aka( c_ast_t const *ast, FILE *fout ) {
   }
 }
 
+void print_diag_free( print_diag_t *diag ) {
+  if ( diag == NULL )
+    return;
+  FREE( diag->msg );
+  slist_cleanup( &diag->hint_list, &free );
+  FREE( diag );
+}
+
+void print_diag_end( void ) {
+  if ( efile_override == NULL )
+    return;
+  PJL_DISCARD_RV( fclose( efile_override ) );
+  efile_override = NULL;
+
+  print_diag_t *const diag = slist_back( print_params.diag_list );
+  if ( diag->msg != NULL ) {
+    // The message ends with a newline unless a suggestion follows it.
+    strn_rtrim( diag->msg, &diag->msg_len );
+    diag->msg[ diag->msg_len ] = '\0';
+  }
+}
+
 void print_debug_file_line( char const *file, int line ) {
   assert( file != NULL );
   assert( line > 0 );
@@ -550,16 +674,26 @@ void print_error_token_is_a( char const *error_token ) {
 
 void print_hint( char const *format, ... ) {
   assert( format != NULL );
-  EPUTS( "; did you mean " );
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  if ( print_params.diag_list != NULL ) {
+    print_diag_add_hint( vprintf_dup( format, args ) );
+  }
+  else {
+    EPUTS( "; did you mean " );
+    vfprintf( stderr, format, args );
+    EPUTS( "?\n" );
+  }
   va_end( args );
-  EPUTS( "?\n" );
 }
 
 void print_loc( c_loc_t const *loc ) {
   assert( loc != NULL );
+  print_stderr_begin();
+  if ( print_params.diag_list != NULL ) {
+    print_diag_add( loc, "error" );
+    return;
+  }
   unsigned const line = opt_lineno + STATIC_CAST( unsigned, loc->first_line );
   size_t const column = print_caret( STATIC_CAST( size_t, loc->first_column ) );
 
@@ -593,16 +727,71 @@ void print_loc( c_loc_t const *loc ) {
 }
 
 bool print_suggestions( dym_kind_t kinds, char const *unknown_token ) {
-  did_you_mean_t const *const dym = cdecl_dym_new( kinds, unknown_token );
+  did_you_mean_t const *const dym = cdecl_dym_find( kinds, unknown_token );
   if ( dym == NULL )
     return false;
-  EPUTS( "; did you mean " );
-  fput_list( stderr, dym, &fput_list_dym_gets );
-  EPUTC( '?' );
-  cdecl_dym_free( dym );
+  if ( print_params.diag_list != NULL ) {
+    for ( did_you_mean_t const *d = dym; d->known != NULL; ++d )
+      print_diag_add_hint( check_strdup( d->known ) );
+  }
+  else {
+    EPUTS( "; did you mean " );
+    fput_list( stderr, dym, &fput_list_dym_gets );
+    EPUTC( '?' );
+  }
   return true;
 }
 
+unsigned print_output_gen( void ) {
+  return output_gen;
+}
+
+void print_result_capture_begin( strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+  assert( result_capture_sbuf == NULL );
+  result_capture_sbuf = sbuf;
+  result_capture_stderr = false;
+}
+
+bool print_result_capture_end( void ) {
+  assert( result_capture_sbuf != NULL );
+  print_result_flush();
+  result_capture_sbuf = NULL;
+  return !result_capture_stderr;
+}
+
+void print_result_flush( void ) {
+  if ( result_sbuf.len == 0 )
+    return;
+  FPUTS( result_sbuf.str, stdout );
+  if ( result_capture_sbuf != NULL )
+    strbuf_putsn( result_capture_sbuf, result_sbuf.str, result_sbuf.len );
+  strbuf_reset( &result_sbuf );
+  ++output_gen;
+}
+
+strbuf_t* print_result_sbuf( void ) {
+  return &result_sbuf;
+}
+
+void print_stderr_begin( void ) {
+  print_stdout_flush();
+  result_capture_stderr = true;
+  ++output_gen;
+}
+
+void print_stdout_flush( void ) {
+  print_result_flush();
+  if ( stdout_per_command )
+    FFLUSH( stdout );
+}
+
+void print_stdout_per_command( void ) {
+  ASSERT_RUN_ONCE();
+  setvbuf( stdout, stdout_buf, _IOFBF, sizeof stdout_buf );
+  stdout_per_command = true;
+}
+
 void print_type_ast( c_typedef_t const *tdef, FILE *fout ) {
   assert( tdef != NULL );
   assert( fout != NULL );
@@ -619,10 +808,23 @@ void print_type_decl( c_typedef_t const *tdef, decl_flags_t decl_flags,
   assert( is_1_bit_in_set( decl_flags, C_TYPE_DECL_ANY ) );
   assert( fout != NULL );
 
+  static strbuf_t sbuf;
+  strbuf_reset( &sbuf );
+  print_type_decl_sbuf( tdef, decl_flags, &sbuf );
+  if ( sbuf.len > 0 )
+    FPUTS( sbuf.str, fout );
+}
+
+void print_type_decl_sbuf( c_typedef_t const *tdef, decl_flags_t decl_flags,
+                           strbuf_t *sbuf ) {
+  assert( tdef != NULL );
+  assert( is_1_bit_in_set( decl_flags, C_TYPE_DECL_ANY ) );
+  assert( sbuf != NULL );
+
   if ( (decl_flags & C_ENG_DECL) != 0 )
-    c_typedef_english( tdef, fout );
+    c_typedef_english_sbuf( tdef, sbuf );
   else
-    c_typedef_gibberish( tdef, decl_flags, fout );
+    c_typedef_gibberish_sbuf( tdef, decl_flags, sbuf );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "cdecl_dym.h"
+#include "slist.h"
+#include "strbuf.h"
 #include "types.h"                      /* for c_loc_t */
 
 // standard
@@ -91,6 +93,27 @@
 #define print_warning(...) \
   fl_print_warning( __FILE__, __LINE__, __VA_ARGS__ )
 
+/**
+ * A diagnostic, i.e., an error or warning, recorded by the `print_*()`
+ * functions instead of printing it.
+ *
+ * @remarks Since a message is typically printed piecemeal by several
+ * functions, #EFILE is redirected to \ref msg while the diagnostic is the most
+ * recent one.
+ *
+ * @sa print_diag_end()
+ * @sa print_params::diag_list
+ */
+struct print_diag {
+  char const *severity;                 ///< Either `error` or `warning`.
+  unsigned    line;                     ///< Line number or 0 if none.
+  size_t      column;                   ///< Column number or 0 if none.
+  char       *msg;                      ///< Message without suggestions.
+  size_t      msg_len;                  ///< Length of \ref msg.
+  slist_t     hint_list;                ///< "Did you mean" suggestions.
+};
+typedef struct print_diag print_diag_t;
+
 /**
  * Parameters for the `print_*()` functions that would be too burdonsome to
  * pass to every function call.
@@ -100,6 +123,14 @@ struct print_params {
   size_t      command_line_len;         ///< Length of `command_line`.
   size_t      inserted_len;             ///< Length of inserted string, if any.
   bool        opt_no_print_input_line;  ///< Don't print input line before `^`.
+
+  /**
+   * If not NULL, every error or warning is appended to this list as a \ref
+   * print_diag instead of being printed.  The caller is responsible for
+   * calling print_diag_end() before using the list and freeing its elements
+   * via print_diag_free().
+   */
+  slist_t    *diag_list;
 };
 typedef struct print_params print_params_t;
 
@@ -176,6 +207,23 @@ PJL_PRINTF_LIKE_FUNC(4)
 void fl_print_warning( char const *file, int line, c_loc_t const *loc,
                        char const *format, ... );
 
+/**
+ * Frees all memory associated with \a diag _including_ \a diag itself.
+ *
+ * @param diag The \ref print_diag to free.  If NULL, does nothing.
+ *
+ * @sa print_params::diag_list
+ */
+void print_diag_free( print_diag_t *diag );
+
+/**
+ * Ends recording the most recent \ref print_diag, if any, and restores #EFILE
+ * to standard error.
+ *
+ * @sa print_params::diag_list
+ */
+void print_diag_end( void );
+
 /**
  * If \ref opt_cdecl_debug is compiled in and enabled, prints \a file and \a
  * line to standard error in the form `"[<file>:<line>] "`; otherwise prints
@@ -193,7 +241,8 @@ void print_debug_file_line( char const *file, int line );
  *
  *      ; did you mean ...?
  *
- * where `...` is the hint.
+ * where `...` is the hint.  However, if \ref print_params::diag_list is not
+ * NULL, instead appends the hint to the most recent \ref print_diag.
  *
  * @note A newline _is_ printed.
  *
@@ -236,6 +285,9 @@ void print_error_token_is_a( char const *error_token );
  *  + The file and line the error is in (if reading from a file).
  *  + The error column.
  *
+ * However, if \ref print_params::diag_list is not NULL, instead appends a new
+ * \ref print_diag having \a loc.
+ *
  * @note A newline is _not_ printed.
  *
  * @param loc The location to print.
@@ -251,6 +303,8 @@ void print_loc( c_loc_t const *loc );
  *
  * where `...` is a a comma-separated list of one or more suggestions.  If
  * there are no suggestions that are "similar enough," prints nothing.
+ * However, if \ref print_params::diag_list is not NULL, instead appends the
+ * suggestions to the most recent \ref print_diag.
  *
  * @note A newline is _not_ printed.
  *
@@ -264,6 +318,94 @@ void print_loc( c_loc_t const *loc );
 PJL_DISCARD
 bool print_suggestions( dym_kind_t kinds, char const *unknown_token );
 
+/**
+ * Gets the current output generation: it changes whenever either the result of
+ * a command or anything to standard error is printed.
+ *
+ * @return Returns said generation.
+ */
+NODISCARD
+unsigned print_output_gen( void );
+
+/**
+ * Begins capturing the results of commands: every result subsequently written
+ * to standard output by print_result_flush() is also appended onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append results onto.
+ *
+ * @sa print_result_capture_end()
+ */
+void print_result_capture_begin( strbuf_t *sbuf );
+
+/**
+ * Ends capturing the results of commands.
+ *
+ * @return Returns `true` only if nothing was printed to standard error since
+ * print_result_capture_begin() was called, i.e., the captured results are the
+ * only output.
+ *
+ * @sa print_result_capture_begin()
+ */
+NODISCARD
+bool print_result_capture_end( void );
+
+/**
+ * Writes the result of the current command, if any, to standard output.
+ *
+ * @remarks This must be called after each command is parsed.
+ *
+ * @sa print_result_sbuf()
+ */
+void print_result_flush( void );
+
+/**
+ * Gets the \ref strbuf into which the result of the current command, e.g.,
+ * the English or gibberish printed by `explain`, `declare`, or `cast`, is
+ * rendered before being written to standard output.
+ *
+ * @return Returns said \ref strbuf.
+ *
+ * @sa print_result_flush()
+ */
+NODISCARD
+strbuf_t* print_result_sbuf( void );
+
+/**
+ * Must be called just before anything is printed to standard error (other
+ * than the continuation of a message begun by print_error(), print_warning(),
+ * or print_loc(), that call this themselves) so that standard output and
+ * standard error remain in order.
+ *
+ * @sa print_result_capture_end()
+ * @sa print_stdout_flush()
+ */
+void print_stderr_begin( void );
+
+/**
+ * Writes the result of the current command, if any, to standard output via
+ * print_result_flush(); then flushes standard output, but only if
+ * print_stdout_per_command() was called.
+ *
+ * @remarks This must be called after each command is parsed so that all of
+ * the command's output is written via a single **write**(2).
+ */
+void print_stdout_flush( void );
+
+/**
+ * Sets standard output to be written once per command rather than whenever
+ * its buffer fills (if a file or pipe) or every character (if unbuffered).
+ *
+ * @remarks Everything printed to standard output is buffered until either
+ * print_stdout_flush() or print_stderr_begin() is called so that standard
+ * output and standard error remain in order.
+ *
+ * @note This function must be called at most once and before anything is
+ * printed to standard output.
+ *
+ * @sa print_stdout_flush()
+ */
+void print_stdout_per_command( void );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
@@ -384,11 +526,27 @@ void print_type_ast( c_typedef_t const *tdef, FILE *fout );
  * @sa c_typedef_gibberish()
  * @sa print_ast_type_aka()
  * @sa print_type_ast()
+ * @sa print_type_decl_sbuf()
  * @sa show_type()
  */
 void print_type_decl( c_typedef_t const *tdef, decl_flags_t decl_flags,
                       FILE *fout );
 
+/**
+ * Like print_type_decl() except appends onto \a sbuf.
+ *
+ * @param tdef The \ref c_typedef to print.
+ * @param decl_flags The declaration flags to use (overriding \a tdef's \ref
+ * c_typedef::decl_flags "decl_flags").
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa c_typedef_english_sbuf()
+ * @sa c_typedef_gibberish_sbuf()
+ * @sa print_type_decl()
+ */
+void print_type_decl_sbuf( c_typedef_t const *tdef, decl_flags_t decl_flags,
+                           strbuf_t *sbuf );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
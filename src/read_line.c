@@ -164,8 +164,15 @@ bool strbuf_read_line( strbuf_t *sbuf, FILE *fin, sbrl_prompt_fn_t prompt_fn,
 
     size_t line_len;
     char const *const line = read_line( fin, prompt, &line_len );
-    if ( line == NULL )
-      return false;
+    if ( line == NULL ) {
+      if ( !is_cont_line )
+        return false;
+      // The last line was continued, but there are no more lines: return
+      // what there is of it anyway.
+      if ( pline_no != NULL )
+        --*pline_no;
+      break;
+    }
 
     is_cont_line = (*is_cont_line_fn)( line, &line_len );
     if ( is_cont_line && pline_no != NULL )
@@ -77,7 +77,8 @@ typedef char const* (*sbrl_prompt_fn_t)( bool is_cont_line );
  *  + Adding non-whitespace-only lines to the history.
  *
  * Multiple lines separated by `\` are joined together and returned as a single
- * line.  Lines always end with a newline.
+ * line, even if the last line is continued, but EOF is encountered.  Lines
+ * always end with a newline.
  * @endparblock
  *
  * @param sbuf The \ref strbuf to use.
@@ -490,6 +490,35 @@ void rb_iterator_init( rb_tree_t const *tree, rb_iterator_t *iter ) {
   iter->tree = tree;
 }
 
+void rb_iterator_init_lower( rb_tree_t const *tree, rb_iterator_t *iter,
+                            rb_cmp_fn_t cmp_fn, void const *data ) {
+  assert( tree != NULL );
+  assert( iter != NULL );
+  assert( data != NULL );
+
+  if ( cmp_fn == NULL )
+    cmp_fn = tree->cmp_fn;
+
+  iter->stack_top = 0;
+  iter->tree = tree;
+
+  //
+  // Push every node at which we go left since each is greater than or equal
+  // to data: the top of the stack is then the least such node.  Ending with
+  // curr at nil makes rb_iterator_next() start by popping it.
+  //
+  rb_node_t *node = tree->root;
+  while ( node != &tree->nil ) {
+    bool const go_left = (*cmp_fn)( data, rb_node_data( tree, node ) ) <= 0;
+    if ( go_left ) {
+      assert( iter->stack_top < RB_ITERATOR_DEPTH_MAX );
+      iter->stack[ iter->stack_top++ ] = node;
+    }
+    node = node->child[ !go_left ];
+  } // while
+  iter->curr = node;
+}
+
 void* rb_iterator_next( rb_iterator_t *iter ) {
   assert( iter != NULL );
 
@@ -323,6 +323,25 @@ struct rb_insert_rv {
  */
 void rb_iterator_init( rb_tree_t const *tree, rb_iterator_t *iter );
 
+/**
+ * Initializes an rb_iterator to start at the first in-order node whose data is
+ * greater than or equal to \a data.
+ *
+ * @param tree A pointer to the rb_tree to iterate over.
+ * @param iter A pointer to the rb_iterator to initialize.
+ * @param cmp_fn A pointer to a function used to compare \a data (always
+ * passed as its first argument) to the data of nodes or NULL to use \a tree's
+ * \ref rb_tree::cmp_fn "cmp_fn".  It must order nodes the same way.  A
+ * different function can be used to start at the first node having a
+ * particular prefix.
+ * @param data A pointer to the data to start at.
+ *
+ * @sa rb_iterator_init()
+ * @sa rb_iterator_next()
+ */
+void rb_iterator_init_lower( rb_tree_t const *tree, rb_iterator_t *iter,
+                            rb_cmp_fn_t cmp_fn, void const *data );
+
 /**
  * Iterates to the next in-order node in the tree, if any.
  *
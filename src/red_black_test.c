@@ -252,6 +252,19 @@ static bool test_various( rb_dloc_t dloc ) {
   }
   TEST( letter_offset == 4 );
 
+  // test iterator starting at a lower bound
+  rb_iterator_init_lower( &tree, &iter, /*cmp_fn=*/NULL, "B" );
+  TEST( strcmp( rb_iterator_next( &iter ), "B" ) == 0 );
+  TEST( strcmp( rb_iterator_next( &iter ), "C" ) == 0 );
+  rb_iterator_init_lower( &tree, &iter, /*cmp_fn=*/NULL, "BB" );
+  TEST( strcmp( rb_iterator_next( &iter ), "C" ) == 0 );
+  TEST( strcmp( rb_iterator_next( &iter ), "D" ) == 0 );
+  TEST( rb_iterator_next( &iter ) == NULL );
+  rb_iterator_init_lower( &tree, &iter, /*cmp_fn=*/NULL, "" );
+  TEST( strcmp( rb_iterator_next( &iter ), "A" ) == 0 );
+  rb_iterator_init_lower( &tree, &iter, /*cmp_fn=*/NULL, "E" );
+  TEST( rb_iterator_next( &iter ) == NULL );
+
   // test visitor
   letter_offset = 0;
   TEST( rb_tree_visit( &tree, &test_rb_visitor, &letter_offset ) == NULL );
@@ -0,0 +1,1070 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/result_cache.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for caching the results of commands.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "result_cache.h"
+#include "c_typedef.h"
+#include "cdecl.h"
+#include "literals.h"
+#include "options.h"
+#include "p_macro.h"
+#include "print.h"
+#include "prompt.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>                      /* for open(2) */
+#include <stdbool.h>
+#include <stddef.h>                     /* for offsetof() */
+#include <stdint.h>                     /* for uint64_t */
+#include <stdio.h>                      /* for rename(3) */
+#include <stdlib.h>                     /* for mkstemp(3) */
+#include <string.h>
+#include <sys/file.h>                   /* for flock(2) */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>                     /* for getpid(2), pread(2), pwrite(2) */
+
+/// @endcond
+
+/**
+ * @addtogroup result-cache-group
+ * @{
+ */
+
+/**
+ * The number of buckets of \ref rc_buckets; must be a power of 2.
+ */
+#define RC_BUCKETS_LEN            (RESULT_CACHE_MAX * 2)
+
+/**
+ * The number of buckets of the hash table in the results file; must be a power
+ * of 2.
+ */
+#define RC_FILE_BUCKETS_LEN       4096u
+
+/**
+ * The magic number at the start of the results file that's also its format
+ * version.
+ */
+#define RC_FILE_MAGIC             "cdeclrc1"
+
+/**
+ * The maximum size of the results file.  When an addition would exceed it, the
+ * file is emptied first.
+ */
+#define RC_FILE_SIZE_MAX          (64u * 1024 * 1024)
+
+/**
+ * The name of the results file in the cache directory.
+ */
+#define RC_FILE_NAME              "results"
+
+/**
+ * What follows \ref rc_file_key_prefix in the key of the prompt in the results
+ * file.  It can't be confused with a command since only `cast`, `declare`, and
+ * `explain` commands are ever cached.
+ *
+ * @sa result_cache_dir_find_prompt()
+ */
+#define RC_FILE_PROMPT_KEY        "prompt"
+
+/**
+ * Appends the bytes of \a VAR onto \a SBUF.
+ *
+ * @param SBUF The \ref strbuf to append onto.
+ * @param VAR The variable to append the bytes of.
+ */
+#define RC_PUT_VAR(SBUF,VAR) \
+  rc_put_bytes( (SBUF), &(VAR), sizeof (VAR) )
+
+/**
+ * A cached result.
+ */
+struct rc_entry {
+  struct rc_entry  *next;               ///< Next entry in the same bucket.
+  struct rc_entry  *lru_prev;           ///< More recently used entry, if any.
+  struct rc_entry  *lru_next;           ///< Less recently used entry, if any.
+  size_t            hash;               ///< Hash code of the key.
+  size_t            key_len;            ///< Length of the key.
+  char const       *result;             ///< The result; points into \ref buf.
+  char              buf[];              ///< Key followed by result.
+};
+typedef struct rc_entry rc_entry_t;
+
+/**
+ * The header of the results file.
+ *
+ * @remarks
+ * @parblock
+ * The results file is a hash table having \ref buckets that's only ever
+ * appended to: each bucket is the offset of the most recently added \ref
+ * rc_file_record in it (or 0 if none) and each record is followed by its key
+ * and result.  A record is written before the bucket is updated to point to it
+ * and a record can only point to an earlier one, so a reader never sees a
+ * partial record.
+ *
+ * Writers take an exclusive lock on the file via **flock**(2).  Readers take
+ * no lock: they use a mapping of the file that's made once and made again
+ * only when a record is past its end.  Since the file is never truncated (when
+ * it must be emptied, a new file is renamed over it instead), a mapping always
+ * remains valid.
+ * @endparblock
+ */
+struct rc_file_header {
+  char      magic[ STRLITLEN( RC_FILE_MAGIC ) ]; ///< #RC_FILE_MAGIC.
+  uint64_t  buckets[ RC_FILE_BUCKETS_LEN ];     ///< Offsets of records.
+};
+typedef struct rc_file_header rc_file_header_t;
+
+/**
+ * A record in the results file.
+ *
+ * @sa rc_file_header
+ */
+struct rc_file_record {
+  uint64_t  next_off;                   ///< Next record in same bucket or 0.
+  uint64_t  hash;                       ///< Hash code of the key.
+  uint32_t  key_len;                    ///< Length of the key.
+  uint32_t  result_len;                 ///< Length of the result.
+};
+typedef struct rc_file_record rc_file_record_t;
+
+////////// local variables ////////////////////////////////////////////////////
+
+static rc_entry_t  *rc_buckets[ RC_BUCKETS_LEN ]; ///< Hash table of entries.
+static rc_entry_t  *rc_lru_head;        ///< Most recently used entry.
+static rc_entry_t  *rc_lru_tail;        ///< Least recently used entry.
+static size_t       rc_hits;            ///< Number of cache hits.
+static size_t       rc_len;             ///< Number of cached entries.
+static size_t       rc_misses;          ///< Number of cache misses.
+
+/// File descriptor of the results file or -1 if none.
+static int          rc_file_fd = -1;
+
+/// Mapping of the results file, if any.
+static char const  *rc_file_map;
+
+/// Size of \ref rc_file_map.
+static size_t       rc_file_map_size;
+
+/// Path of the results file, if any.
+static strbuf_t     rc_file_path;
+
+/// Process that opened \ref rc_file_fd.
+static pid_t        rc_file_pid;
+
+/// Fingerprint of the state after initialization.
+static strbuf_t     rc_init_fp;
+
+/// The part of every key in the results file preceding the command.
+static strbuf_t     rc_file_key_prefix;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Gets the bucket of \ref rc_buckets for \a hash.
+ *
+ * @param hash The hash code of a key.
+ * @return Returns a pointer to said bucket.
+ */
+NODISCARD
+static inline rc_entry_t** rc_bucket( size_t hash ) {
+  return &rc_buckets[ hash & (RC_BUCKETS_LEN - 1) ];
+}
+
+/**
+ * Closes the results file, if open, also releasing its lock, if any.
+ *
+ * @sa rc_file_open()
+ */
+static void rc_file_close( void ) {
+  if ( rc_file_map != NULL ) {
+    munmap( CONST_CAST( char*, rc_file_map ), rc_file_map_size );
+    rc_file_map = NULL;
+    rc_file_map_size = 0;
+  }
+  if ( rc_file_fd >= 0 ) {
+    close( rc_file_fd );
+    rc_file_fd = -1;
+  }
+}
+
+/**
+ * Cleans-up all cached results at program termination.
+ *
+ * @note This function is called only via **atexit**(3).
+ */
+static void rc_cleanup( void ) {
+  while ( rc_lru_head != NULL ) {
+    rc_entry_t *const next = rc_lru_head->lru_next;
+    FREE( rc_lru_head );
+    rc_lru_head = next;
+  } // while
+  rc_file_close();
+  strbuf_cleanup( &rc_file_key_prefix );
+  strbuf_cleanup( &rc_file_path );
+  strbuf_cleanup( &rc_init_fp );
+}
+
+/**
+ * Registers rc_cleanup() to be called at program termination, but only the
+ * first time it's called.
+ */
+static void rc_cleanup_atexit( void ) {
+  static bool called_atexit;
+  if ( !called_atexit ) {
+    ATEXIT( &rc_cleanup );
+    called_atexit = true;
+  }
+}
+
+/**
+ * Evicts the least recently used entry.
+ */
+static void rc_evict( void ) {
+  rc_entry_t *const entry = rc_lru_tail;
+  assert( entry != NULL );
+
+  rc_entry_t **pnext = rc_bucket( entry->hash );
+  while ( *pnext != entry )
+    pnext = &(*pnext)->next;
+  *pnext = entry->next;
+
+  rc_lru_tail = entry->lru_prev;
+  if ( rc_lru_tail != NULL )
+    rc_lru_tail->lru_next = NULL;
+  else
+    rc_lru_head = NULL;
+
+  FREE( entry );
+  --rc_len;
+}
+
+/**
+ * Gets a hash code for the first \a s_len characters of \a s.
+ *
+ * @param s The string to hash.
+ * @param s_len The number of characters of \a s to hash.
+ * @return Returns said hash code.
+ */
+NODISCARD
+static size_t rc_hash( char const *s, size_t s_len ) {
+  return STATIC_CAST( size_t, fnv1a( FNV1A_INIT, s, s_len ) );
+}
+
+/**
+ * Moves \a entry to the front of the LRU list.
+ *
+ * @param entry The \ref rc_entry to move.  It must already be in the list.
+ */
+static void rc_lru_touch( rc_entry_t *entry ) {
+  assert( entry != NULL );
+  if ( entry == rc_lru_head )
+    return;
+
+  // Unlink it ...
+  entry->lru_prev->lru_next = entry->lru_next;
+  if ( entry->lru_next != NULL )
+    entry->lru_next->lru_prev = entry->lru_prev;
+  else
+    rc_lru_tail = entry->lru_prev;
+
+  // ... and relink it at the front.
+  entry->lru_prev = NULL;
+  entry->lru_next = rc_lru_head;
+  rc_lru_head->lru_prev = entry;
+  rc_lru_head = entry;
+}
+
+/**
+ * Finds the entry, if any, for \a q.
+ *
+ * @param q The \ref result_cache_query to find the entry for.
+ * @return Returns said entry or NULL if none.
+ */
+NODISCARD
+static rc_entry_t* rc_find( result_cache_query_t const *q ) {
+  assert( q != NULL );
+  for ( rc_entry_t *entry = *rc_bucket( q->hash ); entry != NULL;
+        entry = entry->next ) {
+    if ( entry->hash == q->hash && entry->key_len == q->key.len &&
+         memcmp( entry->buf, q->key.str, q->key.len ) == 0 ) {
+      return entry;
+    }
+  } // for
+  return NULL;
+}
+
+/**
+ * Appends \a n bytes of \a p onto \a sbuf.
+ *
+ * @remarks Unlike strbuf_putsn(), this doesn't stop at a null byte.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param p A pointer to the bytes to append.
+ * @param n The number of bytes to append.
+ */
+static void rc_put_bytes( strbuf_t *sbuf, void const *p, size_t n ) {
+  assert( sbuf != NULL );
+  assert( p != NULL );
+  strbuf_reserve( sbuf, n );
+  memcpy( sbuf->str + sbuf->len, p, n );
+  sbuf->len += n;
+  sbuf->str[ sbuf->len ] = '\0';
+}
+
+/**
+ * Appends a fingerprint of every option that affects the results of commands
+ * onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa rc_put_fingerprint()
+ */
+static void rc_put_options( strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+
+  options_snapshot_t snapshot;
+  options_save( &snapshot );
+
+  RC_PUT_VAR( sbuf, snapshot.east_const );
+  RC_PUT_VAR( sbuf, snapshot.explicit_int_btids );
+  RC_PUT_VAR( sbuf, snapshot.lang_id );
+  RC_PUT_VAR( sbuf, opt_alt_tokens );
+  RC_PUT_VAR( sbuf, opt_english_types );
+  RC_PUT_VAR( sbuf, opt_explicit_ecsu_btids );
+  RC_PUT_VAR( sbuf, opt_graph );
+  RC_PUT_VAR( sbuf, opt_permissive_types );
+  RC_PUT_VAR( sbuf, opt_semicolon );
+  RC_PUT_VAR( sbuf, opt_trailing_ret );
+  RC_PUT_VAR( sbuf, opt_using );
+  RC_PUT_VAR( sbuf, opt_west_decl_kinds );
+}
+
+/**
+ * Appends a fingerprint of every option that affects the results of commands
+ * and the generations of the sets of types and macros onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ *
+ * @sa rc_put_options()
+ */
+static void rc_put_fingerprint( strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+
+  unsigned const macros_gen = p_macros_gen();
+  unsigned const typedefs_gen = c_typedefs_gen();
+
+  rc_put_options( sbuf );
+  RC_PUT_VAR( sbuf, macros_gen );
+  RC_PUT_VAR( sbuf, typedefs_gen );
+}
+
+/**
+ * Appends \a s with leading and trailing whitespace and a trailing `;`, if
+ * any, removed and all other whitespace normalized to a single space onto \a
+ * sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param s The **cdecl** command.  It need not be null-terminated.
+ * @param s_len The length of \a s.
+ * @return Returns `true` only if \a s is a single `cast`, `declare`, or
+ * `explain` command.
+ */
+NODISCARD
+static bool rc_put_command( strbuf_t *sbuf, char const *s, size_t s_len ) {
+  assert( sbuf != NULL );
+  assert( s != NULL );
+
+  while ( s_len > 0 && isspace( STATIC_CAST( unsigned char, *s ) ) )
+    ++s, --s_len;
+  strn_rtrim( s, &s_len );
+  if ( s_len > 0 && s[ s_len - 1 ] == ';' ) {
+    --s_len;
+    strn_rtrim( s, &s_len );
+  }
+  if ( memchr( s, ';', s_len ) != NULL )
+    return false;                       // more than one command
+
+  static char const *const COMMANDS[] = { L_cast, L_declare, L_explain };
+  bool is_cacheable = false;
+  FOREACH_ARRAY_ELEMENT( char const*, command, COMMANDS ) {
+    size_t const command_len = strlen( *command );
+    if ( s_len > command_len && strncmp( s, *command, command_len ) == 0 &&
+         isspace( STATIC_CAST( unsigned char, s[ command_len ] ) ) ) {
+      is_cacheable = true;
+      break;
+    }
+  } // for
+  if ( !is_cacheable )
+    return false;
+
+  char const *const end = s + s_len;
+  while ( s < end ) {
+    if ( isspace( STATIC_CAST( unsigned char, *s ) ) ) {
+      strbuf_putc( sbuf, ' ' );
+      do {
+        ++s;
+      } while ( s < end && isspace( STATIC_CAST( unsigned char, *s ) ) );
+    }
+    else {
+      strbuf_putc( sbuf, *s++ );
+    }
+  } // while
+  return true;
+}
+
+/**
+ * Adds \a result to the cache for the command of \a q.
+ *
+ * @param q The \ref result_cache_query for the command.  Its result must not
+ * already be cached.
+ * @param result The result of the command.
+ * @param result_len The length of \a result.
+ */
+static void rc_add( result_cache_query_t const *q, char const *result,
+                    size_t result_len ) {
+  assert( q != NULL );
+  assert( result != NULL || result_len == 0 );
+
+  rc_cleanup_atexit();
+  if ( rc_len == RESULT_CACHE_MAX )
+    rc_evict();
+
+  rc_entry_t *const entry =
+    MALLOC( char, sizeof( rc_entry_t ) + q->key.len + result_len + 1 );
+  memcpy( entry->buf, q->key.str, q->key.len );
+  char *const entry_result = entry->buf + q->key.len;
+  if ( result_len > 0 )
+    memcpy( entry_result, result, result_len );
+  entry_result[ result_len ] = '\0';
+
+  rc_entry_t **const bucket = rc_bucket( q->hash );
+  *entry = (rc_entry_t){
+    .next = *bucket,
+    .lru_next = rc_lru_head,
+    .hash = q->hash,
+    .key_len = q->key.len,
+    .result = entry_result
+  };
+  *bucket = entry;
+
+  if ( rc_lru_head != NULL )
+    rc_lru_head->lru_prev = entry;
+  else
+    rc_lru_tail = entry;
+  rc_lru_head = entry;
+  ++rc_len;
+}
+
+/**
+ * Creates the directory \a path and all missing parent directories.
+ *
+ * @param path The path of the directory to create.
+ * @return Returns `true` only if the directory exists upon return.
+ */
+NODISCARD
+static bool rc_mkdirs( char const *path ) {
+  assert( path != NULL );
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+  strbuf_puts( &sbuf, path );
+
+  for ( char *slash = sbuf.str + 1; (slash = strchr( slash, '/' )) != NULL;
+        ++slash ) {
+    *slash = '\0';
+    if ( mkdir( sbuf.str, 0755 ) < 0 && errno != EEXIST )
+      break;
+    *slash = '/';
+  } // for
+
+  bool const ok = mkdir( sbuf.str, 0755 ) == 0 || errno == EEXIST;
+  strbuf_cleanup( &sbuf );
+  return ok;
+}
+
+/**
+ * Maps the results file again, but only if its size changed since it was last
+ * mapped.
+ *
+ * @return Returns `true` only if the results file is mapped upon return.
+ */
+NODISCARD
+static bool rc_file_remap( void ) {
+  assert( rc_file_fd >= 0 );
+
+  struct stat st;
+  if ( fstat( rc_file_fd, &st ) < 0 )
+    return false;                       // LCOV_EXCL_LINE
+  size_t const file_size = STATIC_CAST( size_t, st.st_size );
+  if ( rc_file_map != NULL ) {
+    if ( file_size == rc_file_map_size )
+      return true;
+    munmap( CONST_CAST( char*, rc_file_map ), rc_file_map_size );
+    rc_file_map = NULL;
+    rc_file_map_size = 0;
+  }
+
+  if ( file_size < sizeof( rc_file_header_t ) ||
+       file_size > RC_FILE_SIZE_MAX ) {
+    return false;
+  }
+  char const *const map =
+    mmap( NULL, file_size, PROT_READ, MAP_SHARED, rc_file_fd, 0 );
+  if ( map == MAP_FAILED )
+    return false;                       // LCOV_EXCL_LINE
+  if ( memcmp( map, RC_FILE_MAGIC, STRLITLEN( RC_FILE_MAGIC ) ) != 0 ) {
+    munmap( CONST_CAST( char*, map ), file_size );
+    return false;
+  }
+
+  rc_file_map = map;
+  rc_file_map_size = file_size;
+  return true;
+}
+
+/**
+ * Checks whether the mapping of the results file extends through \a end
+ * mapping the results file again if it doesn't since the file may have grown.
+ *
+ * @param end The offset just past the last byte that must be mapped.
+ * @return Returns `true` only if the mapping extends through \a end.
+ */
+NODISCARD
+static bool rc_file_maps( uint64_t end ) {
+  return end <= rc_file_map_size ||
+         (rc_file_remap() && end <= rc_file_map_size);
+}
+
+/**
+ * Opens and maps the results file, if it exists.
+ *
+ * @sa rc_file_close()
+ */
+static void rc_file_open( void ) {
+  assert( rc_file_fd < 0 );
+  rc_file_fd = open( rc_file_path.str, O_RDWR );
+  if ( rc_file_fd >= 0 ) {
+    rc_file_pid = getpid();
+    PJL_DISCARD_RV( rc_file_remap() );
+  }
+}
+
+/**
+ * Creates a new, empty, and exclusively locked results file replacing the
+ * existing one, if any.
+ *
+ * @remarks The new file is renamed over the existing one rather than the
+ * existing one being truncated so that other processes' mappings of the
+ * existing one remain valid.
+ *
+ * @return Returns `true` only if the new file was created; if not, the
+ * existing one, if any, remains open.
+ */
+NODISCARD
+static bool rc_file_create( void ) {
+  strbuf_t tmp_path;
+  strbuf_init( &tmp_path );
+  strbuf_printf( &tmp_path, "%s.XXXXXX", rc_file_path.str );
+
+  int fd = mkstemp( tmp_path.str );     // also creates it with mode 0600
+  if ( fd < 0 && errno == ENOENT ) {
+    char *const slash = strrchr( tmp_path.str, '/' );
+    assert( slash != NULL );
+    *slash = '\0';
+    bool const made_dir = rc_mkdirs( tmp_path.str );
+    if ( made_dir ) {
+      // The failed mkstemp() may have changed the X's, so restore them.
+      strbuf_reset( &tmp_path );
+      strbuf_printf( &tmp_path, "%s.XXXXXX", rc_file_path.str );
+      fd = mkstemp( tmp_path.str );
+    }
+  }
+
+  bool ok = false;
+  if ( fd < 0 )
+    goto done;
+  if ( flock( fd, LOCK_EX ) < 0 ||
+       pwrite( fd, RC_FILE_MAGIC, STRLITLEN( RC_FILE_MAGIC ), 0 ) !=
+         STRLITLEN( RC_FILE_MAGIC ) ||
+       ftruncate( fd, sizeof( rc_file_header_t ) ) < 0 ||
+       rename( tmp_path.str, rc_file_path.str ) < 0 ) {
+    close( fd );                        // LCOV_EXCL_START
+    PJL_DISCARD_RV( unlink( tmp_path.str ) );
+    goto done;                          // LCOV_EXCL_STOP
+  }
+
+  rc_file_close();
+  rc_file_fd = fd;
+  rc_file_pid = getpid();
+  ok = true;
+
+done:
+  strbuf_cleanup( &tmp_path );
+  return ok;
+}
+
+/**
+ * Exclusively locks the results file creating it, if necessary.
+ *
+ * @remarks If the results file was replaced by another process since it was
+ * opened, the new file is opened instead.  If this is a child process, the
+ * file is opened again since a lock obtained via a file descriptor inherited
+ * from the parent would be shared with the parent and its other children.
+ *
+ * @return Returns `true` only if the results file is locked.
+ */
+NODISCARD
+static bool rc_file_lock( void ) {
+  for (;;) {
+    if ( rc_file_fd >= 0 && rc_file_pid != getpid() )
+      rc_file_close();
+    if ( rc_file_fd < 0 ) {
+      rc_file_open();
+      if ( rc_file_fd < 0 )
+        return rc_file_create();
+    }
+    if ( flock( rc_file_fd, LOCK_EX ) < 0 )
+      return false;                     // LCOV_EXCL_LINE
+
+    struct stat fd_st, path_st;
+    if ( fstat( rc_file_fd, &fd_st ) == 0 &&
+         stat( rc_file_path.str, &path_st ) == 0 &&
+         fd_st.st_dev == path_st.st_dev && fd_st.st_ino == path_st.st_ino ) {
+      return true;
+    }
+    rc_file_close();                    // LCOV_EXCL_LINE
+  } // for
+}
+
+/**
+ * Adds \a result to the results file for \a key.
+ *
+ * @param key The key.
+ * @param result The result for \a key.
+ * @param result_len The length of \a result.
+ *
+ * @note Since the results file is only a cache, errors are silently ignored.
+ *
+ * @sa rc_file_find()
+ */
+static void rc_file_add( strbuf_t const *key, char const *result,
+                         size_t result_len ) {
+  assert( key != NULL );
+  assert( result != NULL || result_len == 0 );
+
+  if ( key->len > UINT32_MAX || result_len > UINT32_MAX )
+    return;                             // LCOV_EXCL_LINE
+  if ( !rc_file_lock() )
+    return;
+
+  strbuf_t rec_sbuf;
+  strbuf_init( &rec_sbuf );
+
+  struct stat st;
+  if ( fstat( rc_file_fd, &st ) < 0 )
+    goto done;                          // LCOV_EXCL_LINE
+  uint64_t file_size = STATIC_CAST( uint64_t, st.st_size );
+
+  size_t const rec_size = sizeof( rc_file_record_t ) + key->len + result_len;
+  size_t const rec_pad = (8 - rec_size % 8) % 8;
+
+  char magic[ STRLITLEN( RC_FILE_MAGIC ) ];
+  if ( file_size < sizeof( rc_file_header_t ) ||
+       file_size + rec_size + rec_pad > RC_FILE_SIZE_MAX ||
+       pread( rc_file_fd, magic, sizeof magic, 0 ) != sizeof magic ||
+       memcmp( magic, RC_FILE_MAGIC, sizeof magic ) != 0 ) {
+    //
+    // The file is either new, full, or not a results file we understand: (re)
+    // start it with all buckets empty.
+    //
+    if ( !rc_file_create() )
+      goto done;                        // LCOV_EXCL_LINE
+    file_size = sizeof( rc_file_header_t );
+  }
+
+  uint64_t const hash = rc_hash( key->str, key->len );
+  off_t const bucket_off = STATIC_CAST( off_t,
+    offsetof( rc_file_header_t, buckets ) +
+    (hash & (RC_FILE_BUCKETS_LEN - 1)) * sizeof( uint64_t )
+  );
+
+  rc_file_record_t rec = {
+    .hash = hash,
+    .key_len = STATIC_CAST( uint32_t, key->len ),
+    .result_len = STATIC_CAST( uint32_t, result_len )
+  };
+  if ( pread( rc_file_fd, &rec.next_off, sizeof rec.next_off, bucket_off ) !=
+       sizeof rec.next_off ) {
+    goto done;                          // LCOV_EXCL_LINE
+  }
+
+  strbuf_reserve( &rec_sbuf, rec_size + rec_pad );
+  RC_PUT_VAR( &rec_sbuf, rec );
+  rc_put_bytes( &rec_sbuf, key->str, key->len );
+  if ( result_len > 0 )
+    rc_put_bytes( &rec_sbuf, result, result_len );
+  static char const ZEROS[8];
+  rc_put_bytes( &rec_sbuf, ZEROS, rec_pad );
+
+  off_t const rec_off = STATIC_CAST( off_t, file_size );
+  if ( pwrite( rc_file_fd, rec_sbuf.str, rec_sbuf.len, rec_off ) !=
+       STATIC_CAST( ssize_t, rec_sbuf.len ) ) {
+    goto done;                          // LCOV_EXCL_LINE
+  }
+  // Only now that the record is written, make the bucket point to it.
+  PJL_DISCARD_RV(
+    pwrite( rc_file_fd, &file_size, sizeof file_size, bucket_off )
+  );
+
+done:
+  strbuf_cleanup( &rec_sbuf );
+  PJL_DISCARD_RV( flock( rc_file_fd, LOCK_UN ) );
+}
+
+/**
+ * Finds the result in the results file for \a key.
+ *
+ * @param key The key.
+ * @param key_len The length of \a key.
+ * @param rv_result The \ref strbuf to append the result onto, if found.
+ * @return Returns `true` only if the result was found.
+ *
+ * @sa rc_file_add()
+ */
+NODISCARD
+static bool rc_file_find( char const *key, size_t key_len,
+                          strbuf_t *rv_result ) {
+  assert( key != NULL );
+  assert( rv_result != NULL );
+
+  if ( rc_file_map == NULL && (rc_file_fd < 0 || !rc_file_remap()) )
+    return false;
+
+  uint64_t const hash = rc_hash( key, key_len );
+  uint64_t off;
+  memcpy( &off,
+    rc_file_map + offsetof( rc_file_header_t, buckets ) +
+      (hash & (RC_FILE_BUCKETS_LEN - 1)) * sizeof( uint64_t ),
+    sizeof off
+  );
+
+  //
+  // Since a record can only point to an earlier one, requiring offsets to
+  // decrease also guarantees termination even if the file is corrupt.
+  //
+  for ( uint64_t prev_off = UINT64_MAX;
+        off >= sizeof( rc_file_header_t ) && off < prev_off &&
+        off <= RC_FILE_SIZE_MAX; ) {
+    rc_file_record_t rec;
+    if ( !rc_file_maps( off + sizeof rec ) )
+      break;
+    memcpy( &rec, rc_file_map + off, sizeof rec );
+    if ( !rc_file_maps( off + sizeof rec + rec.key_len + rec.result_len ) )
+      break;
+    char const *const rec_key = rc_file_map + off + sizeof rec;
+    if ( rec.hash == hash && rec.key_len == key_len &&
+         memcmp( rec_key, key, key_len ) == 0 ) {
+      strbuf_putsn( rv_result, rec_key + key_len, rec.result_len );
+      return true;
+    }
+    prev_off = off;
+    off = rec.next_off;
+  } // for
+
+  return false;
+}
+
+/**
+ * Checks whether the results file may be used for \a q.
+ *
+ * @param q The \ref result_cache_query to check.
+ * @return Returns `true` only if there is a results file and nothing has
+ * changed since initialization, that is the state is still exactly determined
+ * by what's in \ref rc_file_key_prefix.
+ */
+NODISCARD
+static bool rc_file_is_usable( result_cache_query_t const *q ) {
+  assert( q != NULL );
+  return rc_init_fp.len > 0 && q->fp_len == rc_init_fp.len &&
+         memcmp( q->key.str, rc_init_fp.str, q->fp_len ) == 0;
+}
+
+/**
+ * Gets the key in the results file for \a q.
+ *
+ * @param q The \ref result_cache_query to get the key for.
+ * @param sbuf The \ref strbuf to append the key onto.
+ */
+static void rc_file_key( result_cache_query_t const *q, strbuf_t *sbuf ) {
+  assert( q != NULL );
+  assert( sbuf != NULL );
+  rc_put_bytes( sbuf, rc_file_key_prefix.str, rc_file_key_prefix.len );
+  rc_put_bytes( sbuf, q->key.str + q->fp_len, q->key.len - q->fp_len );
+}
+
+/**
+ * Gets the key in the results file for the prompt.
+ *
+ * @param sbuf The \ref strbuf to append the key onto.
+ *
+ * @sa result_cache_dir_find_prompt()
+ */
+static void rc_file_prompt_key( strbuf_t *sbuf ) {
+  assert( sbuf != NULL );
+  rc_put_bytes( sbuf, rc_file_key_prefix.str, rc_file_key_prefix.len );
+  strbuf_puts( sbuf, RC_FILE_PROMPT_KEY );
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void result_cache_add( result_cache_query_t const *q,
+                       strbuf_t const *result ) {
+  assert( q != NULL );
+  assert( result != NULL );
+
+  //
+  // If the command changed any option, type, or macro, then the key's
+  // fingerprint would no longer match and the result would never be found
+  // anyway.  More importantly, a future identical command that didn't need to
+  // make such a change can't simply use the result.
+  //
+  strbuf_t fp_sbuf;
+  strbuf_init( &fp_sbuf );
+  rc_put_fingerprint( &fp_sbuf );
+  bool const is_same_fp = fp_sbuf.len == q->fp_len &&
+    memcmp( fp_sbuf.str, q->key.str, q->fp_len ) == 0;
+  strbuf_cleanup( &fp_sbuf );
+  if ( !is_same_fp || rc_find( q ) != NULL )
+    return;
+
+  rc_add( q, result->str, result->len );
+
+  if ( rc_file_is_usable( q ) ) {
+    strbuf_t key_sbuf;
+    strbuf_init( &key_sbuf );
+    rc_file_key( q, &key_sbuf );
+    rc_file_add( &key_sbuf, result->str, result->len );
+    strbuf_cleanup( &key_sbuf );
+  }
+}
+
+void result_cache_dir_disable( void ) {
+  rc_file_close();
+  strbuf_reset( &rc_file_path );
+  strbuf_reset( &rc_init_fp );
+}
+
+bool result_cache_dir_find( char const *s, size_t s_len,
+                            strbuf_t *rv_result ) {
+  assert( s != NULL );
+  assert( rv_result != NULL );
+
+  if ( rc_file_path.len == 0 || opt_cdecl_debug != CDECL_DEBUG_NO )
+    return false;
+
+  strbuf_t key_sbuf;
+  strbuf_init( &key_sbuf );
+  rc_put_bytes( &key_sbuf, rc_file_key_prefix.str, rc_file_key_prefix.len );
+  bool const found = rc_put_command( &key_sbuf, s, s_len ) &&
+    rc_file_find( key_sbuf.str, key_sbuf.len, rv_result );
+  strbuf_cleanup( &key_sbuf );
+  return found;
+}
+
+bool result_cache_dir_find_prompt( strbuf_t *rv_prompt ) {
+  assert( rv_prompt != NULL );
+
+  if ( rc_file_path.len == 0 || opt_cdecl_debug != CDECL_DEBUG_NO )
+    return false;
+
+  strbuf_t key_sbuf;
+  strbuf_init( &key_sbuf );
+  rc_file_prompt_key( &key_sbuf );
+  bool const found = rc_file_find( key_sbuf.str, key_sbuf.len, rv_prompt );
+  strbuf_cleanup( &key_sbuf );
+  return found;
+}
+
+size_t result_cache_dir_hash( void ) {
+  return rc_hash( rc_file_key_prefix.str, rc_file_key_prefix.len );
+}
+
+void result_cache_dir_init( uint64_t config_hash ) {
+  ASSERT_RUN_ONCE();
+  assert( opt_cache_dir != NULL );
+
+  if ( opt_cache_dir[0] != '\0' ) {
+    strbuf_puts( &rc_file_path, opt_cache_dir );
+  }
+  else {
+    char const *const cache_home = null_if_empty( getenv( "XDG_CACHE_HOME" ) );
+    if ( cache_home != NULL ) {
+      strbuf_puts( &rc_file_path, cache_home );
+    }
+    else {
+      char const *const home = null_if_empty( getenv( "HOME" ) );
+      if ( home == NULL )
+        return;                         // LCOV_EXCL_LINE
+      strbuf_puts( &rc_file_path, home );
+      strbuf_paths( &rc_file_path, ".cache" );
+    }
+    strbuf_paths( &rc_file_path, CDECL );
+  }
+  strbuf_paths( &rc_file_path, RC_FILE_NAME );
+  rc_cleanup_atexit();
+  rc_file_open();
+
+  //
+  // Everything that determines the state after initialization must be part of
+  // every key: a different version may have different predefined types or
+  // print results differently and the configuration file may set options or
+  // define types or macros.
+  //
+  rc_put_bytes( &rc_file_key_prefix, PACKAGE_STRING, sizeof PACKAGE_STRING );
+  RC_PUT_VAR( &rc_file_key_prefix, config_hash );
+  RC_PUT_VAR( &rc_file_key_prefix, opt_predef_types );
+  RC_PUT_VAR( &rc_file_key_prefix, opt_read_config );
+  rc_put_options( &rc_file_key_prefix );
+}
+
+void result_cache_dir_ready( void ) {
+  if ( rc_file_path.len == 0 )
+    return;
+  rc_put_fingerprint( &rc_init_fp );
+
+  if ( opt_echo_commands ) {
+    //
+    // The prompt depends on options the configuration file may set, so save
+    // the prompt after initialization for cdecl_parse_cli_cached() to echo
+    // commands with.
+    //
+    strbuf_t prompt_sbuf;
+    strbuf_init( &prompt_sbuf );
+    if ( !result_cache_dir_find_prompt( &prompt_sbuf ) ) {
+      strbuf_t key_sbuf;
+      strbuf_init( &key_sbuf );
+      rc_file_prompt_key( &key_sbuf );
+      char const *const prompt = cdecl_prompt( /*is_cont_line=*/false );
+      rc_file_add( &key_sbuf, prompt, strlen( prompt ) );
+      strbuf_cleanup( &key_sbuf );
+    }
+    strbuf_cleanup( &prompt_sbuf );
+  }
+}
+
+bool result_cache_dir_path( char const *name, strbuf_t *rv_path ) {
+  assert( name != NULL );
+  assert( rv_path != NULL );
+
+  if ( rc_file_path.len == 0 )
+    return false;
+
+  size_t const dir_len = rc_file_path.len - STRLITLEN( "/" RC_FILE_NAME );
+  strbuf_putsn( rv_path, rc_file_path.str, dir_len );
+  if ( !rc_mkdirs( rv_path->str ) )
+    return false;                       // LCOV_EXCL_LINE
+  strbuf_paths( rv_path, name );
+  return true;
+}
+
+char const* result_cache_find( result_cache_query_t const *q ) {
+  assert( q != NULL );
+  rc_entry_t *const entry = rc_find( q );
+  if ( entry != NULL ) {
+    ++rc_hits;
+    rc_lru_touch( entry );
+    return entry->result;
+  }
+
+  if ( rc_file_is_usable( q ) ) {
+    strbuf_t key_sbuf, result_sbuf;
+    strbuf_init( &key_sbuf );
+    strbuf_init( &result_sbuf );
+    rc_file_key( q, &key_sbuf );
+    bool const found =
+      rc_file_find( key_sbuf.str, key_sbuf.len, &result_sbuf );
+    if ( found )
+      rc_add( q, result_sbuf.str, result_sbuf.len );
+    strbuf_cleanup( &key_sbuf );
+    strbuf_cleanup( &result_sbuf );
+    if ( found ) {
+      ++rc_hits;
+      return rc_lru_head->result;
+    }
+  }
+
+  ++rc_misses;
+  return NULL;
+}
+
+void result_cache_query_cleanup( result_cache_query_t *q ) {
+  assert( q != NULL );
+  strbuf_cleanup( &q->key );
+}
+
+bool result_cache_query_init( result_cache_query_t *q, char const *s,
+                              size_t s_len ) {
+  assert( q != NULL );
+  assert( s != NULL );
+
+  if ( opt_cdecl_debug != CDECL_DEBUG_NO )
+    return false;                       // debug output isn't a result
+
+  *q = (result_cache_query_t){ 0 };
+  rc_put_fingerprint( &q->key );
+  q->fp_len = q->key.len;
+  if ( !rc_put_command( &q->key, s, s_len ) ) {
+    strbuf_cleanup( &q->key );
+    return false;
+  }
+  q->hash = rc_hash( q->key.str, q->key.len );
+  return true;
+}
+
+void result_cache_stats( result_cache_stats_t *stats ) {
+  assert( stats != NULL );
+  *stats = (result_cache_stats_t){
+    .hits = rc_hits,
+    .misses = rc_misses,
+    .len = rc_len,
+    .max = RESULT_CACHE_MAX
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,258 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/result_cache.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_result_cache_H
+#define cdecl_result_cache_H
+
+/**
+ * @file
+ * Declares types and functions for caching the results of commands.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
+#include <stdint.h>                     /* for uint64_t */
+
+/// @endcond
+
+/**
+ * @defgroup result-cache-group Result Cache
+ * Types and functions for caching the results of commands.
+ *
+ * @remarks
+ * @parblock
+ * The same `explain`, `declare`, and `cast` commands are often given again and
+ * again, so the result of each such command is cached so that, when the same
+ * command is given again, the cached result is printed without lexing,
+ * parsing, or checking it.
+ *
+ * A result is cached only if the command:
+ *
+ *  + Starts with `cast`, `declare`, or `explain`.
+ *  + Is only a single command.
+ *  + Succeeded without printing any errors or warnings.
+ *  + Changed neither any option nor any type nor any macro.
+ *
+ * A command's key is the command with whitespace normalized preceded by a
+ * fingerprint of every option that affects output and the generations of the
+ * sets of types and macros so that a cached result is never used once
+ * anything that would change it changes.
+ *
+ * At most #RESULT_CACHE_MAX results are cached; when full, the least recently
+ * used result is evicted.
+ *
+ * Optionally, results are also cached in a file in a directory so they're
+ * reused across invocations.  A result in the file is used only while the
+ * state is still what it was right after initialization since its key instead
+ * includes everything that determines that state: the version, options, and
+ * a hash code of the contents of the configuration file.
+ * @endparblock
+ * @{
+ */
+
+/**
+ * The maximum number of results that are cached.
+ */
+#define RESULT_CACHE_MAX          1024u
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A query of the result cache for a command.
+ *
+ * @sa result_cache_query_init()
+ */
+struct result_cache_query {
+  strbuf_t  key;                        ///< Fingerprint + normalized command.
+  size_t    fp_len;                     ///< Length of fingerprint in \ref key.
+  size_t    hash;                       ///< Hash code of \ref key.
+};
+
+/**
+ * Result cache statistics.
+ *
+ * @sa result_cache_stats()
+ */
+struct result_cache_stats {
+  size_t  hits;                         ///< Number of cache hits.
+  size_t  misses;                       ///< Number of cache misses.
+  size_t  len;                          ///< Number of cached results.
+  size_t  max;                          ///< Maximum number of cached results.
+};
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Adds \a result to the cache for the command of \a q, but only if no option,
+ * type, or macro changed since \a q was initialized.
+ *
+ * @param q The \ref result_cache_query for the command.
+ * @param result The result of the command.
+ *
+ * @sa result_cache_find()
+ */
+void result_cache_add( result_cache_query_t const *q,
+                       strbuf_t const *result );
+
+/**
+ * Stops using the cache directory for results.
+ *
+ * @remarks This must be called when the state after initialization depends on
+ * anything other than what's given to result_cache_dir_init(), e.g., files
+ * included by the configuration file, since a result added under such a state
+ * could later be found even though it would be different.
+ *
+ * @sa result_cache_dir_init()
+ */
+void result_cache_dir_disable( void );
+
+/**
+ * Finds the result for the command \a s in the cache directory.
+ *
+ * @remarks This may be called before **cdecl** is otherwise initialized, but
+ * only after result_cache_dir_init().
+ *
+ * @param s The **cdecl** command.  It need not be null-terminated.
+ * @param s_len The length of \a s.
+ * @param rv_result The \ref strbuf to append the result onto, if found.
+ * @return Returns `true` only if the result was found.
+ *
+ * @sa result_cache_dir_init()
+ */
+NODISCARD
+bool result_cache_dir_find( char const *s, size_t s_len, strbuf_t *rv_result );
+
+/**
+ * Finds the prompt after initialization in the cache directory.
+ *
+ * @remarks This may be called before **cdecl** is otherwise initialized, but
+ * only after result_cache_dir_init().  The prompt is saved only by
+ * result_cache_dir_ready() and only when \ref opt_echo_commands is set.
+ *
+ * @param rv_prompt The \ref strbuf to append the prompt onto, if found.
+ * @return Returns `true` only if the prompt was found.
+ *
+ * @sa result_cache_dir_find()
+ */
+NODISCARD
+bool result_cache_dir_find_prompt( strbuf_t *rv_prompt );
+
+/**
+ * Gets a hash code of the version, options, and contents of the configuration
+ * file given to result_cache_dir_init(), i.e., what every key in the results
+ * file starts with.
+ *
+ * @return Returns said hash code.
+ *
+ * @sa result_cache_dir_init()
+ */
+NODISCARD
+size_t result_cache_dir_hash( void );
+
+/**
+ * Initializes caching results in \ref opt_cache_dir.
+ *
+ * @param config_hash The hash code of the contents of the configuration file.
+ *
+ * @note This function must be called at most once and only after all options
+ * have been parsed, but before the configuration file is read.
+ *
+ * @sa result_cache_dir_ready()
+ */
+void result_cache_dir_init( uint64_t config_hash );
+
+/**
+ * Gets the path of a file in the cache directory creating the directory, if
+ * necessary.
+ *
+ * @param name The name of the file.
+ * @param rv_path The \ref strbuf to append the path onto.
+ * @return Returns `true` only if result_cache_dir_init() was called and the
+ * directory exists.
+ */
+NODISCARD
+bool result_cache_dir_path( char const *name, strbuf_t *rv_path );
+
+/**
+ * Notes that **cdecl** has been initialized, i.e., that the current state is
+ * exactly what's determined by the values given to result_cache_dir_init(),
+ * so the cache directory may be used as long as the state doesn't change.
+ *
+ * @sa result_cache_dir_init()
+ */
+void result_cache_dir_ready( void );
+
+/**
+ * Finds the cached result for the command of \a q.
+ *
+ * @param q The \ref result_cache_query for the command.
+ * @return Returns said result or NULL if the result of the command isn't
+ * cached.
+ *
+ * @sa result_cache_add()
+ */
+NODISCARD
+char const* result_cache_find( result_cache_query_t const *q );
+
+/**
+ * Cleans-up all memory associated with \a q but does _not_ free \a q itself.
+ *
+ * @param q The \ref result_cache_query to clean up.
+ *
+ * @sa result_cache_query_init()
+ */
+void result_cache_query_cleanup( result_cache_query_t *q );
+
+/**
+ * Initializes \a q for the command \a s.
+ *
+ * @param q The \ref result_cache_query to initialize.
+ * @param s The **cdecl** command.  It need not be null-terminated.
+ * @param s_len The length of \a s.
+ * @return Returns `true` only if the result of \a s may be cached; if `false`,
+ * \a q is not initialized.
+ *
+ * @sa result_cache_query_cleanup()
+ */
+NODISCARD
+bool result_cache_query_init( result_cache_query_t *q, char const *s,
+                              size_t s_len );
+
+/**
+ * Gets result cache statistics.
+ *
+ * @param stats The \ref result_cache_stats to fill in.
+ */
+void result_cache_stats( result_cache_stats_t *stats );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_result_cache_H */
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,385 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/server.c
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for running **cdecl** as a server listening on a Unix
+ * domain socket and as a client of such a server.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "server.h"
+#include "c_typedef.h"
+#include "capture.h"
+#include "cdecl.h"
+#include "lexer.h"
+#include "options.h"
+#include "parse.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+/// @endcond
+
+/**
+ * @addtogroup server-group
+ * @{
+ */
+
+////////// local variables ////////////////////////////////////////////////////
+
+static pid_t        server_pid;         ///< Process ID of the server.
+static char const  *server_path;        ///< Path of the server's socket.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Copies \a n bytes from \a fin to \a fout.
+ *
+ * @param fin The file to copy from.
+ * @param n The number of bytes to copy.
+ * @param fout The file to copy to.
+ * @return Returns `true` only if all \a n bytes were copied.
+ */
+NODISCARD
+static bool copy_n( FILE *fin, size_t n, FILE *fout ) {
+  assert( fin != NULL );
+  assert( fout != NULL );
+
+  char buf[ 4096 ];
+  while ( n > 0 ) {
+    size_t const read_n = fread( buf, 1, n < sizeof buf ? n : sizeof buf, fin );
+    if ( read_n == 0 )
+      return false;
+    if ( fwrite( buf, 1, read_n, fout ) < read_n )
+      perror_exit( EX_IOERR );
+    n -= read_n;
+  } // while
+  return true;
+}
+
+/**
+ * Receives a response from a **cdecl** server and writes its standard output
+ * and standard error to ours.
+ *
+ * @param fin The file to receive the response from.
+ * @param pstatus A pointer to receive the status of the response.
+ * @return Returns `true` only if a complete response was received.
+ */
+NODISCARD
+static bool client_response( FILE *fin, int *pstatus ) {
+  assert( fin != NULL );
+  assert( pstatus != NULL );
+
+  size_t err_len, out_len;
+  if ( fscanf( fin, "%d %zu %zu", pstatus, &out_len, &err_len ) != 3 ||
+       fgetc( fin ) != '\n' ) {
+    return false;
+  }
+  if ( !copy_n( fin, out_len, stdout ) )
+    return false;
+  FFLUSH( stdout );                     // so output is interleaved correctly
+  return copy_n( fin, err_len, stderr );
+}
+
+/**
+ * Initializes \a addr for \a path.
+ *
+ * @param addr The `sockaddr_un` to initialize.
+ * @param path The path of the Unix domain socket.
+ */
+static void init_sockaddr( struct sockaddr_un *addr, char const *path ) {
+  assert( addr != NULL );
+  assert( path != NULL );
+
+  *addr = (struct sockaddr_un){ .sun_family = AF_UNIX };
+  size_t const path_len = strlen( path );
+  if ( path_len >= sizeof addr->sun_path ) {
+    fatal_error( EX_USAGE,
+      "\"%s\": socket path too long; must be at most %zu characters\n",
+      path, sizeof addr->sun_path - 1
+    );
+  }
+  strcpy( addr->sun_path, path );
+}
+
+/**
+ * Cleans-up the server by removing its socket.
+ *
+ * @note This function is called only via **atexit**(3).
+ */
+static void server_cleanup( void ) {
+  if ( getpid() == server_pid )         // not in a child process
+    unlink( server_path );
+}
+
+/**
+ * Removes the server's socket upon receipt of a terminating signal, then
+ * re-raises it.
+ *
+ * @param sig The signal received.
+ */
+static void server_signal( int sig ) {
+  server_cleanup();
+  signal( sig, SIG_DFL );
+  raise( sig );
+}
+
+/**
+ * Writes all of \a buf to \a fd.
+ *
+ * @param fd The file descriptor to write to.
+ * @param buf The buffer to write.
+ * @param buf_len The number of bytes of \a buf to write.
+ * @return Returns `true` only if all of \a buf was written.
+ */
+NODISCARD
+static bool write_all( int fd, char const *buf, size_t buf_len ) {
+  while ( buf_len > 0 ) {
+    ssize_t const n = write( fd, buf, buf_len );
+    if ( n == -1 ) {
+      if ( errno == EINTR )
+        continue;
+      return false;
+    }
+    buf += n;
+    buf_len -= STATIC_CAST( size_t, n );
+  } // while
+  return true;
+}
+
+/**
+ * Sends a response to a client.
+ *
+ * @param fd The file descriptor of the client connection.
+ * @param status The exit status.
+ * @param out_sbuf The standard output to send.
+ * @param err_sbuf The standard error to send.
+ * @return Returns `true` only if the response was sent.
+ */
+NODISCARD
+static bool server_respond( int fd, int status, strbuf_t const *out_sbuf,
+                            strbuf_t const *err_sbuf ) {
+  assert( out_sbuf != NULL );
+  assert( err_sbuf != NULL );
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+  strbuf_printf( &sbuf, "%d %zu %zu\n", status, out_sbuf->len, err_sbuf->len );
+  strbuf_putsn( &sbuf, out_sbuf->str, out_sbuf->len );
+  strbuf_putsn( &sbuf, err_sbuf->str, err_sbuf->len );
+  bool const ok = write_all( fd, sbuf.str, sbuf.len );
+  strbuf_cleanup( &sbuf );
+  return ok;
+}
+
+/**
+ * Serves a single client connection until the client closes it.
+ *
+ * @note This is called only in a child process.
+ *
+ * @param fd The file descriptor of the client connection.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ */
+NODISCARD
+static int server_session( int fd ) {
+  signal( SIGPIPE, SIG_IGN );           // a vanished client isn't fatal
+  signal( SIGHUP, SIG_DFL );
+  signal( SIGINT, SIG_DFL );
+  signal( SIGTERM, SIG_DFL );
+
+  FILE *const fin = fdopen( fd, "r" );
+  PERROR_EXIT_IF( fin == NULL, EX_OSERR );
+  capture_init();
+
+  strbuf_t err_sbuf, out_sbuf;
+  strbuf_init( &err_sbuf );
+  strbuf_init( &out_sbuf );
+
+  char   *line = NULL;
+  size_t  line_cap = 0;
+  ssize_t line_len;
+
+  // Line numbers are the same as for commands given on the command line.
+  yylineno = opt_lineno == 0;
+
+  while ( (line_len = getline( &line, &line_cap, fin )) != -1 ) {
+    capture_begin();
+    int const status =
+      cdecl_parse_string( line, STATIC_CAST( size_t, line_len ) );
+    capture_end( &out_sbuf, &err_sbuf );
+    if ( !server_respond( fd, status, &out_sbuf, &err_sbuf ) )
+      break;
+    strbuf_reset( &err_sbuf );
+    strbuf_reset( &out_sbuf );
+  } // while
+
+  free( line );
+  strbuf_cleanup( &err_sbuf );
+  strbuf_cleanup( &out_sbuf );
+  fclose( fin );
+  return EX_OK;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_client( char const *path, size_t cli_count,
+                  char const *const cli_value[cli_count] ) {
+  assert( path != NULL );
+
+  // Commands are sent one per line, so a newline would split a command.
+  for ( size_t i = 0; i < cli_count; ++i ) {
+    if ( strchr( cli_value[i], '\n' ) != NULL ) {
+      fatal_error( EX_USAGE,
+        "--client/-U arguments must not contain newlines\n"
+      );
+    }
+  } // for
+
+  struct sockaddr_un addr;
+  init_sockaddr( &addr, path );
+
+  int const fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  PERROR_EXIT_IF( fd == -1, EX_OSERR );
+  if ( connect( fd, POINTER_CAST( struct sockaddr*, &addr ),
+                sizeof addr ) == -1 ) {
+    fatal_error( EX_UNAVAILABLE, "\"%s\": %s\n", path, STRERROR() );
+  }
+  FILE *const fin = fdopen( fd, "r" );
+  PERROR_EXIT_IF( fin == NULL, EX_OSERR );
+  signal( SIGPIPE, SIG_IGN );           // a vanished server isn't fatal
+
+  bool const prog_name_is_command =
+    strcmp( prog_name, CDECL ) != 0 && !is_cppdecl();
+  int status = EX_OK;
+
+  if ( cli_count > 0 || prog_name_is_command ) {
+    strbuf_t sbuf;
+    strbuf_init( &sbuf );
+    bool space = false;
+    if ( prog_name_is_command )
+      strbuf_sepc_puts( &sbuf, ' ', &space, prog_name );
+    for ( size_t i = 0; i < cli_count; ++i )
+      strbuf_sepc_puts( &sbuf, ' ', &space, cli_value[i] );
+    strbuf_putc( &sbuf, '\n' );
+    if ( !write_all( fd, sbuf.str, sbuf.len ) ||
+         !client_response( fin, &status ) ) {
+      fatal_error( EX_UNAVAILABLE, "\"%s\": no response from server\n", path );
+    }
+    strbuf_cleanup( &sbuf );
+  }
+  else {
+    char   *line = NULL;
+    size_t  line_cap = 0;
+    ssize_t line_len;
+
+    while ( (line_len = getline( &line, &line_cap, stdin )) != -1 ) {
+      size_t const len = STATIC_CAST( size_t, line_len );
+      if ( !write_all( fd, line, len ) ||
+           (line[ len - 1 ] != '\n' && !write_all( fd, "\n", 1 )) ||
+           !client_response( fin, &status ) ) {
+        break;                          // e.g., the "quit" command
+      }
+    } // while
+    free( line );
+  }
+
+  fclose( fin );
+  return status;
+}
+
+void cdecl_server( char const *path ) {
+  assert( path != NULL );
+
+  struct sockaddr_un addr;
+  init_sockaddr( &addr, path );
+
+  int const listen_fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  PERROR_EXIT_IF( listen_fd == -1, EX_OSERR );
+
+  struct stat path_stat;
+  if ( lstat( path, &path_stat ) == 0 && S_ISSOCK( path_stat.st_mode ) )
+    unlink( path );                     // left over from a previous server
+
+  // Only the user may connect since a client can, e.g., include any file the
+  // server can read.
+  mode_t const orig_umask = umask( 077 );
+  int const bind_rv = bind( listen_fd, POINTER_CAST( struct sockaddr*, &addr ),
+                            sizeof addr );
+  umask( orig_umask );
+  if ( bind_rv == -1 )
+    fatal_error( EX_CANTCREAT, "\"%s\": %s\n", path, STRERROR() );
+  server_path = path;
+  server_pid = getpid();
+  ATEXIT( &server_cleanup );
+  signal( SIGHUP, &server_signal );
+  signal( SIGINT, &server_signal );
+  signal( SIGTERM, &server_signal );
+
+  PERROR_EXIT_IF( listen( listen_fd, SOMAXCONN ) == -1, EX_OSERR );
+  signal( SIGCHLD, SIG_IGN );           // reap children automatically
+
+  // Types defined by a session are layered on top of those defined so far so
+  // a session never copies any of the latter.
+  c_typedefs_freeze();
+
+  for (;;) {
+    int const fd = accept( listen_fd, /*addr=*/NULL, /*addrlen=*/NULL );
+    if ( fd == -1 ) {
+      if ( errno == EINTR || errno == ECONNABORTED )
+        continue;
+      perror_exit( EX_OSERR );
+    }
+
+    FFLUSH( stdout );                   // don't duplicate buffered output
+    FFLUSH( stderr );
+
+    switch ( fork() ) {
+      case -1:
+        EPRINTF( "%s: %s\n", prog_name, STRERROR() );
+        break;
+      case 0:                           // child
+        close( listen_fd );
+        exit( server_session( fd ) );
+    } // switch
+    close( fd );
+  } // for
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,117 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/server.h
+**
+**      Copyright (C) 2017-2026  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_server_H
+#define cdecl_server_H
+
+/**
+ * @file
+ * Declares functions for running **cdecl** as a server listening on a Unix
+ * domain socket and as a client of such a server.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+// standard
+#include <stddef.h>                     /* for size_t */
+
+/**
+ * @defgroup server-group Server & Client
+ * Functions for running **cdecl** as a server listening on a Unix domain
+ * socket and as a client of such a server.
+ *
+ * @remarks
+ * @parblock
+ * The protocol is:
+ *
+ *  + A request is a single line of text comprising a **cdecl** command
+ *    terminated by a newline.
+ *
+ *  + A response is a header line of the form:
+ *
+ *          <status> <out-len> <err-len>\n
+ *
+ *    where _status_ is the exit status, _out-len_ is the number of bytes
+ *    written to standard output, and _err-len_ is the number of bytes written
+ *    to standard error; followed by exactly those bytes of standard output,
+ *    then of standard error.
+ *
+ * A client may send any number of requests over a single connection and
+ * receives exactly one response per request in order.  A connection's state
+ * (`set` options and user-defined types) persists only for the duration of
+ * that connection.
+ * @endparblock
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Runs **cdecl** as a client of a **cdecl** server.
+ *
+ * @remarks If \a cli_count is 0 and the program name is either **cdecl** or
+ * **c++decl**, sends each line read from standard input as a request;
+ * otherwise sends a single request comprising the program name (if it's a
+ * command) and the arguments.
+ *
+ * @param path The path of the Unix domain socket the server is listening on.
+ * @param cli_count The size of \a cli_value.
+ * @param cli_value The command-line arguments, if any, _after_ the program
+ * name.
+ * @return Returns the status of the last response received.
+ *
+ * @sa cdecl_server()
+ */
+NODISCARD
+int cdecl_client( char const *path, size_t cli_count,
+                  char const *const cli_value[cli_count] );
+
+/**
+ * Runs **cdecl** as a server listening on a Unix domain socket.
+ *
+ * @remarks
+ * @parblock
+ * Each connection is served by a child process forked from the fully
+ * initialized server process, so:
+ *
+ *  + Initialization is done once rather than once per command.
+ *  + Nothing a client does (e.g., `set` options or user-defined types) can
+ *    affect any other client.
+ *  + The types defined during initialization are frozen (see
+ *    c_typedefs_freeze()) so a client's own types are layered on top of them
+ *    and they remain shared with the server process rather than copied.
+ * @endparblock
+ *
+ * @param path The path of the Unix domain socket to listen on.  If it already
+ * exists and is a socket, it is replaced.
+ * @return Never returns normally.
+ *
+ * @sa cdecl_client()
+ */
+_Noreturn
+void cdecl_server( char const *path );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_server_H */
+/* vim:set et sw=2 ts=2: */
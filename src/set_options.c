@@ -102,6 +102,7 @@ static bool         is_no_option( char const* ),
 #ifdef ENABLE_FLEX_DEBUG
                     set_flex_debug( set_option_fn_args_t const* ),
 #endif /* ENABLE_FLEX_DEBUG */
+                    set_include_once( set_option_fn_args_t const* ),
                     set_infer_command( set_option_fn_args_t const* ),
                     set_lang( set_option_fn_args_t const* ),
                     set_permissive_types( set_option_fn_args_t const* ),
@@ -218,6 +219,12 @@ static set_option_t const SET_OPTIONS[] = {
   },
 #endif /* ENABLE_FLEX_DEBUG */
 
+  { L_OPT_include_once,
+    SET_OPTION_TOGGLE,
+    .has_arg = no_argument,
+    &set_include_once
+  },
+
   { L_OPT_infer_command,
     SET_OPTION_TOGGLE,
     .has_arg = no_argument,
@@ -323,7 +330,7 @@ static set_option_t const* find_option( char const *name,
       print_error( name_loc,
         "\"%s\": ambiguous set option; could be ", orig_name
       );
-      fput_list( stderr, found_opt_list.head, &slist_set_option_gets );
+      fput_list( EFILE, found_opt_list.head, &slist_set_option_gets );
       EPUTC( '\n' );
   } // switch
 
@@ -465,6 +472,7 @@ static void print_options( void ) {
   }
   PUTC( '\n' );
 
+  print_option( L_OPT_include_once, po_bool_value( opt_include_once ), LANG_ANY );
   print_option( L_OPT_infer_command, po_bool_value( opt_infer_command ), LANG_ANY );
   print_option( L_OPT_language, c_lang_name( opt_lang_id ), LANG_ANY );
   print_option( L_OPT_permissive_types, po_bool_value( opt_permissive_types ), LANG_ANY );
@@ -664,6 +672,18 @@ static bool set_flex_debug( set_option_fn_args_t const *args ) {
 }
 #endif /* ENABLE_FLEX_DEBUG */
 
+/**
+ * Sets the `include-once` option.
+ *
+ * @param args The set option arguments.
+ * @return Always returns `true`.
+ */
+NODISCARD
+static bool set_include_once( set_option_fn_args_t const *args ) {
+  opt_include_once = args->opt_enabled;
+  return true;
+}
+
 /**
  * Sets the `infer-command` option.
  *
@@ -36,6 +36,7 @@
 #include "p_macro.h"
 #include "p_token.h"
 #include "print.h"
+#include "result_cache.h"
 #include "slist.h"
 #include "type_traits.h"
 #include "types.h"
@@ -125,11 +126,6 @@ static bool show_type_visitor( c_typedef_t const *tdef, void *visit_data ) {
       goto no_show;
   }
 
-  if ( !c_sglob_empty( &sti->sglob ) &&
-       !c_sname_match( &tdef->ast->sname, &sti->sglob ) ) {
-    goto no_show;
-  }
-
   show_type( tdef, sti->decl_flags, sti->fout );
   sti->showed_any = true;
 
@@ -139,6 +135,43 @@ no_show:
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+void show_ast_stats( FILE *fout ) {
+  assert( fout != NULL );
+
+  c_ast_stats_t stats;
+  c_ast_stats( &stats );
+
+  double const ast_count = STATIC_CAST( double, stats.ast_count );
+  double const cold_count = STATIC_CAST( double, stats.cold_count );
+  double const bytes =
+    ast_count * STATIC_CAST( double, stats.ast_size ) +
+    cold_count * STATIC_CAST( double, stats.cold_size );
+
+  FPRINTF( fout,
+    "AST nodes: %zu node%s, %zu with cold data (%.1f%%)\n"
+    "AST bytes per node: %.1f (%zu + %zu per cold data); "
+    "%zu with cold data inline\n",
+    stats.ast_count, stats.ast_count == 1 ? "" : "s",
+    stats.cold_count,
+    stats.ast_count > 0 ? 100 * cold_count / ast_count : 0.0,
+    stats.ast_count > 0 ? bytes / ast_count : 0.0,
+    stats.ast_size, stats.cold_size, stats.inline_size
+  );
+}
+
+void show_cache( FILE *fout ) {
+  assert( fout != NULL );
+
+  result_cache_stats_t stats;
+  result_cache_stats( &stats );
+  FPRINTF( fout,
+    "result cache: %zu hit%s, %zu miss%s, %zu/%zu results\n",
+    stats.hits, stats.hits == 1 ? "" : "s",
+    stats.misses, stats.misses == 1 ? "" : "es",
+    stats.len, stats.max
+  );
+}
+
 bool show_macro( p_macro_t const *macro, FILE *fout ) {
   assert( macro != NULL );
   assert( fout != NULL );
@@ -215,7 +248,7 @@ bool show_types( cdecl_show_t show, char const *glob, decl_flags_t decl_flags,
   c_sglob_init( &sti.sglob );
   c_sglob_parse( glob, &sti.sglob );
 
-  c_typedef_visit( &show_type_visitor, &sti );
+  c_typedef_visit_sglob( &sti.sglob, &show_type_visitor, &sti );
 
   if ( !sti.showed_any && (show & CDECL_SHOW_USER_DEFINED) != 0 &&
        glob != NULL && strchr( glob, '*' ) == NULL ) {
@@ -225,7 +258,7 @@ bool show_types( cdecl_show_t show, char const *glob, decl_flags_t decl_flags,
     //
     sti.show &= ~TO_UNSIGNED_EXPR( CDECL_SHOW_USER_DEFINED );
     sti.show |= CDECL_SHOW_PREDEFINED;
-    c_typedef_visit( &show_type_visitor, &sti );
+    c_typedef_visit_sglob( &sti.sglob, &show_type_visitor, &sti );
   }
 
   c_sglob_cleanup( &sti.sglob );
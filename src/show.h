@@ -44,6 +44,24 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * Shows (prints) AST node memory statistics.
+ *
+ * @param fout The `FILE` to print to.
+ *
+ * @sa c_ast_stats()
+ */
+void show_ast_stats( FILE *fout );
+
+/**
+ * Shows (prints) result cache statistics.
+ *
+ * @param fout The `FILE` to print to.
+ *
+ * @sa \ref result-cache-group
+ */
+void show_cache( FILE *fout );
+
 /**
  * Shows (prints) the definition of \a macro.
  *
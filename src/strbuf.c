@@ -172,6 +172,26 @@ char* strbuf_puts_quoted( strbuf_t *sbuf, char quote, char const *s ) {
   return sbuf->str;
 }
 
+char* strbuf_puts_sp( strbuf_t *sbuf, char const *s ) {
+  assert( sbuf != NULL );
+  assert( s != NULL );
+  if ( s[0] != '\0' ) {
+    strbuf_puts( sbuf, s );
+    strbuf_putc( sbuf, ' ' );
+  }
+  return sbuf->str;
+}
+
+char* strbuf_putsp_s( strbuf_t *sbuf, char const *s ) {
+  assert( sbuf != NULL );
+  assert( s != NULL );
+  if ( s[0] != '\0' ) {
+    strbuf_putc( sbuf, ' ' );
+    strbuf_puts( sbuf, s );
+  }
+  return sbuf->str;
+}
+
 bool strbuf_reserve( strbuf_t *sbuf, size_t res_len ) {
   assert( sbuf != NULL );
   if ( res_len < sbuf->cap - sbuf->len )
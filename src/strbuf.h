@@ -181,6 +181,32 @@ inline char* strbuf_puts( strbuf_t *sbuf, char const *s ) {
 PJL_DISCARD
 char* strbuf_puts_quoted( strbuf_t *sbuf, char quote, char const *s );
 
+/**
+ * If \a s is not empty, appends \a s followed by a space onto the end of \a
+ * sbuf growing the buffer if necessary; otherwise does nothing.
+ *
+ * @param sbuf A pointer to the \ref strbuf to append onto.
+ * @param s The string to append.
+ * @return Returns \ref strbuf::str "sbuf->str".
+ *
+ * @sa strbuf_putsp_s()
+ */
+PJL_DISCARD
+char* strbuf_puts_sp( strbuf_t *sbuf, char const *s );
+
+/**
+ * If \a s is not empty, appends a space followed by \a s onto the end of \a
+ * sbuf growing the buffer if necessary; otherwise does nothing.
+ *
+ * @param sbuf A pointer to the \ref strbuf to append onto.
+ * @param s The string to append.
+ * @return Returns \ref strbuf::str "sbuf->str".
+ *
+ * @sa strbuf_puts_sp()
+ */
+PJL_DISCARD
+char* strbuf_putsp_s( strbuf_t *sbuf, char const *s );
+
 /**
  * Ensures at least \a res_len additional bytes of capacity exist in \a sbuf.
  *
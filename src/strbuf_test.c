@@ -77,6 +77,26 @@ static bool test_strbuf_put_quoted( void ) {
   TEST_FUNC_END();
 }
 
+static bool test_strbuf_puts_sp( void ) {
+  TEST_FUNC_BEGIN();
+  strbuf_t sbuf;
+
+  strbuf_init( &sbuf );
+  strbuf_puts_sp( &sbuf, "" );
+  TEST( sbuf.len == 0 );
+  strbuf_puts_sp( &sbuf, "a" );
+  TEST( strcmp( sbuf.str, "a " ) == 0 );
+
+  strbuf_reset( &sbuf );
+  strbuf_putsp_s( &sbuf, "" );
+  TEST( sbuf.len == 0 );
+  strbuf_putsp_s( &sbuf, "a" );
+  TEST( strcmp( sbuf.str, " a" ) == 0 );
+
+  strbuf_cleanup( &sbuf );
+  TEST_FUNC_END();
+}
+
 ////////// main ///////////////////////////////////////////////////////////////
 
 int main( int argc, char const *const argv[] ) {
@@ -84,6 +104,7 @@ int main( int argc, char const *const argv[] ) {
 
   test_strbuf_paths();
   test_strbuf_put_quoted();
+  test_strbuf_puts_sp();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -180,6 +180,16 @@ enum c_op_id {
   C_OP_TILDE,                           ///< The `~` operator.
 };
 
+/**
+ * How a single glob of a \ref c_sglob matches a name.
+ */
+enum c_sglob_kind {
+  C_SGLOB_LITERAL,                      ///< No `*`, e.g., `x`.
+  C_SGLOB_ANY,                          ///< Only `*`.
+  C_SGLOB_PREFIX,                       ///< Only a trailing `*`, e.g., `x*`.
+  C_SGLOB_WILD                          ///< Any other `*`, e.g., `*x` or `x*y`.
+};
+
 /**
  * **Cdecl** debug mode.
  */
@@ -250,7 +260,12 @@ enum cdecl_test {
   /**
    * Do not read any file under the user's home directory by default.
    */
-  CDECL_TEST_NO_HOME            = 1 << 3
+  CDECL_TEST_NO_HOME            = 1 << 3,
+
+  /**
+   * Report all timings as zero.
+   */
+  CDECL_TEST_NO_TIMING          = 1 << 4
 };
 
 /**
@@ -467,19 +482,23 @@ typedef struct c_apple_block_ast  c_apple_block_ast_t;
 typedef struct c_array_ast        c_array_ast_t;
 typedef enum   c_array_kind       c_array_kind_t;
 typedef struct c_ast              c_ast_t;
-typedef slist_t                   c_ast_list_t;   ///< AST list.
+typedef struct c_ast_arena        c_ast_arena_t;
+typedef struct c_ast_arena_chunk  c_ast_arena_chunk_t;
+typedef struct c_ast_cold         c_ast_cold_t;
+typedef struct c_ast_list         c_ast_list_t;
 typedef struct c_ast_pair         c_ast_pair_t;
+typedef struct c_ast_stats        c_ast_stats_t;
 typedef struct c_bit_field_ast    c_bit_field_ast_t;
 typedef struct c_builtin_ast      c_builtin_ast_t;
 
 /**
  * C++ lambda capture.
  *
- * @remarks The \ref slist_node::data "data" is the capture's AST.
+ * @remarks It's an element of a \ref c_ast_list, i.e., the capture's AST.
  *
  * @sa c_capture_ast()
  */
-typedef slist_node_t              c_capture_t;
+typedef c_ast_t*                  c_capture_t;
 
 typedef struct c_capture_ast      c_capture_ast_t;
 typedef enum   c_capture_kind     c_capture_kind_t;
@@ -521,11 +540,11 @@ typedef struct c_operator_ast     c_operator_ast_t;
 /**
  * C/C++ function-like parameter.
  *
- * @remarks The \ref slist_node::data "data" is the parameter's AST.
+ * @remarks It's an element of a \ref c_ast_list, i.e., the parameter's AST.
  *
  * @sa c_param_ast()
  */
-typedef slist_node_t              c_param_t;
+typedef c_ast_t*                  c_param_t;
 
 typedef struct c_parent_ast       c_parent_ast_t;
 typedef struct c_ptr_mbr_ast      c_ptr_mbr_ast_t;
@@ -539,6 +558,8 @@ typedef struct c_ptr_ref_ast      c_ptr_ref_ast_t;
 typedef slist_node_t              c_scope_t;
 
 typedef struct c_sglob            c_sglob_t;
+typedef enum   c_sglob_kind       c_sglob_kind_t;
+typedef struct c_sglob_pattern    c_sglob_pattern_t;
 typedef slist_t                   c_sname_t;      ///< C++ scoped name.
 typedef struct c_struct_bind_ast  c_struct_bind_ast_t;
 typedef uint64_t                  c_tid_t;        ///< Type ID(s) bits.
@@ -551,6 +572,8 @@ typedef enum   cdecl_debug        cdecl_debug_t;
 typedef enum   cdecl_show         cdecl_show_t;
 typedef enum   cdecl_test         cdecl_test_t;
 typedef enum   decl_flags         decl_flags_t;
+typedef struct keyword            keyword_t;
+typedef struct mapped_file        mapped_file_t;
 
 /**
  * C preprocessor macro argument list.
@@ -573,6 +596,8 @@ typedef struct p_token            p_token_t;
 typedef slist_t                   p_token_list_t; ///< Preprocessor token list.
 typedef slist_node_t              p_token_node_t; ///< Preprocessor token node.
 typedef enum   predef_types       predef_types_t;
+typedef struct result_cache_query result_cache_query_t;
+typedef struct result_cache_stats result_cache_stats_t;
 typedef union  user_data          user_data_t;
 
 typedef c_loc_t YYLTYPE;                ///< Source location type for Bison.
@@ -633,6 +658,22 @@ struct c_alignas {
   };
 };
 
+/**
+ * A list of AST nodes, e.g., function-like parameters or lambda captures.
+ *
+ * @remarks The AST nodes are stored contiguously so getting the _i_th one is
+ * O(1).  Whenever \ref asts isn't NULL, it's terminated by a NULL element so
+ * the AST node following any given element can be gotten without the list.
+ *
+ * @sa c_ast_list_init()
+ * @sa c_ast_list_cleanup()
+ */
+struct c_ast_list {
+  c_ast_t **asts;                       ///< AST nodes or NULL if none.
+  unsigned  len;                        ///< Number of AST nodes.
+  unsigned  cap;                        ///< Capacity not counting the NULL.
+};
+
 /**
  * A pair of AST pointers used as one of the synthesized attribute types in the
  * parser.
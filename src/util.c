@@ -61,6 +61,15 @@ char const WS_CHARS[] =           " \n\t\r\f\v";
 
 /// @endcond
 
+////////// extern variables ///////////////////////////////////////////////////
+
+/// @cond DOXYGEN_IGNORE
+/// Otherwise Doxygen generates two entries.
+
+FILE *efile_override;
+
+/// @endcond
+
 /**
  * @addtogroup util-group
  * @{
@@ -209,7 +218,8 @@ void fatal_error( int status, char const *format, ... ) {
   assert( status != EX_OK );
   assert( format != NULL );
 
-  EPRINTF( "%s: error: ", prog_name );
+  fflush( stdout );                     // so output is interleaved correctly
+  fprintf( stderr, "%s: error: ", prog_name );
   va_list args;
   va_start( args, format );
 
@@ -222,6 +232,15 @@ void fatal_error( int status, char const *format, ... ) {
   exit( status );
 }
 
+uint64_t fnv1a( uint64_t hash, void const *p, size_t n ) {
+  assert( p != NULL || n == 0 );
+  for ( unsigned char const *b = p; n > 0; --n, ++b ) {
+    hash ^= *b;
+    hash *= 0x100000001B3u;
+  } // for
+  return hash;
+}
+
 void fput_list( FILE *out, void const *elt,
                 char const* (*gets)( void const** ) ) {
   assert( out != NULL );
@@ -290,20 +309,6 @@ void fputs_quoted( char const *s, char quote, FILE *fout ) {
   FPUTC( quote, fout );
 }
 
-void fputs_sp( char const *s, FILE *out ) {
-  assert( s != NULL );
-  assert( out != NULL );
-  if ( s[0] != '\0' )
-    FPRINTF( out, "%s ", s );
-}
-
-void fputsp_s( char const *s, FILE *out ) {
-  assert( s != NULL );
-  assert( out != NULL );
-  if ( s[0] != '\0' )
-    FPRINTF( out, " %s", s );
-}
-
 char const* parse_identifier( char const *s ) {
   assert( s != NULL );
   if ( !is_ident_first( s[0] ) )
@@ -323,6 +328,9 @@ char const* path_basename( char const *path_name ) {
 
 // LCOV_EXCL_START
 void perror_exit( int status ) {
+  int const orig_errno = errno;
+  fflush( stdout );                     // not FFLUSH(): it calls us
+  errno = orig_errno;
   perror( prog_name );
   exit( status );
 }
@@ -311,10 +311,22 @@
 #define DECL_UNUSED(TYPE,N)       TYPE UNIQUE_NAME(unused)[ (N) ]
 
 /**
- * Shorthand for printing to standard error.
+ * The `FILE` that errors and warnings are printed to: \ref efile_override if
+ * not NULL or standard error otherwise.
+ *
+ * @sa #EPRINTF()
+ * @sa #EPUTC()
+ * @sa #EPUTS()
+ */
+#define EFILE                     \
+  (efile_override != NULL ? efile_override : stderr)
+
+/**
+ * Shorthand for printing to #EFILE.
  *
  * @param ... The `printf()` arguments.
  *
+ * @sa #EFILE
  * @sa #EPUTC()
  * @sa #EPUTS()
  * @sa #FPRINTF()
@@ -322,33 +334,35 @@
  * @sa #PUTC()
  * @sa #PUTS()
  */
-#define EPRINTF(...)              fprintf( stderr, __VA_ARGS__ )
+#define EPRINTF(...)              fprintf( EFILE, __VA_ARGS__ )
 
 /**
- * Shorthand for printing a character to standard error.
+ * Shorthand for printing a character to #EFILE.
  *
  * @param C The character to print.
  *
+ * @sa #EFILE
  * @sa #EPRINTF()
  * @sa #EPUTS()
  * @sa #FPUTC()
  * @sa #PRINTF()
  * @sa #PUTC()
  */
-#define EPUTC(C)                  fputc( (C), stderr )
+#define EPUTC(C)                  fputc( (C), EFILE )
 
 /**
- * Shorthand for printing a C string to standard error.
+ * Shorthand for printing a C string to #EFILE.
  *
  * @param S The C string to print.
  *
+ * @sa #EFILE
  * @sa #EPRINTF()
  * @sa #EPUTC()
  * @sa #FPUTS()
  * @sa #PRINTF()
  * @sa #PUTS()
  */
-#define EPUTS(S)                  fputs( (S), stderr )
+#define EPUTS(S)                  fputs( (S), EFILE )
 
 /**
  * Calls **ferror**(3) and exits if there was an error on \a STREAM.
@@ -371,6 +385,11 @@
 #define FFLUSH(STREAM) \
   PERROR_EXIT_IF( fflush( (STREAM) ) != 0, EX_IOERR )
 
+/**
+ * The initial value for fnv1a().
+ */
+#define FNV1A_INIT                0xCBF29CE484222325u
+
 /**
  * Convenience macro for iterating over the elements of a static array.
  *
@@ -1008,6 +1027,14 @@ MIN_IMPL(long double, ld)
 
 ////////// extern variables ///////////////////////////////////////////////////
 
+/**
+ * If not NULL, the `FILE` that errors and warnings are printed to instead of
+ * standard error.
+ *
+ * @sa #EFILE
+ */
+extern FILE *efile_override;
+
 /**
  * Identifier characters.
  *
@@ -1197,6 +1224,18 @@ inline bool false_set( bool *flag ) {
 PJL_PRINTF_LIKE_FUNC(2)
 _Noreturn void fatal_error( int status, char const *format, ... );
 
+/**
+ * Updates \a hash with \a n bytes of \a p using the Fowler-Noll-Vo (FNV-1a)
+ * hash function.
+ *
+ * @param hash The hash code so far or #FNV1A_INIT.
+ * @param p A pointer to the bytes to hash.
+ * @param n The number of bytes to hash.
+ * @return Returns the updated hash code.
+ */
+NODISCARD
+uint64_t fnv1a( uint64_t hash, void const *p, size_t n );
+
 /**
  * Prints a zero-or-more element list of strings where for:
  *
@@ -1246,28 +1285,6 @@ void fput_sep( char const *sep, bool *sep_flag, FILE *fout );
  */
 void fputs_quoted( char const *s, char quote, FILE *fout );
 
-/**
- * If \a s is not empty, prints \a s followed by a space to \a out; otherwise
- * does nothing.
- *
- * @param s The string to print.
- * @param out The `FILE` to print to.
- *
- * @sa fputsp_s()
- */
-void fputs_sp( char const *s, FILE *out );
-
-/**
- * If \a s is not empty, prints a space followed by \a s to \a out; otherwise
- * does nothing.
- *
- * @param s The string to print.
- * @param out The `FILE` to print to.
- *
- * @sa fputs_sp()
- */
-void fputsp_s( char const *s, FILE *out );
-
 /**
  * Checks whether \a c is an identifier character.
  *
@@ -0,0 +1,122 @@
+#! /usr/bin/env bash
+##
+#       cdecl -- C gibberish translator
+#       test/bench_lexer.sh
+#
+#       Copyright (C) 2017-2026  Paul J. Lucas
+#
+#       This program is free software: you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation, either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program.  If not, see <http://www.gnu.org/licenses/>.
+##
+
+##
+# Benchmarks lexing (and parsing) throughput by timing cdecl on a large
+# generated batch input.  To compare Flex table types, run this against cdecl
+# built with each of:
+#
+#     ./configure
+#     ./configure --enable-flex-tables=full
+#     ./configure --enable-flex-tables=fast
+##
+
+# Uncomment the following line for shell tracing.
+#set -x
+
+########## Functions ##########################################################
+
+local_basename() {
+  ##
+  # Autoconf, 11.15:
+  #
+  # basename
+  #   Not all hosts have a working basename. You can use expr instead.
+  ##
+  expr "//$1" : '.*/\(.*\)'
+}
+
+usage() {
+  cat >&2 <<END
+usage: $ME [-n lines] [-r runs] -s srcdir
+END
+  exit 1
+}
+
+generate_input() {
+  local i=0
+  echo 'define S::T::int_t as int'
+  while [ $i -lt $NUM_LINES ]
+  do
+    echo "explain int *const (*a$i)[4]"
+    echo "explain unsigned long long const volatile *p$i"
+    echo "explain S::T::int_t x$i"
+    echo "explain const S::T::int_t &r$i"
+    echo "explain S::T::int_t const *c$i"
+    echo "explain auto [x$i, y$i]"
+    echo "declare f$i as function (int, pointer to char) returning pointer to const char"
+    echo "declare m$i as pointer to member of class S::T int"
+    i=$(( i + 8 ))
+  done
+}
+
+########## Begin ##############################################################
+
+ME=$(local_basename "$0")
+
+########## Process command-line ###############################################
+
+NUM_LINES=100000
+RUNS=3
+
+while getopts n:r:s: opt
+do
+  case $opt in
+  n) NUM_LINES="$OPTARG" ;;
+  r) RUNS="$OPTARG" ;;
+  s) BUILD_SRC="$OPTARG" ;;
+  ?) usage ;;
+  esac
+done
+shift $(( OPTIND - 1 ))
+
+[ "$BUILD_SRC" ] || usage
+
+########## Initialize #########################################################
+
+[ "$TMPDIR" ] || TMPDIR=/tmp
+INPUT="$TMPDIR/cdecl_bench_input_$$_"
+trap "x=$?; rm -f $TMPDIR/*_$$_* 2>/dev/null; exit $x" EXIT HUP INT TERM
+
+##
+# Must put BUILD_SRC first in PATH so we get the correct version of cdecl.
+##
+PATH=$BUILD_SRC:$PATH
+
+generate_input > "$INPUT"
+
+########## Benchmark ##########################################################
+
+TIMEFORMAT=%R
+BEST=
+
+for run in $(seq 1 $RUNS)
+do
+  SECS=$( { time cdecl -C -xc++ --file="$INPUT" >/dev/null 2>&1 ; } 2>&1 )
+  echo "run $run: $SECS s"
+  BEST=$(awk -v s="$SECS" -v b="$BEST" 'BEGIN { print b == "" || s < b+0 ? s : b }')
+done
+
+LINES=$(wc -l < "$INPUT")
+echo "best: $BEST s for $LINES lines" \
+  "($(awk -v n=$LINES -v s=$BEST 'BEGIN { printf "%d", n / s }') lines/s)"
+
+# vim:set et sw=2 ts=2:
@@ -0,0 +1,122 @@
+#! /usr/bin/env bash
+##
+#       cdecl -- C gibberish translator
+#       test/bench_params.sh
+#
+#       Copyright (C) 2026  Paul J. Lucas
+#
+#       This program is free software: you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation, either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program.  If not, see <http://www.gnu.org/licenses/>.
+##
+
+##
+# Benchmarks how the time cdecl takes scales with the number of parameters a
+# function has by timing it on generated declarations having increasing
+# numbers of parameters.  The time per parameter should stay roughly constant,
+# i.e., the time should be linear in the number of parameters.
+##
+
+# Uncomment the following line for shell tracing.
+#set -x
+
+########## Functions ##########################################################
+
+local_basename() {
+  ##
+  # Autoconf, 11.15:
+  #
+  # basename
+  #   Not all hosts have a working basename. You can use expr instead.
+  ##
+  expr "//$1" : '.*/\(.*\)'
+}
+
+usage() {
+  cat >&2 <<END
+usage: $ME [-n counts] [-r runs] -s srcdir
+END
+  exit 1
+}
+
+generate_input() {
+  local i=1
+  printf 'explain void f(int a1'
+  while [ $i -lt $1 ]
+  do
+    i=$(( i + 1 ))
+    printf ', int a%d' $i
+  done
+  echo ')'
+  i=1
+  printf 'declare f as function (a1 as int'
+  while [ $i -lt $1 ]
+  do
+    i=$(( i + 1 ))
+    printf ', a%d as int' $i
+  done
+  echo ') returning void'
+}
+
+########## Begin ##############################################################
+
+ME=$(local_basename "$0")
+
+########## Process command-line ###############################################
+
+COUNTS="100 200 400 800 1600"
+RUNS=3
+
+while getopts n:r:s: opt
+do
+  case $opt in
+  n) COUNTS="$OPTARG" ;;
+  r) RUNS="$OPTARG" ;;
+  s) BUILD_SRC="$OPTARG" ;;
+  ?) usage ;;
+  esac
+done
+shift $(( OPTIND - 1 ))
+
+[ "$BUILD_SRC" ] || usage
+
+########## Initialize #########################################################
+
+[ "$TMPDIR" ] || TMPDIR=/tmp
+INPUT="$TMPDIR/cdecl_bench_input_$$_"
+trap "x=$?; rm -f $TMPDIR/*_$$_* 2>/dev/null; exit $x" EXIT HUP INT TERM
+
+##
+# Must put BUILD_SRC first in PATH so we get the correct version of cdecl.
+##
+PATH=$BUILD_SRC:$PATH
+
+########## Benchmark ##########################################################
+
+TIMEFORMAT=%R
+
+for count in $COUNTS
+do
+  generate_input $count > "$INPUT"
+  BEST=
+  for run in $(seq 1 $RUNS)
+  do
+    SECS=$( { time cdecl -C --file="$INPUT" >/dev/null 2>&1 ; } 2>&1 )
+    if [ -z "$BEST" ] || [ "$(echo "$SECS < $BEST" | bc)" -eq 1 ]
+    then BEST=$SECS
+    fi
+  done
+  echo "$count parameters: $BEST s" \
+    "($(echo "scale=3; $BEST * 1000000 / $count" | bc) us/parameter)"
+done
+
+# vim:set et sw=2 ts=2: